@@ -21,6 +21,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -43,6 +44,7 @@
 #include <AzCore/Module/Module.h>
 #include <AzCore/Module/ModuleManager.h>
 
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/IO/SystemFile.h>
@@ -94,6 +96,57 @@ static void PrintEntityName(const AZ::ConsoleCommandContainer& arguments)
 AZ_CONSOLEFREEFUNC(
     PrintEntityName, AZ::ConsoleFunctorFlags::Null, "Parameter: EntityId value, Prints the name of the entity to the console");
 
+static void mem_samplingStart(const AZ::ConsoleCommandContainer& arguments)
+{
+    AZ::Debug::AllocationSampler::Descriptor desc;
+    if (!arguments.empty())
+    {
+        desc.m_sampleIntervalBytes = AZStd::GetMax<size_t>(static_cast<size_t>(AZStd::stoull(AZStd::string(arguments.front()))), 1);
+    }
+    AZ::AllocatorManager::Instance().StartAllocationSampling(desc);
+    AZ_TracePrintf("Memory", "Allocation sampling started, one sample every %zu bytes on average.\n", desc.m_sampleIntervalBytes);
+}
+
+AZ_CONSOLEFREEFUNC(mem_samplingStart, AZ::ConsoleFunctorFlags::Null,
+    "Starts sampling the allocations with their callstacks, use mem_samplingDump to save the profile. Parameter: mean bytes between samples (default 524288)");
+
+static void mem_samplingStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    AZ::AllocatorManager::Instance().StopAllocationSampling();
+}
+
+AZ_CONSOLEFREEFUNC(mem_samplingStop, AZ::ConsoleFunctorFlags::Null, "Stops sampling the allocations, the profile is kept for mem_samplingDump");
+
+static void mem_samplingDump(const AZ::ConsoleCommandContainer& arguments)
+{
+    const AZ::Debug::AllocationSampler* sampler = AZ::AllocatorManager::Instance().GetAllocationSampler();
+    if (!sampler)
+    {
+        AZ_Warning("Memory", false, "mem_samplingDump: allocation sampling was not started, use mem_samplingStart.");
+        return;
+    }
+
+    const bool isHeaptrack = arguments.size() > 1 && arguments[1] == "heaptrack";
+    const AZStd::string path = arguments.empty() ? AZStd::string(isHeaptrack ? "AllocationSamples.heaptrack" : "AllocationSamples.pb")
+                                                 : AZStd::string(arguments.front());
+    AZStd::vector<char> profile;
+    AZ::IO::ByteContainerStream<AZStd::vector<char>> profileStream(&profile);
+    const bool exported = isHeaptrack ? sampler->ExportHeaptrack(profileStream) : sampler->ExportPprof(profileStream);
+
+    AZ::IO::SystemFile file;
+    if (!exported
+        || !file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY)
+        || file.Write(profile.data(), profile.size()) != profile.size())
+    {
+        AZ_Warning("Memory", false, "mem_samplingDump: failed to write the allocation samples to '%s'.", path.c_str());
+        return;
+    }
+    AZ_TracePrintf("Memory", "Allocation samples written to '%s', open it with %s.\n", path.c_str(), isHeaptrack ? "heaptrack_gui" : "pprof");
+}
+
+AZ_CONSOLEFREEFUNC(mem_samplingDump, AZ::ConsoleFunctorFlags::Null,
+    "Saves the allocation samples collected since mem_samplingStart. Parameters: file path (default AllocationSamples.pb), format pprof (default) or heaptrack");
+
 namespace AZ
 {
     static EnvironmentVariable<OverrunDetectionSchema> s_overrunDetectionSchema;
@@ -153,6 +206,8 @@ namespace AZ
         m_memoryBlocksByteSize = 0;
         m_reservedOS = 0;
         m_reservedDebug = 0;
+        m_threadCacheByteSize = 0;
+        m_allocationSamplingInterval = 0;
         m_recordingMode = Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE;
         m_stackRecordLevels = 5;
         m_enableDrilling = false;
@@ -314,6 +369,8 @@ namespace AZ
                 ->Field("blockSize", &Descriptor::m_memoryBlocksByteSize)
                 ->Field("reservedOS", &Descriptor::m_reservedOS)
                 ->Field("reservedDebug", &Descriptor::m_reservedDebug)
+                ->Field("threadCacheByteSize", &Descriptor::m_threadCacheByteSize)
+                ->Field("allocationSamplingInterval", &Descriptor::m_allocationSamplingInterval)
                 ->Field("enableDrilling", &Descriptor::m_enableDrilling)
                 ->Field("useOverrunDetection", &Descriptor::m_useOverrunDetection)
                 ->Field("useMalloc", &Descriptor::m_useMalloc)
@@ -353,6 +410,8 @@ namespace AZ
                         ->Attribute(Edit::Attributes::Step, &Descriptor::m_pageSize)
                     ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_reservedOS, "OS reserved memory", "System memory reserved for OS (used only when 'Allocate all memory at startup' is true)")
                     ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_reservedDebug, "Memory reserved for debugger", "System memory reserved for Debug allocator, like memory tracking (used only when 'Allocate all memory at startup' is true)")
+                    ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_threadCacheByteSize, "Thread cache size", "Bytes of freed small blocks each of the striped thread caches keeps to reduce allocator lock contention (0 disables the thread caches)")
+                    ->DataElement(Edit::UIHandlers::SpinBox, &Descriptor::m_allocationSamplingInterval, "Allocation sampling interval", "Mean bytes allocated between two sampled allocations, the samples can be saved with mem_samplingDump (0 disables sampling, ignored in Release builds)")
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_enableDrilling, "Enable Driller", "Enable Drilling support for the application (ignored in Release builds)")
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_useOverrunDetection, "Use Overrun Detection", "Use the overrun detection memory manager (only available on some platforms, ignored in Release builds)")
                     ->DataElement(Edit::UIHandlers::CheckBox, &Descriptor::m_useMalloc, "Use Malloc", "Use malloc for memory allocations (for memory debugging only, ignored in Release builds)")
@@ -825,6 +884,7 @@ namespace AZ
             AZ::SystemAllocator::Descriptor desc;
             desc.m_heap.m_pageSize = m_descriptor.m_pageSize;
             desc.m_heap.m_poolPageSize = m_descriptor.m_poolPageSize;
+            desc.m_heap.m_threadCacheByteSize = static_cast<size_t>(m_descriptor.m_threadCacheByteSize);
             if (m_descriptor.m_grabAllMemory)
             {
                 // grab all available memory
@@ -895,6 +955,15 @@ namespace AZ
         }
 
         allocatorManager.FinalizeConfiguration();
+
+#if !defined(_RELEASE)
+        if (m_descriptor.m_allocationSamplingInterval)
+        {
+            Debug::AllocationSampler::Descriptor samplerDesc;
+            samplerDesc.m_sampleIntervalBytes = static_cast<size_t>(m_descriptor.m_allocationSamplingInterval);
+            allocatorManager.StartAllocationSampling(samplerDesc);
+        }
+#endif
     }
 
     //=========================================================================
@@ -1395,6 +1464,12 @@ namespace AZ
             AZ_PROFILE_TIMER("System", "Component application simulation tick function");
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+            // Start a new frame for the frame arenas, memory allocated from them during the previous tick is released.
+            if (AllocatorInstance<FrameArenaAllocator>::IsReady())
+            {
+                static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            }
+
             AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
 
             m_deltaTime = 0.0f;
@@ -137,6 +137,8 @@ namespace AZ
             AZ::u64         m_memoryBlocksByteSize;     //!< Memory block size in bytes if. This parameter is ignored if m_grabAllMemory is set to true. (default: 0 - use memory on demand, no preallocation)
             AZ::u64         m_reservedOS;               //!< Reserved memory for the OS in bytes. Used only when m_grabAllMemory is set to true. (default: 0)
             AZ::u64         m_reservedDebug;            //!< Reserved memory for Debugging (allocation,etc.). Used only when m_grabAllMemory is set to true. (default: 0)
+            AZ::u64         m_threadCacheByteSize;      //!< Max bytes of freed small blocks cached per thread by the system allocator, reduces lock contention. (default: 0 - disabled)
+            AZ::u64         m_allocationSamplingInterval; //!< Mean bytes between allocations sampled with their callstack by the Debug::AllocationSampler. Ignored in release. (default: 0 - disabled)
             Debug::AllocationRecords::Mode m_recordingMode; //!< When to record stack traces (default: AZ::Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
             AZ::u64         m_stackRecordLevels;        //!< If stack recording is enabled, how many stack levels to record. (default: 5)
             bool            m_enableDrilling;           //!< True to enabled drilling support for the application. RegisterDrillers will be called. Ignored in release. (default: true)
@@ -18,6 +18,7 @@
 #include <AzCore/Debug/Trace.h>
 
 #include <AzCore/EBus/Internal/BusContainer.h>
+#include <AzCore/EBus/Internal/HandlerSnapshot.h>
 #include <AzCore/EBus/Internal/Debug.h>
 #include <AzCore/EBus/Policies.h>
 
@@ -561,8 +562,11 @@ namespace AZ
         };
 
         // This alias is required because you're not allowed to inherit from a nested type.
+        // Buses with EBusTraits::SnapshotDispatch replace the Event/Broadcast functions of the container dispatcher.
         template <typename Bus, typename Traits>
-        using EventDispatcher = typename Traits::BusesContainer::template Dispatcher<Bus>;
+        using EventDispatcher = AZStd::conditional_t<Traits::Traits::SnapshotDispatch,
+            AZ::Internal::SnapshotDispatcher<Bus, Traits, typename Traits::BusesContainer::template Dispatcher<Bus>>,
+            typename Traits::BusesContainer::template Dispatcher<Bus>>;
 
         /**
          * Base class that provides eventing, queueing, and enumeration functionality
@@ -829,13 +833,10 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
-                    [func = AZStd::forward<Function>(func), args...]() mutable
+                context.m_queue.Push([func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
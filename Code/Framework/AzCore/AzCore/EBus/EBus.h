@@ -178,6 +178,19 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies how queued events and functions are stored.
+         * Used only when #EnableEventQueue is true.
+         * Available queue policies include the following:
+         * - (Default) EBusQueuePolicy - each queued call is stored in an AZStd::function, in a single locked queue.
+         * - EBusCommandQueuePolicy - queued calls are packed with their arguments in recycled chunks, which
+         * doesn't allocate once warmed up, and producer threads don't contend on a single lock. Use it for buses
+         * queueing a lot of events, especially from several threads. The calls queued from different threads
+         * are not executed in the order they were queued.
+         */
+        template <bool IsEnabled, class Bus, class QueueMutexType>
+        using QueuePolicy = EBusQueuePolicy<IsEnabled, Bus, QueueMutexType>;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -198,6 +211,21 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+         * Determines whether dispatch reads an immutable snapshot of the handlers instead of locking the context.
+         * Connecting or disconnecting a handler copies the handlers into a new snapshot, and dispatches
+         * only publish the epoch they started in so the replaced snapshots can be freed once no thread reads them.
+         * Events and broadcasts don't contend on the context mutex, use it on buses dispatched from many threads
+         * where handlers are rarely connected or disconnected, as each connect/disconnect copies all the handlers.
+         * Disconnecting waits for the dispatches in progress on other threads, unless it is done from a dispatch on the same bus:
+         * then a handler that is destroyed must not receive events from other threads anymore (e.g. don't delete handlers from
+         * within a dispatch while other threads dispatch to them).
+         * Requires a MutexType (or LocklessDispatch), and BusIdType must support AZStd::hash.
+         * Events sent to a cached BusPtr and buses with routers connected are dispatched with the context locked.
+         * By default, the standard policy is used, which locks around all dispatches.
+         */
+        static const bool SnapshotDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -440,7 +468,7 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = typename Traits::template QueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -640,6 +668,7 @@ namespace AZ
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+            AZ::Internal::HandlerSnapshotStorage<Interface, Traits> m_snapshots;  ///< Handler snapshots used for dispatch when SnapshotDispatch is set.
 
             Context();
             Context(EBusEnvironment* environment);
@@ -653,7 +682,7 @@ namespace AZ
 
         private:
             using CallstackEntryBase = AZ::Internal::CallstackEntryBase<Interface, Traits>;
-            using CallstackEntryRoot = AZ::Internal::CallstackEntryRoot<Interface, Traits>;
+            using CallstackEntryRoot = typename AZ::Internal::HandlerSnapshotStorage<Interface, Traits>::CallstackEntryRoot;
             using CallstackEntryStorageType = AZ::Internal::EBusCallstackStorage<CallstackEntryBase, !AZStd::is_same_v<ContextMutexType, AZ::NullMutex>>;
 
             mutable AZStd::unordered_map<AZStd::native_thread_id_type, CallstackEntryRoot, AZStd::hash<AZStd::native_thread_id_type>, AZStd::equal_to<AZStd::native_thread_id_type>, AZ::Internal::EBusEnvironmentAllocator> m_callstackRoots;
@@ -661,6 +690,10 @@ namespace AZ
             AZStd::atomic_uint m_dispatches;   ///< Number of active dispatches in progress
 
             friend CallstackEntry;
+            friend AZ::Internal::SnapshotCallstackEntry<ThisType>;
+
+            static_assert(!BusTraits::SnapshotDispatch || !AZStd::is_same_v<ContextMutexType, AZ::NullMutex>,
+                "SnapshotDispatch is meant for buses used from multiple threads, it requires a MutexType or LocklessDispatch");
         };
         /// @endcond
 
@@ -706,6 +739,12 @@ namespace AZ
         static Context& GetOrCreateContext(bool trackCallstack=true);
 
         static bool IsInDispatch(Context* context = GetContext(false));
+
+        /**
+         * Waits until the dispatches in progress on other threads can't call the handlers disconnected before the call anymore.
+         * Only waits on buses with EBusTraits::SnapshotDispatch, it must be called after releasing the context mutex.
+         */
+        static void WaitForSnapshotReaders(Context* context);
         /// @cond EXCLUDE_DOCS
         struct RouterCallstackEntry
             : public CallstackEntry
@@ -992,6 +1031,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
+        context.m_snapshots.Publish(context.m_buses, context.s_callstack);
 
         BusPtr ptr;
         if constexpr (EBus::HasId)
@@ -1012,8 +1052,11 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         if (Context* context = GetContext())
         {
             // scoped lock guard in case of exception / other odd situation
-            AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
-            DisconnectInternal(*context, handler);
+            {
+                AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
+                DisconnectInternal(*context, handler);
+            }
+            WaitForSnapshotReaders(context);
         }
     }
 
@@ -1043,6 +1086,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual disconnection
         context.m_buses.Disconnect(handler);
+        context.m_snapshots.Publish(context.m_buses, context.s_callstack);
 
         if (callstack)
         {
@@ -1207,7 +1251,26 @@ AZ_POP_DISABLE_WARNING
     template<class Interface, class Traits>
     bool EBus<Interface, Traits>::IsInDispatch(Context* context)
     {
-        return context != nullptr && context->m_dispatches > 0;
+        return context != nullptr && (context->m_dispatches > 0 || context->m_snapshots.HasReaders());
+    }
+
+    //=========================================================================
+    // WaitForSnapshotReaders
+    //=========================================================================
+    template<class Interface, class Traits>
+    void EBus<Interface, Traits>::WaitForSnapshotReaders(Context* context)
+    {
+        if constexpr (Traits::SnapshotDispatch)
+        {
+            if (context)
+            {
+                context->m_snapshots.WaitForReaders(context->s_callstack);
+            }
+        }
+        else
+        {
+            AZ_UNUSED(context);
+        }
     }
 
     //=========================================================================
@@ -1263,11 +1326,15 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
-                if (BusIsConnected())
                 {
+                    AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
+                    if (!BusIsConnected())
+                    {
+                        return;
+                    }
                     BusType::DisconnectInternal(*context, m_node);
                 }
+                BusType::WaitForSnapshotReaders(context);
             }
         }
 
@@ -1297,11 +1364,15 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
-                if (BusIsConnectedId(id))
                 {
+                    AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
+                    if (!BusIsConnectedId(id))
+                    {
+                        return;
+                    }
                     BusType::DisconnectInternal(*context, m_node);
                 }
+                BusType::WaitForSnapshotReaders(context);
             }
         }
         template <typename Interface, typename Traits, typename ContainerType>
@@ -1309,11 +1380,15 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
-                if (BusIsConnected())
                 {
+                    AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
+                    if (!BusIsConnected())
+                    {
+                        return;
+                    }
                     BusType::DisconnectInternal(*context, m_node);
                 }
+                BusType::WaitForSnapshotReaders(context);
             }
         }
 
@@ -1324,11 +1399,12 @@ AZ_POP_DISABLE_WARNING
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
             typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
-            if (m_handlerNodes.find(id) == m_handlerNodes.end())
+            auto insertResult = m_handlerNodes.try_emplace(id, nullptr);
+            if (insertResult.second)
             {
                 void* handlerNodeAddr = m_handlerNodes.get_allocator().allocate(sizeof(HandlerNode), AZStd::alignment_of<HandlerNode>::value);
                 auto handlerNode = new(handlerNodeAddr) HandlerNode(this);
-                m_handlerNodes.emplace(id, AZStd::move(handlerNode));
+                insertResult.first->second = handlerNode;
                 BusType::ConnectInternal(context, *handlerNode, contextLock, id);
             }
         }
@@ -1337,16 +1413,21 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
-                auto nodeIt = m_handlerNodes.find(id);
-                if (nodeIt != m_handlerNodes.end())
                 {
+                    AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
+                    auto nodeIt = m_handlerNodes.find(id);
+                    if (nodeIt == m_handlerNodes.end())
+                    {
+                        return;
+                    }
                     HandlerNode* handlerNode = nodeIt->second;
                     BusType::DisconnectInternal(*context, *handlerNode);
-                    m_handlerNodes.erase(nodeIt);
+                    // The connection policy can connect this handler to other addresses, which can move the map's elements.
+                    m_handlerNodes.erase(id);
                     handlerNode->~HandlerNode();
                     m_handlerNodes.get_allocator().deallocate(handlerNode, sizeof(HandlerNode), alignof(HandlerNode));
                 }
+                BusType::WaitForSnapshotReaders(context);
             }
         }
         template <typename Interface, typename Traits, typename ContainerType>
@@ -1355,16 +1436,19 @@ AZ_POP_DISABLE_WARNING
             decltype(m_handlerNodes) handlerNodesToDisconnect;
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
-                handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
-
-                for (const auto& nodePair : handlerNodesToDisconnect)
                 {
-                    BusType::DisconnectInternal(*context, *nodePair.second);
+                    AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
+                    handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
+
+                    for (const auto& nodePair : handlerNodesToDisconnect)
+                    {
+                        BusType::DisconnectInternal(*context, *nodePair.second);
 
-                    nodePair.second->~HandlerNode();
-                    handlerNodesToDisconnect.get_allocator().deallocate(nodePair.second, sizeof(HandlerNode), AZStd::alignment_of<HandlerNode>::value);
+                        nodePair.second->~HandlerNode();
+                        handlerNodesToDisconnect.get_allocator().deallocate(nodePair.second, sizeof(HandlerNode), AZStd::alignment_of<HandlerNode>::value);
+                    }
                 }
+                BusType::WaitForSnapshotReaders(context);
             }
         }
 
@@ -1764,6 +1848,7 @@ AZ_POP_DISABLE_WARNING
                 {
                     AZStd::scoped_lock<decltype(context.m_contextMutex)> lock(context.m_contextMutex);
                     context.m_routing.m_routers.insert(&m_routerNode);
+                    context.m_snapshots.SetNumRouters(context.m_routing.m_routers.size());
                 }
                 m_isConnected = true;
             }
@@ -1785,6 +1870,7 @@ AZ_POP_DISABLE_WARNING
                     // on the TickBus or another safe bus.
                     AZ_Assert(context->s_callstack->m_prev == nullptr, "Current we don't allow router disconnect while in a message on the bus!");
                     context->m_routing.m_routers.erase(&m_routerNode);
+                    context->m_snapshots.SetNumRouters(context->m_routing.m_routers.size());
                 }
                 m_isConnected = false;
             }
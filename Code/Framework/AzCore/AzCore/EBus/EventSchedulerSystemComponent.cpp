@@ -21,7 +21,8 @@ namespace AZ
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
         {
             serializeContext->Class<EventSchedulerSystemComponent, Component>()
-                ->Version(1);
+                ->Version(2)
+                ->Field("QueueType", &EventSchedulerSystemComponent::m_queueType);
         }
     }
 
@@ -41,14 +42,72 @@ namespace AZ
         IEventSchedulerRequestBus::Handler::BusConnect();
     }
 
+    EventSchedulerSystemComponent::EventSchedulerSystemComponent(EventSchedulerQueueType queueType)
+        : EventSchedulerSystemComponent()
+    {
+        SetQueueType(queueType);
+    }
+
     EventSchedulerSystemComponent::~EventSchedulerSystemComponent()
     {
         IEventSchedulerRequestBus::Handler::BusDisconnect();
         Interface<IEventScheduler>::Unregister(this);
     }
 
+    void EventSchedulerSystemComponent::SetQueueType(EventSchedulerQueueType queueType)
+    {
+        m_queueType = queueType;
+        if (queueType == m_activeQueueType)
+        {
+            return;
+        }
+
+        // Gather the queued handles, due handles first so that they keep triggering ahead of the rest
+        AZStd::vector<ScheduledEventHandle*> handles;
+        if (m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+        {
+            m_timingWheel.Clear([&handles](ScheduledEventHandle* handle) { handles.push_back(handle); });
+        }
+        else
+        {
+            for (; !m_pendingQueue.empty(); m_pendingQueue.pop())
+            {
+                handles.push_back(m_pendingQueue.top());
+            }
+            for (; !m_queue.empty(); m_queue.pop())
+            {
+                handles.push_back(m_queue.top());
+            }
+        }
+
+        m_activeQueueType = queueType;
+        if (handles.empty())
+        {
+            return;
+        }
+
+        const TimeMs currentMilliseconds = GetElapsedTimeMs();
+        for (ScheduledEventHandle* handle : handles)
+        {
+            if (handle->GetScheduledEvent() == nullptr)
+            {
+                // Removed while queued in the priority queue
+                FreeHandle(handle);
+                continue;
+            }
+            QueueHandle(handle, currentMilliseconds);
+        }
+    }
+
+    EventSchedulerQueueType EventSchedulerSystemComponent::GetQueueType() const
+    {
+        return m_activeQueueType;
+    }
+
     void EventSchedulerSystemComponent::Activate()
     {
+        // Apply the serialized queue type
+        SetQueueType(m_queueType);
         TickBus::Handler::BusConnect();
     }
 
@@ -62,6 +121,18 @@ namespace AZ
         TimeMs startTime = GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
+        if (m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+        {
+            ProcessTimingWheel(startTime, usingTimeslice);
+        }
+        else
+        {
+            ProcessPriorityQueue(startTime, usingTimeslice);
+        }
+    }
+
+    void EventSchedulerSystemComponent::ProcessPriorityQueue(TimeMs startTime, bool usingTimeslice)
+    {
         while (!m_queue.empty())
         {
             ScheduledEventHandle* handle = m_queue.top();
@@ -82,6 +153,28 @@ namespace AZ
             }
             ScheduledEventHandle* handle = m_pendingQueue.top();
             m_pendingQueue.pop();
+            handle->m_isQueued = false;
+            if (!handle->Notify()) // if Notify return false, the event has been deleted and we should delete its handle.
+            {
+                FreeHandle(handle);
+            }
+        }
+    }
+
+    void EventSchedulerSystemComponent::ProcessTimingWheel(TimeMs startTime, bool usingTimeslice)
+    {
+        // Expire everything due in one batch, events queued while processing trigger on the next tick at the earliest
+        m_timingWheel.Advance(startTime);
+
+        while (m_timingWheel.GetExpiredCount() > 0)
+        {
+            if (usingTimeslice && (GetElapsedTimeMs() - startTime > bg_maxScheduledEventProcessTimeMs))
+            {
+                AZLOG_WARN("Failed to trigger all pending scheduled events, %u events remain on the pending queue", aznumeric_cast<uint32_t>(m_timingWheel.GetExpiredCount()));
+                break;
+            }
+            ScheduledEventHandle* handle = m_timingWheel.PopExpired();
+            handle->m_isQueued = false;
             if (!handle->Notify()) // if Notify return false, the event has been deleted and we should delete its handle.
             {
                 FreeHandle(handle);
@@ -103,6 +196,20 @@ namespace AZ
         }
 
         TimeMs currentMilliseconds = GetElapsedTimeMs();
+        if (timedEvent->m_handle != nullptr && timedEvent->m_handle->m_isQueued)
+        {
+            // Rescheduled while still queued, the timing wheel unlinks and reuses the handle, the priority queue can't
+            // remove it so it gets a new one and the old one is dropped when it expires
+            if (m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+            {
+                m_timingWheel.Remove(timedEvent->m_handle);
+            }
+            else
+            {
+                timedEvent->m_handle->m_event = nullptr;
+                timedEvent->m_handle = nullptr;
+            }
+        }
         if (timedEvent->m_handle == nullptr)
         {
             timedEvent->m_handle = AllocateHandle();
@@ -110,7 +217,7 @@ namespace AZ
         const bool ownsScheduledEvent = false;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        QueueHandle(timedEvent->m_handle, currentMilliseconds);
         return timedEvent->m_handle;
     }
 
@@ -126,7 +233,22 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        QueueHandle(timedEvent->m_handle, currentMilliseconds);
+    }
+
+    void EventSchedulerSystemComponent::RemoveEvent(ScheduledEventHandle* handle)
+    {
+        if (handle->m_isQueued && m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+        {
+            m_timingWheel.Remove(handle);
+            handle->m_isQueued = false;
+            handle->m_event = nullptr;
+            FreeHandle(handle);
+            return;
+        }
+
+        // Either triggering right now or in the priority queue, the handle is released once it is popped
+        handle->m_event = nullptr;
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -141,6 +263,10 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
+        if (m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+        {
+            return m_timingWheel.GetScheduledCount();
+        }
         return m_queue.size();
     }
 
@@ -188,6 +314,19 @@ namespace AZ
         return scheduledEvent;
     }
 
+    void EventSchedulerSystemComponent::QueueHandle(ScheduledEventHandle* handle, TimeMs currentTimeMs)
+    {
+        handle->m_isQueued = true;
+        if (m_activeQueueType == EventSchedulerQueueType::TimingWheel)
+        {
+            m_timingWheel.Insert(handle, currentTimeMs);
+        }
+        else
+        {
+            m_queue.push(handle);
+        }
+    }
+
     void EventSchedulerSystemComponent::FreeHandle(ScheduledEventHandle* handle)
     {
         if (handle->GetOwnsScheduledEvent())
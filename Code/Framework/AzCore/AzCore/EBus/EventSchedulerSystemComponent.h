@@ -12,6 +12,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/EBus/ScheduledEventHandle.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/EBus/ScheduledEventTimingWheel.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/queue.h>
@@ -41,6 +42,16 @@ namespace AZ
     class Name;
     class ScheduledEvent;
 
+    //! @enum EventSchedulerQueueType
+    //! Data structure the EventSchedulerSystemComponent keeps its scheduled events in.
+    enum class EventSchedulerQueueType : uint8_t
+    {
+        PriorityQueue, //< Binary heap ordered by execution time, O(log n) insertion, cancelled events stay queued until they expire
+        TimingWheel    //< Hierarchical timing wheel, O(1) insertion and cancellation, suited to large numbers of timers
+    };
+
+    AZ_TYPE_INFO_SPECIALIZE(EventSchedulerQueueType, "{5E0B7B8C-2F44-4C3E-9A61-8D2C3B7F4E19}");
+
     //! @class EventSchedulerSystemComponent
     //! @brief This is scheduled event queue class to run all scheduled events at appropriate intervals.
     class EventSchedulerSystemComponent
@@ -56,8 +67,14 @@ namespace AZ
         static void GetIncompatibleServices(ComponentDescriptor::DependencyArrayType& incompatible);
 
         EventSchedulerSystemComponent();
+        explicit EventSchedulerSystemComponent(EventSchedulerQueueType queueType);
         ~EventSchedulerSystemComponent() override;
 
+        //! Switches the data structure used to queue scheduled events, queued events are moved over.
+        //! @param queueType the type of queue to use
+        void SetQueueType(EventSchedulerQueueType queueType);
+        EventSchedulerQueueType GetQueueType() const;
+
         //! AZ::Component overrides.
         //! @{
         void Activate() override;
@@ -74,6 +91,7 @@ namespace AZ
         //! @{
         ScheduledEventHandle* AddEvent(ScheduledEvent* scheduledEvent, TimeMs durationMs) override;
         void AddCallback(const AZStd::function<void()>& callback, const Name& eventName, TimeMs durationMs) override;
+        void RemoveEvent(ScheduledEventHandle* handle) override;
         // @}
 
         //! EventSchedulerSystemComponent stats
@@ -92,12 +110,20 @@ namespace AZ
 
         void FreeHandle(ScheduledEventHandle* handle);
 
+        void QueueHandle(ScheduledEventHandle* handle, TimeMs currentTimeMs);
+        void ProcessPriorityQueue(TimeMs startTime, bool usingTimeslice);
+        void ProcessTimingWheel(TimeMs startTime, bool usingTimeslice);
+
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
         // Priority queues of scheduled events sorted by execution time
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
+        // Timing wheel of scheduled events, used instead of the priority queues for EventSchedulerQueueType::TimingWheel
+        ScheduledEventTimingWheel m_timingWheel;
+        EventSchedulerQueueType m_queueType = EventSchedulerQueueType::PriorityQueue;       //< serialized setting, applied on activation
+        EventSchedulerQueueType m_activeQueueType = EventSchedulerQueueType::PriorityQueue; //< type of the queue the events are currently in
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
         AZStd::deque<ScheduledEventHandle> m_handles;
@@ -46,6 +46,11 @@ namespace AZ
         //! @param durationMs a millisecond interval to run the scheduled callback
         virtual void AddCallback(const AZStd::function<void()>& callback, const Name& eventName, TimeMs durationMs) = 0;
 
+        //! Removes a scheduled event added with AddEvent, so that it won't trigger.
+        //! The handle is released by the IEventScheduler and must not be used afterwards.
+        //! @param handle the handle returned by AddEvent
+        virtual void RemoveEvent(ScheduledEventHandle* handle) = 0;
+
         AZ_DISABLE_COPY_MOVE(IEventScheduler);
     };
 
@@ -53,6 +53,7 @@ namespace AZ
 
             const typename Traits::BusIdType* m_busId;
             CallstackEntryBase<Interface, Traits>* m_prev = nullptr;
+            AZStd::native_thread_id_type m_threadId{};
         };
 
         // Single threaded callstack entry
@@ -65,8 +66,8 @@ namespace AZ
 
             CallstackEntry(BusContextPtr context, const typename Traits::BusIdType* busId)
                 : CallstackEntryBase<Interface, Traits>(busId)
-                , m_threadId(AZStd::this_thread::get_id().m_id)
             {
+                this->m_threadId = AZStd::this_thread::get_id().m_id;
                 EBUS_ASSERT(context, "Internal error: context deleted while execution still in progress.");
                 m_context = context;
 
@@ -74,7 +75,7 @@ namespace AZ
 
                 // We don't use the AZ_Assert macro here because it places the assert call (unlikely) before the
                 // actual work to do (likely) which results in inlining shenanigans and icache misses.
-                if (!this->m_prev || static_cast<CallstackEntry*>(this->m_prev)->m_threadId == m_threadId)
+                if (!this->m_prev || this->m_prev->m_threadId == this->m_threadId)
                 {
                     m_context->s_callstack->m_prev = this;
 
@@ -101,7 +102,6 @@ namespace AZ
             }
 
             BusContextPtr m_context = nullptr;
-            AZStd::native_thread_id_type m_threadId;
         };
 
         // One of these will be allocated per thread. It acts as the bottom of any callstack during dispatch within
@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/Environment.h>
+#include <AzCore/EBus/Policies.h>
+#include <AzCore/EBus/Internal/CallstackEntry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        // Support for EBusTraits::SnapshotDispatch (read-copy-update dispatch).
+        // Connect/disconnect build an immutable copy of the handler lists (a snapshot) under the context mutex and publish it.
+        // Dispatch reads the current snapshot without locking, it only publishes the epoch it started reading in, in a per thread
+        // record. A replaced snapshot is freed once no thread reads from an epoch older than the one it was retired in.
+
+        // Per thread callstack root, it also holds the reader record of the thread.
+        template <typename Interface, typename Traits>
+        struct SnapshotCallstackEntryRoot
+            : public CallstackEntryRoot<Interface, Traits>
+        {
+            SnapshotCallstackEntryRoot() = default;
+            // Roots are only copied when they are inserted in the context, the copy starts as an idle reader
+            SnapshotCallstackEntryRoot(const SnapshotCallstackEntryRoot&)
+                : CallstackEntryRoot<Interface, Traits>()
+            {}
+            SnapshotCallstackEntryRoot& operator=(const SnapshotCallstackEntryRoot&) = delete;
+
+            AZStd::atomic<AZ::u64> m_readEpoch{ 0 };            ///< Epoch the outermost dispatch on this thread started in, 0 when the thread doesn't dispatch.
+            AZ::u32 m_readDepth = 0;                            ///< Number of nested dispatches, only accessed by the owning thread.
+            bool m_isRegistered = false;                        ///< True once the root was added to the reader list.
+            SnapshotCallstackEntryRoot* m_nextReader = nullptr;
+            char m_padding[64];                                 ///< Keeps the reader records of different threads on different cache lines.
+        };
+
+        // Immutable copy of the handlers connected to a bus, in dispatch order.
+        template <typename Interface, typename Traits>
+        struct HandlerSnapshot
+        {
+            using BusIdType = typename Traits::BusIdType;
+
+            struct Address
+            {
+                BusIdType m_busId;
+                AZ::u32 m_firstHandler;
+                AZ::u32 m_numHandlers;
+            };
+
+            const Address* Find(const BusIdType& id) const
+            {
+                if constexpr (Traits::AddressPolicy == EBusAddressPolicy::Single)
+                {
+                    AZ_UNUSED(id);
+                    return m_addresses.empty() ? nullptr : m_addresses.data();
+                }
+                else
+                {
+                    if (m_buckets.empty())
+                    {
+                        return nullptr;
+                    }
+                    const size_t mask = m_buckets.size() - 1;
+                    for (size_t bucket = Hash(id); ; bucket = (bucket + 1) & mask)
+                    {
+                        const AZ::u32 index = m_buckets[bucket];
+                        if (index == 0)
+                        {
+                            return nullptr;
+                        }
+                        if (m_addresses[index - 1].m_busId == id)
+                        {
+                            return &m_addresses[index - 1];
+                        }
+                    }
+                }
+            }
+
+            bool Contains(const BusIdType& id, Interface* handler) const
+            {
+                if (const Address* address = Find(id))
+                {
+                    const auto first = m_handlers.begin() + address->m_firstHandler;
+                    return AZStd::find(first, first + address->m_numHandlers, handler) != first + address->m_numHandlers;
+                }
+                return false;
+            }
+
+            // Fibonacci hashing on top of AZStd::hash, which is the identity for most id types
+            size_t Hash(const BusIdType& id) const
+            {
+                return static_cast<size_t>((static_cast<AZ::u64>(AZStd::hash<BusIdType>()(id)) * 0x9E3779B97F4A7C15ull) >> m_hashShift);
+            }
+
+            void BuildBuckets()
+            {
+                size_t numBuckets = 8;
+                AZ::u32 hashShift = 61;
+                while (numBuckets < m_addresses.size() * 2)
+                {
+                    numBuckets <<= 1;
+                    --hashShift;
+                }
+                m_hashShift = hashShift;
+                m_buckets.resize(numBuckets, 0);
+                const size_t mask = numBuckets - 1;
+                for (size_t i = 0; i < m_addresses.size(); ++i)
+                {
+                    size_t bucket = Hash(m_addresses[i].m_busId);
+                    while (m_buckets[bucket] != 0)
+                    {
+                        bucket = (bucket + 1) & mask;
+                    }
+                    m_buckets[bucket] = static_cast<AZ::u32>(i + 1);
+                }
+            }
+
+            AZStd::vector<Address, EBusEnvironmentAllocator> m_addresses;
+            AZStd::vector<Interface*, EBusEnvironmentAllocator> m_handlers;
+            AZStd::vector<AZ::u32, EBusEnvironmentAllocator> m_buckets;    ///< Open addressing table of address index + 1, empty for single address buses.
+            AZ::u32 m_hashShift = 61;
+            AZ::u64 m_retiredEpoch = 0;
+            HandlerSnapshot* m_nextRetired = nullptr;
+        };
+
+        // Default storage, buses without EBusTraits::SnapshotDispatch don't keep snapshots.
+        template <typename Interface, typename Traits, bool IsEnabled = Traits::SnapshotDispatch>
+        class HandlerSnapshotStorage
+        {
+        public:
+            using CallstackEntryRoot = AZ::Internal::CallstackEntryRoot<Interface, Traits>;
+
+            template <typename BusesContainer>
+            void Publish(BusesContainer&, CallstackEntryBase<Interface, Traits>*) {}
+            void WaitForReaders(CallstackEntryBase<Interface, Traits>*) {}
+            bool HasReaders() const { return false; }
+            void SetNumRouters(size_t) {}
+        };
+
+        template <typename Interface, typename Traits>
+        class HandlerSnapshotStorage<Interface, Traits, true>
+        {
+        public:
+            using CallstackEntryRoot = SnapshotCallstackEntryRoot<Interface, Traits>;
+            using Snapshot = HandlerSnapshot<Interface, Traits>;
+
+            HandlerSnapshotStorage() = default;
+            HandlerSnapshotStorage(const HandlerSnapshotStorage&) = delete;
+            HandlerSnapshotStorage& operator=(const HandlerSnapshotStorage&) = delete;
+
+            ~HandlerSnapshotStorage()
+            {
+                Destroy(m_snapshot.load());
+                while (m_retired)
+                {
+                    Snapshot* retired = m_retired;
+                    m_retired = retired->m_nextRetired;
+                    Destroy(retired);
+                }
+            }
+
+            //! Starts a dispatch on the calling thread and returns the snapshot to dispatch from. It stays valid until the matching \ref EndRead.
+            const Snapshot* BeginRead(CallstackEntryRoot& root)
+            {
+                if (root.m_readDepth++ == 0)
+                {
+                    if (!root.m_isRegistered)
+                    {
+                        Register(root);
+                    }
+                    // Sequentially consistent, a writer either sees this thread reading or the snapshot load below sees its new snapshot
+                    root.m_readEpoch.store(m_epoch.load());
+                }
+                return m_snapshot.load();
+            }
+
+            void EndRead(CallstackEntryRoot& root)
+            {
+                if (--root.m_readDepth == 0)
+                {
+                    root.m_readEpoch.store(0, AZStd::memory_order_release);
+                }
+            }
+
+            //! Returns true if the handler is connected to the address in the latest snapshot, only valid between BeginRead and EndRead.
+            bool IsConnected(const typename Traits::BusIdType& id, Interface* handler) const
+            {
+                const Snapshot* snapshot = m_snapshot.load(AZStd::memory_order_acquire);
+                return snapshot && snapshot->Contains(id, handler);
+            }
+
+            //! Publishes a new snapshot of the handlers, must be called with the context mutex held.
+            template <typename BusesContainer>
+            void Publish(BusesContainer& buses, CallstackEntryBase<Interface, Traits>* callstackRoot)
+            {
+                Snapshot* previous = m_snapshot.exchange(Build(buses));
+                if (previous)
+                {
+                    // Readers that start in this epoch or later can't see the previous snapshot anymore
+                    previous->m_retiredEpoch = m_epoch.fetch_add(1) + 1;
+                    previous->m_nextRetired = m_retired;
+                    m_retired = previous;
+                }
+                Reclaim(static_cast<CallstackEntryRoot*>(callstackRoot));
+            }
+
+            //! Waits until no other thread dispatches from a snapshot published before the call, must be called without holding the context mutex.
+            //! Doesn't wait when the calling thread is dispatching on the bus itself, as two threads doing it would wait on each other.
+            void WaitForReaders(CallstackEntryBase<Interface, Traits>* callstackRoot)
+            {
+                const CallstackEntryRoot* self = static_cast<CallstackEntryRoot*>(callstackRoot);
+                if (self && self->m_readDepth > 0)
+                {
+                    return;
+                }
+
+                const AZ::u64 epoch = m_epoch.load();
+                for (const CallstackEntryRoot* reader = m_readers.load(); reader; reader = reader->m_nextReader)
+                {
+                    if (reader == self)
+                    {
+                        continue;
+                    }
+                    for (AZ::u64 readEpoch = reader->m_readEpoch.load(); readEpoch != 0 && readEpoch < epoch; readEpoch = reader->m_readEpoch.load())
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+            }
+
+            bool HasReaders() const
+            {
+                for (const CallstackEntryRoot* reader = m_readers.load(); reader; reader = reader->m_nextReader)
+                {
+                    if (reader->m_readEpoch.load() != 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            //! Mirrors the number of routers connected to the bus, must be called with the context mutex held.
+            void SetNumRouters(size_t numRouters)
+            {
+                m_numRouters.store(numRouters, AZStd::memory_order_release);
+            }
+
+            //! Returns true if routers are connected, dispatch reads it without locking the context mutex.
+            bool HasRouters() const
+            {
+                return m_numRouters.load(AZStd::memory_order_acquire) != 0;
+            }
+
+        private:
+            void Register(CallstackEntryRoot& root)
+            {
+                root.m_isRegistered = true;
+                CallstackEntryRoot* head = m_readers.load();
+                do
+                {
+                    root.m_nextReader = head;
+                } while (!m_readers.compare_exchange_weak(head, &root));
+            }
+
+            // Frees the retired snapshots no thread can read anymore
+            void Reclaim(const CallstackEntryRoot* self)
+            {
+                // A dispatch in progress on this thread may still iterate a snapshot retired by one of its handlers
+                if (self && self->m_readDepth > 0)
+                {
+                    return;
+                }
+
+                AZ::u64 oldestReadEpoch = AZStd::numeric_limits<AZ::u64>::max();
+                for (const CallstackEntryRoot* reader = m_readers.load(); reader; reader = reader->m_nextReader)
+                {
+                    const AZ::u64 readEpoch = reader->m_readEpoch.load();
+                    if (readEpoch != 0 && readEpoch < oldestReadEpoch)
+                    {
+                        oldestReadEpoch = readEpoch;
+                    }
+                }
+
+                Snapshot** link = &m_retired;
+                while (*link)
+                {
+                    Snapshot* retired = *link;
+                    if (retired->m_retiredEpoch <= oldestReadEpoch)
+                    {
+                        *link = retired->m_nextRetired;
+                        Destroy(retired);
+                    }
+                    else
+                    {
+                        link = &retired->m_nextRetired;
+                    }
+                }
+            }
+
+            template <typename BusesContainer>
+            static Snapshot* Build(BusesContainer& buses)
+            {
+                Snapshot* snapshot = new (EBusEnvironmentAllocator().allocate(sizeof(Snapshot), alignof(Snapshot))) Snapshot();
+                auto addAddress = [snapshot](const typename Traits::BusIdType& id, size_t firstHandler)
+                {
+                    if (snapshot->m_handlers.size() > firstHandler)
+                    {
+                        snapshot->m_addresses.push_back({ id, static_cast<AZ::u32>(firstHandler), static_cast<AZ::u32>(snapshot->m_handlers.size() - firstHandler) });
+                    }
+                };
+
+                if constexpr (Traits::AddressPolicy == EBusAddressPolicy::Single)
+                {
+                    if constexpr (Traits::HandlerPolicy == EBusHandlerPolicy::Single)
+                    {
+                        if (buses.m_handler)
+                        {
+                            snapshot->m_handlers.push_back(buses.m_handler);
+                        }
+                    }
+                    else
+                    {
+                        for (auto& handler : buses.m_handlers)
+                        {
+                            snapshot->m_handlers.push_back(handler);
+                        }
+                    }
+                    addAddress(typename Traits::BusIdType(), 0);
+                }
+                else
+                {
+                    for (auto& holder : buses.m_addresses)
+                    {
+                        const size_t firstHandler = snapshot->m_handlers.size();
+                        if constexpr (Traits::HandlerPolicy == EBusHandlerPolicy::Single)
+                        {
+                            if (holder.m_interface)
+                            {
+                                snapshot->m_handlers.push_back(holder.m_interface);
+                            }
+                        }
+                        else
+                        {
+                            for (auto& handler : holder.m_handlers)
+                            {
+                                snapshot->m_handlers.push_back(handler);
+                            }
+                        }
+                        addAddress(holder.m_busId, firstHandler);
+                    }
+                    snapshot->BuildBuckets();
+                }
+                return snapshot;
+            }
+
+            static void Destroy(Snapshot* snapshot)
+            {
+                if (snapshot)
+                {
+                    snapshot->~Snapshot();
+                    EBusEnvironmentAllocator().deallocate(snapshot, sizeof(Snapshot), alignof(Snapshot));
+                }
+            }
+
+            AZStd::atomic<Snapshot*> m_snapshot{ nullptr };
+            AZStd::atomic<AZ::u64> m_epoch{ 1 };
+            AZStd::atomic<CallstackEntryRoot*> m_readers{ nullptr };   ///< Threads which dispatched on the bus, roots are never removed while the context lives.
+            AZStd::atomic_size_t m_numRouters{ 0 };                     ///< Copy of the router count, the router container is only safe to read with the context mutex held.
+            Snapshot* m_retired = nullptr;                              ///< Replaced snapshots, only accessed with the context mutex held.
+        };
+
+        // Callstack entry of a snapshot dispatch, it keeps the snapshot alive and skips the handlers disconnected during the dispatch.
+        template <typename Bus>
+        class SnapshotCallstackEntry
+            : public CallstackEntryBase<typename Bus::InterfaceType, typename Bus::Traits>
+        {
+            using Base = CallstackEntryBase<typename Bus::InterfaceType, typename Bus::Traits>;
+            using Interface = typename Bus::InterfaceType;
+            using Traits = typename Bus::Traits;
+            using Storage = HandlerSnapshotStorage<Interface, Traits>;
+            using CallstackEntryRoot = typename Storage::CallstackEntryRoot;
+
+        public:
+            using Snapshot = typename Storage::Snapshot;
+            using Address = typename Snapshot::Address;
+
+            explicit SnapshotCallstackEntry(typename Bus::Context& context)
+                : Base(nullptr)
+                , m_storage(context.m_snapshots)
+                , m_root(static_cast<CallstackEntryRoot&>(*context.s_callstack))
+            {
+                this->m_threadId = AZStd::this_thread::get_id().m_id;
+                m_snapshot = m_storage.BeginRead(m_root);
+                this->m_prev = m_root.m_prev;
+                m_root.m_prev = this;
+            }
+
+            ~SnapshotCallstackEntry() override
+            {
+                m_root.m_prev = this->m_prev;
+                m_storage.EndRead(m_root);
+            }
+
+            SnapshotCallstackEntry(const SnapshotCallstackEntry&) = delete;
+            SnapshotCallstackEntry& operator=(const SnapshotCallstackEntry&) = delete;
+
+            void OnRemoveHandler(Interface* handler) override
+            {
+                m_handlersRemoved = true;
+                Base::OnRemoveHandler(handler);
+            }
+
+            const Snapshot* GetSnapshot() const { return m_snapshot; }
+
+            template <bool IsReverse, typename Callback>
+            void Dispatch(const Address& address, Callback& callback)
+            {
+                if constexpr (Bus::HasId)
+                {
+                    this->m_busId = &address.m_busId;
+                }
+                Interface* const* handlers = m_snapshot->m_handlers.data() + address.m_firstHandler;
+                for (AZ::u32 i = 0; i < address.m_numHandlers; ++i)
+                {
+                    Interface* handler = handlers[IsReverse ? address.m_numHandlers - 1 - i : i];
+                    // Handlers disconnected by this thread during the dispatch are still in our snapshot, they may not be alive anymore
+                    if (!m_handlersRemoved || m_storage.IsConnected(address.m_busId, handler))
+                    {
+                        callback(handler);
+                    }
+                }
+            }
+
+        private:
+            Storage& m_storage;
+            CallstackEntryRoot& m_root;
+            const Snapshot* m_snapshot = nullptr;
+            bool m_handlersRemoved = false;
+        };
+
+        // Dispatcher of the buses with EBusTraits::SnapshotDispatch, replaces the Event*/Broadcast* functions of the container dispatcher.
+        // Events sent to a cached BusPtr and buses with routers connected use the container dispatcher.
+        template <typename Bus, typename ImplTraits, typename ContainerDispatcher, bool HasId = ImplTraits::HasId>
+        struct SnapshotDispatcher
+            : public ContainerDispatcher
+        {
+            using Interface = typename ImplTraits::InterfaceType;
+            using Traits = typename ImplTraits::Traits;
+
+            // Broadcast family
+            template <typename Function, typename... ArgsT>
+            static void Broadcast(Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::Broadcast(AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); };
+                    DispatchAll<false>(*context, callback);
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::BroadcastResult(results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); };
+                    DispatchAll<false>(*context, callback);
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void BroadcastReverse(Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::BroadcastReverse(AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); };
+                    DispatchAll<true>(*context, callback);
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::BroadcastResultReverse(results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); };
+                    DispatchAll<true>(*context, callback);
+                }
+            }
+
+        protected:
+            template <bool IsReverse, typename Context, typename Callback>
+            static void DispatchAll(Context& context, Callback& callback)
+            {
+                SnapshotCallstackEntry<Bus> entry(context);
+                if (const auto* snapshot = entry.GetSnapshot())
+                {
+                    const size_t numAddresses = snapshot->m_addresses.size();
+                    for (size_t i = 0; i < numAddresses; ++i)
+                    {
+                        entry.template Dispatch<IsReverse>(snapshot->m_addresses[IsReverse ? numAddresses - 1 - i : i], callback);
+                    }
+                }
+            }
+
+            template <bool IsReverse, typename Context, typename Callback>
+            static void DispatchId(Context& context, const typename Traits::BusIdType& id, Callback& callback)
+            {
+                SnapshotCallstackEntry<Bus> entry(context);
+                if (const auto* snapshot = entry.GetSnapshot())
+                {
+                    if (const auto* address = snapshot->Find(id))
+                    {
+                        entry.template Dispatch<IsReverse>(*address, callback);
+                    }
+                }
+            }
+        };
+
+        template <typename Bus, typename ImplTraits, typename ContainerDispatcher>
+        struct SnapshotDispatcher<Bus, ImplTraits, ContainerDispatcher, true>
+            : public SnapshotDispatcher<Bus, ImplTraits, ContainerDispatcher, false>
+        {
+            using Base = SnapshotDispatcher<Bus, ImplTraits, ContainerDispatcher, false>;
+            using Interface = typename Base::Interface;
+            using Traits = typename Base::Traits;
+            using IdType = typename Traits::BusIdType;
+
+            // The BusPtr overloads use the container dispatcher
+            using ContainerDispatcher::Event;
+            using ContainerDispatcher::EventResult;
+            using ContainerDispatcher::EventReverse;
+            using ContainerDispatcher::EventResultReverse;
+
+            // Event family
+            template <typename Function, typename... ArgsT>
+            static void Event(const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::Event(id, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); };
+                    Base::template DispatchId<false>(*context, id, callback);
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResult(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::EventResult(results, id, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); };
+                    Base::template DispatchId<false>(*context, id, callback);
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void EventReverse(const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::EventReverse(id, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); };
+                    Base::template DispatchId<true>(*context, id, callback);
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResultReverse(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    if (context->m_snapshots.HasRouters())
+                    {
+                        ContainerDispatcher::EventResultReverse(results, id, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                        return;
+                    }
+                    auto callback = [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); };
+                    Base::template DispatchId<true>(*context, id, callback);
+                }
+            }
+        };
+    }
+}
@@ -10,6 +10,7 @@
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
 
+#include <AzCore/std/containers/flat_unordered_map.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/typetraits/is_polymorphic.h>
 
@@ -364,7 +365,7 @@ AZ_POP_DISABLE_WARNING
             }
 
         private:
-            AZStd::unordered_map<IdType, HandlerNode*, AZStd::hash<IdType>, AZStd::equal_to<IdType>, typename Traits::AllocatorType> m_handlerNodes;
+            AZStd::flat_unordered_map<IdType, HandlerNode*, AZStd::hash<IdType>, AZStd::equal_to<IdType>, typename Traits::AllocatorType> m_handlerNodes;
         };
     } // namespace Internal
 } // namespace AZ
@@ -17,12 +17,15 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
 
 namespace AZ
 {
+    struct NullMutex;
+
     /**
      * Defines how many addresses exist on the EBus.
      */
@@ -226,6 +229,8 @@ namespace AZ
     struct EBusQueuePolicy
     {
         typedef AZ::Internal::NullBusMessageCall BusMessageCall;
+        template <class Function>
+        void Push(Function&&) {};
         void Execute() {};
         void Clear() {};
         void SetActive(bool /*isActive*/) {};
@@ -247,6 +252,13 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        template <class Function>
+        void Push(Function&& function)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Function>(function), typename Bus::AllocatorType()));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
@@ -304,6 +316,298 @@ namespace AZ
         }
     };
 
+    /**
+     * Event queue policy for buses queueing a lot of events, possibly from many threads. Select it with
+     * AZ::EBusTraits::QueuePolicy.
+     * Instead of wrapping each queued call in an AZStd::function (which allocates its arguments) in one locked queue,
+     * calls are packed with their arguments in a command stream of chunks, which are recycled once executed. Once
+     * the queue has warmed up, queueing doesn't allocate.
+     * Producer threads are spread over several lanes with their own lock and chunks, so they don't contend with each
+     * other.
+     * \ref Execute drains all the lanes in one pass.
+     * \note The calls queued from one thread are executed in order, the order of calls queued from different
+     * threads is not defined.
+     */
+    template <bool IsEnabled, class Bus, class MutexType>
+    struct EBusCommandQueuePolicy
+        : public EBusQueuePolicy<false, Bus, MutexType>
+    {
+    };
+
+    template <class Bus, class MutexType>
+    struct EBusCommandQueuePolicy<true, Bus, MutexType>
+    {
+        static constexpr size_t CommandAlignment = 16;
+        static constexpr size_t ChunkSize = 16 * 1024;
+        static constexpr size_t MaxFreeChunks = 32;
+        static constexpr size_t NumLanes = AZStd::is_same<MutexType, NullMutex>::value ? 1 : 8;
+
+        /// Header of a queued call, the call object follows it.
+        struct alignas(CommandAlignment) Command
+        {
+            void (*m_execute)(Command* command, bool isInvoke); ///< Invokes the call if isInvoke is true and destroys it.
+            AZ::u32 m_size;                                     ///< Size of the command including the call.
+        };
+        typedef Command BusMessageCall;
+
+        struct alignas(CommandAlignment) Chunk
+        {
+            Chunk* m_next;
+            size_t m_capacity;
+            size_t m_used;
+        };
+
+        /// Lanes are written by different threads, keep them on different cache lines.
+        struct alignas(64) Lane
+        {
+            MutexType m_mutex;
+            Chunk* m_head = nullptr;
+            Chunk* m_tail = nullptr;
+            size_t m_count = 0;
+        };
+
+        EBusCommandQueuePolicy() = default;
+        EBusCommandQueuePolicy(const EBusCommandQueuePolicy&) = delete;
+        EBusCommandQueuePolicy& operator=(const EBusCommandQueuePolicy&) = delete;
+
+        ~EBusCommandQueuePolicy()
+        {
+            Clear();
+            while (m_freeChunks)
+            {
+                Chunk* chunk = m_freeChunks;
+                m_freeChunks = chunk->m_next;
+                FreeChunk(chunk);
+            }
+        }
+
+        bool                        m_isActive = Bus::Traits::EventQueueingActiveByDefault;
+        Lane                        m_lanes[NumLanes];
+        MutexType                   m_freeChunksMutex;
+        Chunk*                      m_freeChunks = nullptr;
+        size_t                      m_numFreeChunks = 0;
+
+        template <class Function>
+        void Push(Function&& function)
+        {
+            using CallType = AZStd::decay_t<Function>;
+            static_assert(alignof(CallType) <= CommandAlignment, "Queued call is over aligned");
+            constexpr size_t commandSize = AZ_SIZE_ALIGN_UP(sizeof(Command) + sizeof(CallType), CommandAlignment);
+
+            Lane& lane = GetLane();
+            AZStd::lock_guard<MutexType> lock(lane.m_mutex);
+            if (!lane.m_tail || lane.m_tail->m_capacity - lane.m_tail->m_used < commandSize)
+            {
+                Chunk* chunk = AcquireChunk(commandSize);
+                if (lane.m_tail)
+                {
+                    lane.m_tail->m_next = chunk;
+                }
+                else
+                {
+                    lane.m_head = chunk;
+                }
+                lane.m_tail = chunk;
+            }
+
+            Command* command = reinterpret_cast<Command*>(GetChunkData(lane.m_tail) + lane.m_tail->m_used);
+            new (command + 1) CallType(AZStd::forward<Function>(function));
+            command->m_execute = &ExecuteCommand<CallType>;
+            command->m_size = static_cast<AZ::u32>(commandSize);
+            lane.m_tail->m_used += commandSize;
+            ++lane.m_count;
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+            // calls can queue new calls, drain until the queue is empty
+            while (ProcessLanes(true))
+            {
+            }
+        }
+
+        void Clear()
+        {
+            ProcessLanes(false);
+        }
+
+        void SetActive(bool isActive)
+        {
+            // switch with all the lanes locked, so no call is queued on a lane after it was cleared
+            Chunk* chunks[NumLanes];
+            for (Lane& lane : m_lanes)
+            {
+                lane.m_mutex.lock();
+            }
+            m_isActive = isActive;
+            for (size_t laneIndex = 0; laneIndex < NumLanes; ++laneIndex)
+            {
+                chunks[laneIndex] = isActive ? nullptr : TakeLane(m_lanes[laneIndex]);
+            }
+            for (Lane& lane : m_lanes)
+            {
+                lane.m_mutex.unlock();
+            }
+            ProcessChunks(chunks, false);
+        };
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            size_t count = 0;
+            for (Lane& lane : m_lanes)
+            {
+                AZStd::lock_guard<MutexType> lock(lane.m_mutex);
+                count += lane.m_count;
+            }
+            return count;
+        }
+
+    private:
+        template <class CallType>
+        static void ExecuteCommand(Command* command, bool isInvoke)
+        {
+            CallType* call = reinterpret_cast<CallType*>(command + 1);
+            if (isInvoke)
+            {
+                (*call)();
+            }
+            call->~CallType();
+        }
+
+        static char* GetChunkData(Chunk* chunk)
+        {
+            return reinterpret_cast<char*>(chunk + 1);
+        }
+
+        Lane& GetLane()
+        {
+            if constexpr (NumLanes == 1)
+            {
+                return m_lanes[0];
+            }
+            else
+            {
+                // a thread always uses the same lane, so its calls are executed in order
+                const AZ::u64 threadHash = static_cast<AZ::u64>(AZStd::hash<AZStd::thread_id>()(AZStd::this_thread::get_id())) * 0x9E3779B97F4A7C15ull;
+                return m_lanes[(threadHash >> 32) % NumLanes];
+            }
+        }
+
+        Chunk* AcquireChunk(size_t commandSize)
+        {
+            Chunk* chunk = nullptr;
+            if (commandSize <= ChunkSize)
+            {
+                {
+                    AZStd::lock_guard<MutexType> lock(m_freeChunksMutex);
+                    chunk = m_freeChunks;
+                    if (chunk)
+                    {
+                        m_freeChunks = chunk->m_next;
+                        --m_numFreeChunks;
+                    }
+                }
+                if (!chunk)
+                {
+                    chunk = AllocateChunk(ChunkSize);
+                }
+            }
+            else
+            {
+                // big calls get their own chunk, which is not recycled
+                chunk = AllocateChunk(commandSize);
+            }
+            chunk->m_next = nullptr;
+            chunk->m_used = 0;
+            return chunk;
+        }
+
+        void ReleaseChunk(Chunk* chunk)
+        {
+            if (chunk->m_capacity == ChunkSize)
+            {
+                AZStd::lock_guard<MutexType> lock(m_freeChunksMutex);
+                if (m_numFreeChunks < MaxFreeChunks)
+                {
+                    chunk->m_next = m_freeChunks;
+                    m_freeChunks = chunk;
+                    ++m_numFreeChunks;
+                    return;
+                }
+            }
+            FreeChunk(chunk);
+        }
+
+        static Chunk* AllocateChunk(size_t capacity)
+        {
+            typename Bus::AllocatorType allocator;
+            Chunk* chunk = reinterpret_cast<Chunk*>(allocator.allocate(sizeof(Chunk) + capacity, alignof(Chunk)));
+            chunk->m_capacity = capacity;
+            return chunk;
+        }
+
+        static void FreeChunk(Chunk* chunk)
+        {
+            typename Bus::AllocatorType allocator;
+            allocator.deallocate(chunk, sizeof(Chunk) + chunk->m_capacity, alignof(Chunk));
+        }
+
+        /// Takes the queued calls of all lanes and executes (or just destroys) them. Returns false if the queue was empty.
+        bool ProcessLanes(bool isInvoke)
+        {
+            Chunk* chunks[NumLanes];
+            bool hasCalls = false;
+            for (size_t laneIndex = 0; laneIndex < NumLanes; ++laneIndex)
+            {
+                Lane& lane = m_lanes[laneIndex];
+                AZStd::lock_guard<MutexType> lock(lane.m_mutex);
+                chunks[laneIndex] = TakeLane(lane);
+                hasCalls |= chunks[laneIndex] != nullptr;
+            }
+
+            // the taken chunks are owned by this call, the lanes can be filled again while the calls are executed
+            ProcessChunks(chunks, isInvoke);
+            return hasCalls;
+        }
+
+        /// Detaches the queued calls of a lane, the lane mutex must be held.
+        static Chunk* TakeLane(Lane& lane)
+        {
+            Chunk* chunks = lane.m_head;
+            lane.m_head = nullptr;
+            lane.m_tail = nullptr;
+            lane.m_count = 0;
+            return chunks;
+        }
+
+        /// Executes (or just destroys) the calls of chunks taken from the lanes and recycles the chunks.
+        void ProcessChunks(Chunk* (&chunks)[NumLanes], bool isInvoke)
+        {
+            for (Chunk* chunk : chunks)
+            {
+                while (chunk)
+                {
+                    char* data = GetChunkData(chunk);
+                    for (size_t offset = 0; offset < chunk->m_used;)
+                    {
+                        Command* command = reinterpret_cast<Command*>(data + offset);
+                        offset += command->m_size;
+                        command->m_execute(command, isInvoke);
+                    }
+                    Chunk* next = chunk->m_next;
+                    ReleaseChunk(chunk);
+                    chunk = next;
+                }
+            }
+        }
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
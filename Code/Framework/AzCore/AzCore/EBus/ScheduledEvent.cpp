@@ -59,6 +59,15 @@ namespace AZ
 
     void ScheduledEvent::RemoveFromQueue()
     {
+        if (m_handle != nullptr)
+        {
+            // Let the scheduler drop the handle, so that it never calls back into this event
+            IEventScheduler* eventScheduler = Interface<IEventScheduler>::Get();
+            if (eventScheduler)
+            {
+                eventScheduler->RemoveEvent(m_handle);
+            }
+        }
         ClearHandle();
         m_autoRequeue = false; // In the case that someone is removing an event that's auto queued inside a notify we don't want to re-queue that event.
     }
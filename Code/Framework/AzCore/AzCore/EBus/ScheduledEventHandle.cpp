@@ -33,8 +33,8 @@ namespace AZ
             {
                 m_event->Notify();
 
-                // Check whether or not the event was deleted during the callback
-                if (m_event != nullptr)
+                // Check whether or not the event was deleted or requeued during the callback
+                if (m_event != nullptr && !m_isQueued)
                 {
                     if (m_event->m_autoRequeue)
                     {
@@ -52,7 +52,7 @@ namespace AZ
                 AZLOG_WARN("ScheduledEventHandle event pointer doesn't match to the pointer of handle to the event.");
             }
         }
-        return false; // Event has been deleted, so the handle class must be deleted after this function.
+        return m_isQueued; // If not requeued, the event has been deleted, so the handle class must be deleted after this function.
     }
 
     TimeMs ScheduledEventHandle::GetExecuteTimeMs() const
@@ -74,4 +74,9 @@ namespace AZ
     {
         return m_event;
     }
+
+    bool ScheduledEventHandle::IsQueued() const
+    {
+        return m_isQueued;
+    }
 }
@@ -12,6 +12,7 @@
 namespace AZ
 {
     class ScheduledEvent;
+    struct ScheduledEventHandleList;
 
     //! @struct ScheduledEventHandle
     //! This is a handle class that wraps a scheduled event.
@@ -54,12 +55,26 @@ namespace AZ
         //! @return the scheduled event instance bound to this event handle
         ScheduledEvent* GetScheduledEvent() const;
 
+        //! Gets whether or not the event handle is waiting in the scheduler queue.
+        //! @return false once the handle has been popped for execution
+        bool IsQueued() const;
+
     private:
 
         TimeMs m_executeTimeMs = TimeMs{ 0 }; //< execution time of the scheduled event
         TimeMs m_durationMs = TimeMs{ 0 };    //< interval time of the scheduled event
         ScheduledEvent* m_event = nullptr;    //< pointer to the scheduled event
         bool m_ownsScheduledEvent = false;    //< if the handle manages the memory of its own event
+        bool m_isQueued = false;              //< if the handle is waiting in the scheduler queue
+
+        // Intrusive links used by ScheduledEventTimingWheel, so that handles can be unlinked in constant time
+        ScheduledEventHandle* m_prev = nullptr;
+        ScheduledEventHandle* m_next = nullptr;
+        ScheduledEventHandleList* m_list = nullptr;
+
+        friend class EventSchedulerSystemComponent;
+        friend class ScheduledEventTimingWheel;
+        friend struct ScheduledEventHandleList;
     };
 }
 
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/ScheduledEventTimingWheel.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AZ
+{
+    void ScheduledEventHandleList::PushBack(ScheduledEventHandle* handle)
+    {
+        AZ_Assert(handle->m_list == nullptr, "Scheduled event handle is already in a list");
+        handle->m_prev = m_tail;
+        handle->m_next = nullptr;
+        handle->m_list = this;
+        if (m_tail != nullptr)
+        {
+            m_tail->m_next = handle;
+        }
+        else
+        {
+            m_head = handle;
+        }
+        m_tail = handle;
+        ++m_size;
+    }
+
+    ScheduledEventHandle* ScheduledEventHandleList::PopFront()
+    {
+        ScheduledEventHandle* handle = m_head;
+        if (handle != nullptr)
+        {
+            Remove(handle);
+        }
+        return handle;
+    }
+
+    void ScheduledEventHandleList::Remove(ScheduledEventHandle* handle)
+    {
+        AZ_Assert(handle->m_list == this, "Scheduled event handle is not in this list");
+        if (handle->m_prev != nullptr)
+        {
+            handle->m_prev->m_next = handle->m_next;
+        }
+        else
+        {
+            m_head = handle->m_next;
+        }
+        if (handle->m_next != nullptr)
+        {
+            handle->m_next->m_prev = handle->m_prev;
+        }
+        else
+        {
+            m_tail = handle->m_prev;
+        }
+        handle->m_prev = nullptr;
+        handle->m_next = nullptr;
+        handle->m_list = nullptr;
+        --m_size;
+    }
+
+    void ScheduledEventHandleList::Splice(ScheduledEventHandleList& other)
+    {
+        if (other.m_head == nullptr)
+        {
+            return;
+        }
+        for (ScheduledEventHandle* handle = other.m_head; handle != nullptr; handle = handle->m_next)
+        {
+            handle->m_list = this;
+        }
+        if (m_tail != nullptr)
+        {
+            m_tail->m_next = other.m_head;
+            other.m_head->m_prev = m_tail;
+        }
+        else
+        {
+            m_head = other.m_head;
+        }
+        m_tail = other.m_tail;
+        m_size += other.m_size;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    void ScheduledEventTimingWheel::Insert(ScheduledEventHandle* handle, TimeMs currentTimeMs)
+    {
+        // Nothing is waiting in the wheel, catch up with the current time so that the handle is placed relative to it
+        if (GetSlottedCount() == 0 && static_cast<int64_t>(currentTimeMs) > m_currentTimeMs)
+        {
+            m_currentTimeMs = static_cast<int64_t>(currentTimeMs);
+        }
+
+        if (static_cast<int64_t>(handle->GetExecuteTimeMs()) <= m_currentTimeMs)
+        {
+            m_due.PushBack(handle);
+        }
+        else
+        {
+            InsertIntoSlot(handle);
+        }
+    }
+
+    void ScheduledEventTimingWheel::Remove(ScheduledEventHandle* handle)
+    {
+        ScheduledEventHandleList* list = handle->m_list;
+        if (list == nullptr)
+        {
+            return;
+        }
+        list->Remove(handle);
+        if (list != &m_due && list != &m_expired)
+        {
+            --m_levelCounts[(list - &m_slots[0][0]) / SlotCount];
+        }
+    }
+
+    void ScheduledEventTimingWheel::Advance(TimeMs currentTimeMs)
+    {
+        m_expired.Splice(m_due);
+
+        const int64_t targetTimeMs = static_cast<int64_t>(currentTimeMs);
+        while (m_currentTimeMs < targetTimeMs)
+        {
+            // Nothing can expire before the next wrap of the lowest non-empty level, jump to it
+            uint32_t emptyLevels = 0;
+            while (emptyLevels < LevelCount && m_levelCounts[emptyLevels] == 0)
+            {
+                ++emptyLevels;
+            }
+            if (emptyLevels == LevelCount)
+            {
+                m_currentTimeMs = targetTimeMs;
+                break;
+            }
+            if (emptyLevels > 0)
+            {
+                const int64_t lastTimeBeforeWrap = m_currentTimeMs | ((int64_t{ 1 } << (SlotBits * emptyLevels)) - 1);
+                if (lastTimeBeforeWrap >= targetTimeMs)
+                {
+                    m_currentTimeMs = targetTimeMs;
+                    break;
+                }
+                m_currentTimeMs = lastTimeBeforeWrap;
+            }
+
+            ++m_currentTimeMs;
+            const uint64_t time = static_cast<uint64_t>(m_currentTimeMs);
+
+            // Once a level wraps around, redistribute the next slot of the level above, starting with the highest wrapped level
+            uint32_t wrappedLevels = 0;
+            while (wrappedLevels + 1 < LevelCount && (time & ((uint64_t{ 1 } << (SlotBits * (wrappedLevels + 1))) - 1)) == 0)
+            {
+                ++wrappedLevels;
+            }
+            for (uint32_t level = wrappedLevels; level > 0; --level)
+            {
+                Cascade(level);
+            }
+
+            ScheduledEventHandleList& slot = m_slots[0][time & (SlotCount - 1)];
+            m_levelCounts[0] -= slot.m_size;
+            m_expired.Splice(slot);
+        }
+    }
+
+    ScheduledEventHandle* ScheduledEventTimingWheel::PopExpired()
+    {
+        return m_expired.PopFront();
+    }
+
+    AZStd::size_t ScheduledEventTimingWheel::GetScheduledCount() const
+    {
+        return GetSlottedCount() + m_due.m_size;
+    }
+
+    AZStd::size_t ScheduledEventTimingWheel::GetSlottedCount() const
+    {
+        AZStd::size_t count = 0;
+        for (AZStd::size_t levelCount : m_levelCounts)
+        {
+            count += levelCount;
+        }
+        return count;
+    }
+
+    AZStd::size_t ScheduledEventTimingWheel::GetExpiredCount() const
+    {
+        return m_expired.m_size;
+    }
+
+    void ScheduledEventTimingWheel::InsertIntoSlot(ScheduledEventHandle* handle)
+    {
+        const uint64_t executeTime = static_cast<uint64_t>(static_cast<int64_t>(handle->GetExecuteTimeMs()));
+        const uint64_t delta = executeTime - static_cast<uint64_t>(m_currentTimeMs);
+
+        uint32_t level = 0;
+        while (level + 1 < LevelCount && delta >= (uint64_t{ 1 } << (SlotBits * (level + 1))))
+        {
+            ++level;
+        }
+
+        // Past the range of the last level, park the handle in the furthest slot, it is re-inserted when the wheel gets there
+        const uint64_t maxDelta = (uint64_t{ 1 } << (SlotBits * LevelCount)) - 1;
+        const uint64_t slotTime = (delta > maxDelta) ? static_cast<uint64_t>(m_currentTimeMs) + maxDelta : executeTime;
+        m_slots[level][(slotTime >> (SlotBits * level)) & (SlotCount - 1)].PushBack(handle);
+        ++m_levelCounts[level];
+    }
+
+    void ScheduledEventTimingWheel::Cascade(uint32_t level)
+    {
+        const uint64_t time = static_cast<uint64_t>(m_currentTimeMs);
+        ScheduledEventHandleList& slot = m_slots[level][(time >> (SlotBits * level)) & (SlotCount - 1)];
+        while (ScheduledEventHandle* handle = slot.PopFront())
+        {
+            --m_levelCounts[level];
+            if (static_cast<int64_t>(handle->GetExecuteTimeMs()) <= m_currentTimeMs)
+            {
+                m_expired.PushBack(handle);
+            }
+            else
+            {
+                InsertIntoSlot(handle);
+            }
+        }
+    }
+}
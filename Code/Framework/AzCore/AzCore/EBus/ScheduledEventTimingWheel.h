@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEventHandle.h>
+
+namespace AZ
+{
+    //! @struct ScheduledEventHandleList
+    //! Intrusive FIFO list of scheduled event handles, linked through the handles themselves.
+    struct ScheduledEventHandleList
+    {
+        void PushBack(ScheduledEventHandle* handle);
+        ScheduledEventHandle* PopFront();
+        void Remove(ScheduledEventHandle* handle);
+        //! Moves all the handles of other to the back of this list.
+        void Splice(ScheduledEventHandleList& other);
+        bool IsEmpty() const { return m_head == nullptr; }
+
+        ScheduledEventHandle* m_head = nullptr;
+        ScheduledEventHandle* m_tail = nullptr;
+        AZStd::size_t m_size = 0;
+    };
+
+    //! @class ScheduledEventTimingWheel
+    //! @brief Hierarchical timing wheel of scheduled event handles with millisecond resolution.
+    //! Insert and Remove are constant time, Advance moves all the handles that expired since the last call
+    //! to the expired list in execution time order, touching only the slots of the elapsed milliseconds and
+    //! skipping over the stretches of time in which the lower levels are empty.
+    //! Level 0 holds the events of the next 256ms, each following level covers 256 times the range of the
+    //! previous one. Events are moved down a level when the wheel reaches their slot, events further out than
+    //! the last level (~50 days) are parked in its last slot and re-inserted when it comes around.
+    class ScheduledEventTimingWheel
+    {
+    public:
+        static constexpr uint32_t SlotBits = 8;
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+        static constexpr uint32_t LevelCount = 4;
+
+        ScheduledEventTimingWheel() = default;
+        ~ScheduledEventTimingWheel() = default;
+
+        //! Adds a handle, using its execution time.
+        //! @param handle a handle not in any list
+        //! @param currentTimeMs the current time, used to catch the wheel up when it is empty
+        void Insert(ScheduledEventHandle* handle, TimeMs currentTimeMs);
+
+        //! Removes a handle added with Insert, either waiting in the wheel or in the expired list.
+        void Remove(ScheduledEventHandle* handle);
+
+        //! Moves all the handles with an execution time up to currentTimeMs to the expired list.
+        void Advance(TimeMs currentTimeMs);
+
+        //! Pops the next expired handle, nullptr if there are none.
+        //! Handles inserted as already expired after the last Advance are only returned after the next Advance.
+        ScheduledEventHandle* PopExpired();
+
+        //! Gets the number of handles waiting for their execution time.
+        AZStd::size_t GetScheduledCount() const;
+
+        //! Gets the number of expired handles not popped yet.
+        AZStd::size_t GetExpiredCount() const;
+
+        //! Removes all handles and calls the visitor for each of them.
+        template <typename Visitor>
+        void Clear(Visitor&& visitor);
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ScheduledEventTimingWheel);
+
+        AZStd::size_t GetSlottedCount() const;
+        void InsertIntoSlot(ScheduledEventHandle* handle);
+        void Cascade(uint32_t level);
+
+        ScheduledEventHandleList m_slots[LevelCount][SlotCount];
+        ScheduledEventHandleList m_due;     //< handles inserted with an execution time that has already been reached
+        ScheduledEventHandleList m_expired; //< handles moved out of the wheel by Advance
+        AZStd::size_t m_levelCounts[LevelCount] = {}; //< number of handles in the slots of each level
+        int64_t m_currentTimeMs = 0;        //< the wheel has expired all handles up to and including this time
+    };
+
+    template <typename Visitor>
+    void ScheduledEventTimingWheel::Clear(Visitor&& visitor)
+    {
+        m_expired.Splice(m_due);
+        for (uint32_t level = 0; level < LevelCount; ++level)
+        {
+            for (ScheduledEventHandleList& slot : m_slots[level])
+            {
+                m_expired.Splice(slot);
+            }
+        }
+        for (AZStd::size_t& levelCount : m_levelCounts)
+        {
+            levelCount = 0;
+        }
+        while (ScheduledEventHandle* handle = m_expired.PopFront())
+        {
+            visitor(handle);
+        }
+    }
+}
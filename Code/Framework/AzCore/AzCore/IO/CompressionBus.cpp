@@ -27,6 +27,7 @@ namespace AZ
             m_conflictResolution = rhs.m_conflictResolution;
             m_isCompressed = rhs.m_isCompressed;
             m_isSharedPak = rhs.m_isSharedPak;
+            m_blockTable = AZStd::move(rhs.m_blockTable);
 
             return *this;
         }
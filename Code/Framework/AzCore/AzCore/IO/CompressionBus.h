@@ -9,7 +9,9 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -30,6 +32,18 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Layout of a file that's stored as a series of independently compressed blocks. Every block holds the same amount of
+        //! uncompressed data, except for the last block which can be smaller. This allows a section of the file to be read by
+        //! only decompressing the blocks that overlap with the section.
+        struct CompressedBlockTable
+        {
+            //! The uncompressed size of every block.
+            u32 m_blockSize{ 0 };
+            //! The offsets of the compressed blocks relative to the start of the compressed file, followed by the total compressed
+            //! size. Block n is stored in the range [m_blockOffsets[n], m_blockOffsets[n + 1]).
+            AZStd::vector<u64> m_blockOffsets;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -60,6 +74,9 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Optional table with the blocks the file is compressed in. If set, the decompressor will be called for individual
+            //! blocks with the compressed and uncompressed size of the block instead of the size of the entire file.
+            AZStd::shared_ptr<const CompressedBlockTable> m_blockTable;
         };
 
         class Compression
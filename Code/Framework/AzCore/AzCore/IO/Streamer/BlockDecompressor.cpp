@@ -0,0 +1,744 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> BlockDecompressorConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<BlockDecompressor>(
+                m_maxNumReads, m_maxNumJobs, m_readBufferSizeKib * 1_kib, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void BlockDecompressorConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<BlockDecompressorConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("MaxNumReads", &BlockDecompressorConfig::m_maxNumReads)
+                    ->Field("MaxNumJobs", &BlockDecompressorConfig::m_maxNumJobs)
+                    ->Field("ReadBufferSizeKib", &BlockDecompressorConfig::m_readBufferSizeKib);
+            }
+        }
+
+        static bool IsBlockCompressed(const CompressionInfo& info)
+        {
+            return info.m_isCompressed && info.m_blockTable;
+        }
+
+        bool BlockDecompressor::DecompressionInformation::IsProcessing() const
+        {
+            return !!m_waitRequest;
+        }
+
+        BlockDecompressor::BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, size_t readBufferSize, u32 alignment)
+            : StreamStackEntry("Block decompressor")
+            , m_readBufferSize(AZ_SIZE_ALIGN_UP(readBufferSize, aznumeric_cast<size_t>(alignment)))
+            , m_maxNumReads(maxNumReads)
+            , m_maxNumJobs(maxNumJobs)
+            , m_alignment(alignment)
+        {
+            JobManagerDesc jobDesc;
+            u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+            m_decompressionjobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
+
+            m_processingJobs = AZStd::make_unique<DecompressionInformation[]>(maxNumJobs);
+            m_readSlots = AZStd::make_unique<ReadSlot[]>(maxNumReads);
+
+            // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+            m_bytesDecompressed.PushEntry(1);
+            m_decompressionDurationMicroSec.PushEntry(1);
+        }
+
+        BlockDecompressor::~BlockDecompressor()
+        {
+            // Make sure all jobs have stopped before releasing the buffers they might be using.
+            m_decompressionjobContext.reset();
+            m_decompressionJobManager.reset();
+
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                if (m_readSlots[i].m_buffer)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(
+                        m_readSlots[i].m_buffer, m_readSlots[i].m_bufferSize, m_alignment);
+                }
+            }
+            for (u32 i = 0; i < m_maxNumJobs; ++i)
+            {
+                if (m_processingJobs[i].m_scratchBuffer)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(
+                        m_processingJobs[i].m_scratchBuffer, m_processingJobs[i].m_scratchBufferSize);
+                }
+            }
+        }
+
+        void BlockDecompressor::PrepareRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+            if (auto data = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand()); data != nullptr)
+            {
+                PrepareReadRequest(request, *data);
+            }
+            else
+            {
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }
+
+        void BlockDecompressor::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
+            if (data == nullptr || !IsBlockCompressed(data->m_compressionInfo))
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+
+            const CompressionInfo& info = data->m_compressionInfo;
+            const CompressedBlockTable& blockTable = *info.m_blockTable;
+            const size_t numBlocks = blockTable.m_blockSize > 0
+                ? (info.m_uncompressedSize + blockTable.m_blockSize - 1) / blockTable.m_blockSize
+                : 0;
+            if (blockTable.m_blockSize == 0 || blockTable.m_blockOffsets.size() != numBlocks + 1 ||
+                blockTable.m_blockOffsets.back() > info.m_compressedSize ||
+                data->m_readOffset + data->m_readSize > info.m_uncompressedSize)
+            {
+                AZ_Error("Streamer", false, "Block table for compressed file in archive '%s' doesn't match the requested read.",
+                    info.m_archiveFilename.GetRelativePath());
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            else if (data->m_readSize == 0)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            else
+            {
+                m_pendingReads.push_back(request);
+            }
+        }
+
+        bool BlockDecompressor::ExecuteRequests()
+        {
+            bool result = false;
+            // First queue jobs as this might open up new read slots.
+            if (m_numPendingDecompression > 0 && m_numRunningJobs < m_maxNumJobs)
+            {
+                result = StartDecompressions();
+            }
+
+            // Queue as many new reads as possible.
+            while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+            {
+                if (StartBlockRead(m_pendingReads.front()))
+                {
+                    m_pendingReads.pop_front();
+                }
+                result = true;
+            }
+
+            return StreamStackEntry::ExecuteRequests() || result;
+        }
+
+        void BlockDecompressor::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+            status.m_isIdle = status.m_isIdle && IsIdle();
+        }
+
+        void BlockDecompressor::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            // Create predictions for all pending requests. Some will be further processed after this.
+            AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+            double totalDecompressionDuration = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+            AZStd::chrono::microseconds cumulativeDelay = AZStd::chrono::microseconds::max();
+
+            // Check the blocks that are being decompressed.
+            for (u32 i = 0; i < m_maxNumJobs; ++i)
+            {
+                const DecompressionInformation& job = m_processingJobs[i];
+                if (job.IsProcessing())
+                {
+                    auto decompressionDuration = AZStd::chrono::microseconds(
+                        aznumeric_cast<u64>((job.m_compressedSize * totalDecompressionDuration) / totalBytesDecompressed));
+                    auto timeInProcessing = now - job.m_jobStartTime;
+                    auto timeLeft = decompressionDuration > timeInProcessing ? decompressionDuration - timeInProcessing : AZStd::chrono::microseconds(0);
+                    // Get the shortest time as this indicates the next decompression to become available.
+                    cumulativeDelay = AZStd::min(timeLeft, cumulativeDelay);
+                    job.m_waitRequest->SetEstimatedCompletion(now + timeLeft);
+                }
+            }
+            if (cumulativeDelay == AZStd::chrono::microseconds::max())
+            {
+                cumulativeDelay = AZStd::chrono::microseconds(0);
+            }
+
+            // Next update all reads that are in flight or waiting for decompression. The blocks in a read are decompressed in
+            // parallel, so the decompression time is spread over the available jobs.
+            AZStd::chrono::microseconds decompressionDelay =
+                AZStd::chrono::microseconds(aznumeric_cast<u64>(m_decompressionJobDelayMicroSec.CalculateAverage()));
+            AZStd::chrono::microseconds smallestDecompressionDuration = AZStd::chrono::microseconds::max();
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                const ReadSlot& slot = m_readSlots[i];
+                AZStd::chrono::system_clock::time_point baseTime;
+                switch (slot.m_status)
+                {
+                case ReadSlotStatus::Unused:
+                    [[fallthrough]];
+                case ReadSlotStatus::Decompressing:
+                    continue;
+                case ReadSlotStatus::ReadInFlight:
+                    // Internal read requests can start and complete but pending finalization before they're ever scheduled in which case
+                    // the estimated time is not set.
+                    baseTime = slot.m_request->GetEstimatedCompletion();
+                    if (baseTime == AZStd::chrono::system_clock::time_point())
+                    {
+                        baseTime = now;
+                    }
+                    break;
+                case ReadSlotStatus::PendingDecompression:
+                    baseTime = now;
+                    break;
+                default:
+                    AZ_Assert(false, "Unsupported read slot status: %i.", slot.m_status);
+                    continue;
+                }
+
+                baseTime += cumulativeDelay; // Delay until the first decompression slot becomes available.
+                baseTime += decompressionDelay; // The average time it takes for the job system to pick up the decompression job.
+
+                auto data = AZStd::get_if<FileRequest::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+                const AZStd::vector<u64>& blockOffsets = data->m_compressionInfo.m_blockTable->m_blockOffsets;
+                size_t bytesToDecompress = blockOffsets[slot.m_endBlock] - blockOffsets[slot.m_nextBlock];
+                auto decompressionDuration = AZStd::chrono::microseconds(
+                    aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / (totalBytesDecompressed * m_maxNumJobs)));
+                smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
+                baseTime += decompressionDuration;
+
+                slot.m_request->SetEstimatedCompletion(baseTime);
+            }
+            if (smallestDecompressionDuration != AZStd::chrono::microseconds::max())
+            {
+                cumulativeDelay += smallestDecompressionDuration; // Time after which the decompression jobs and pending reads have completed.
+            }
+
+            // For all internally pending compressed reads add the decompression time. The read time will have already been added downstream.
+            // Because this call will go from the top of the stack to the bottom, but estimation is calculated from the bottom to the top, this
+            // list should be processed in reverse order.
+            for (auto pendingIt = internalPending.rbegin(); pendingIt != internalPending.rend(); ++pendingIt)
+            {
+                EstimateCompressedReadRequest(*pendingIt, cumulativeDelay, decompressionDelay,
+                    totalDecompressionDuration, totalBytesDecompressed);
+            }
+
+            // Finally add a prediction for all the requests that are waiting to be queued.
+            for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+            {
+                EstimateCompressedReadRequest(*requestIt, cumulativeDelay, decompressionDelay,
+                    totalDecompressionDuration, totalBytesDecompressed);
+            }
+        }
+
+        void BlockDecompressor::EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+            AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const
+        {
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
+            if (data && IsBlockCompressed(data->m_compressionInfo))
+            {
+                AZStd::chrono::microseconds processingTime = decompressionDelay;
+                size_t bytesToDecompress = CalculateCompressedBytesToRead(*data);
+                processingTime += AZStd::chrono::microseconds(
+                    aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / (totalBytesDecompressed * m_maxNumJobs)));
+
+                cumulativeDelay += processingTime;
+                request->SetEstimatedCompletion(request->GetEstimatedCompletion() + processingTime);
+            }
+        }
+
+        size_t BlockDecompressor::CalculateCompressedBytesToRead(const FileRequest::CompressedReadData& data)
+        {
+            const CompressedBlockTable& blockTable = *data.m_compressionInfo.m_blockTable;
+            if (data.m_readSize == 0 || blockTable.m_blockSize == 0 || blockTable.m_blockOffsets.empty())
+            {
+                return 0;
+            }
+            size_t lastBlockIndex = blockTable.m_blockOffsets.size() - 1;
+            size_t firstBlock = AZStd::min(aznumeric_cast<size_t>(data.m_readOffset / blockTable.m_blockSize), lastBlockIndex);
+            size_t endBlock = AZStd::min(
+                aznumeric_cast<size_t>((data.m_readOffset + data.m_readSize + blockTable.m_blockSize - 1) / blockTable.m_blockSize),
+                lastBlockIndex);
+            return blockTable.m_blockOffsets[endBlock] - blockTable.m_blockOffsets[firstBlock];
+        }
+
+        void BlockDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+            constexpr double usToMs = 1.0 / 1000.0;
+
+            if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+            {
+                //It only makes sense to add decompression statistics when reading from block compressed files.
+                statistics.push_back(Statistic::CreateInteger(m_name, "Available decompression slots", m_maxNumJobs - m_numRunningJobs));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Available read slots", m_maxNumReads - m_numInFlightReads));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Pending decompression", m_numPendingDecompression));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory (MB)", m_memoryUsage * bytesToMB));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Blocks per request (avg.)", m_blocksPerRequest.CalculateAverage()));
+
+                double averageJobStartDelay = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
+                statistics.push_back(Statistic::CreateFloat(m_name, "Decompression job delay (avg. ms)", averageJobStartDelay));
+
+                double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
+                double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+                statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
+            }
+
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        bool BlockDecompressor::IsIdle() const
+        {
+            return
+                m_pendingReads.empty() &&
+                m_numInFlightReads == 0 &&
+                m_numPendingDecompression == 0 &&
+                m_numRunningJobs == 0;
+        }
+
+        void BlockDecompressor::PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data)
+        {
+            CompressionInfo info;
+            if (CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()) && IsBlockCompressed(info))
+            {
+                AZ_Assert(info.m_decompressor,
+                    "BlockDecompressor::PrepareRequest found a compressed file, but no decompressor to decompress with.");
+                FileRequest* nextRequest = m_context->GetNewInternalRequest();
+                nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, data.m_offset, data.m_size);
+
+                auto& compressionInfo = AZStd::get<FileRequest::CompressedReadData>(nextRequest->GetCommand()).m_compressionInfo;
+                if (compressionInfo.m_conflictResolution == ConflictResolution::PreferFile)
+                {
+                    auto callback = [this, nextRequest](const FileRequest& checkRequest)
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        auto check = AZStd::get_if<FileRequest::FileExistsCheckData>(&checkRequest.GetCommand());
+                        AZ_Assert(check,
+                            "Callback in BlockDecompressor::PrepareReadRequest expected FileExistsCheck but got another command.");
+                        if (check->m_found)
+                        {
+                            FileRequest* originalRequest = m_context->RejectRequest(nextRequest);
+                            StreamStackEntry::PrepareRequest(originalRequest);
+                        }
+                        else
+                        {
+                            m_context->PushPreparedRequest(nextRequest);
+                        }
+                    };
+                    FileRequest* fileCheckRequest = m_context->GetNewInternalRequest();
+                    fileCheckRequest->CreateFileExistsCheck(data.m_path);
+                    fileCheckRequest->SetCompletionCallback(AZStd::move(callback));
+                    StreamStackEntry::QueueRequest(fileCheckRequest);
+                }
+                else
+                {
+                    m_context->PushPreparedRequest(nextRequest);
+                }
+            }
+            else
+            {
+                // Files that aren't compressed in blocks are left to other entries such as the FullFileDecompressor.
+                StreamStackEntry::PrepareRequest(request);
+            }
+        }
+
+        bool BlockDecompressor::StartBlockRead(FileRequest* compressedReadRequest)
+        {
+            if (!m_next)
+            {
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return true;
+            }
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedReadRequest->GetCommand());
+            AZ_Assert(data, "Compressed request that's starting a read in BlockDecompressor didn't contain compression read data.");
+            const CompressionInfo& info = data->m_compressionInfo;
+            const CompressedBlockTable& blockTable = *info.m_blockTable;
+            const AZStd::vector<u64>& blockOffsets = blockTable.m_blockOffsets;
+            const size_t endBlock = aznumeric_caster((data->m_readOffset + data->m_readSize + blockTable.m_blockSize - 1) / blockTable.m_blockSize);
+
+            if (m_activeRead != compressedReadRequest)
+            {
+                AZ_Assert(m_activeReadHold == nullptr, "BlockDecompressor started a new compressed read while the previous one wasn't fully queued.");
+                m_activeRead = compressedReadRequest;
+                m_activeReadNextBlock = aznumeric_caster(data->m_readOffset / blockTable.m_blockSize);
+                m_blocksPerRequest.PushEntry(endBlock - m_activeReadNextBlock);
+            }
+
+            // Completes the wait that keeps the compressed read alive while its blocks are being queued for reading.
+            auto finishActiveRead = [this](IStreamerTypes::RequestStatus status)
+            {
+                if (m_activeReadHold)
+                {
+                    m_activeReadHold->SetStatus(status);
+                    m_context->MarkRequestAsCompleted(m_activeReadHold);
+                    m_activeReadHold = nullptr;
+                }
+                m_activeRead = nullptr;
+            };
+            auto abortActiveRead = [this, compressedReadRequest, &finishActiveRead](IStreamerTypes::RequestStatus status)
+            {
+                // If there's no hold then none of the blocks have been queued yet, so the request can be completed directly.
+                bool hasQueuedReads = m_activeReadHold != nullptr;
+                compressedReadRequest->SetStatus(status);
+                finishActiveRead(status);
+                if (!hasQueuedReads)
+                {
+                    m_context->MarkRequestAsCompleted(compressedReadRequest);
+                }
+            };
+
+            // Don't continue reading blocks if an earlier read or decompression for this request already failed.
+            IStreamerTypes::RequestStatus status = compressedReadRequest->GetStatus();
+            if (status == IStreamerTypes::RequestStatus::Failed || status == IStreamerTypes::RequestStatus::Canceled)
+            {
+                abortActiveRead(status);
+                return true;
+            }
+
+            // Read as many consecutive blocks as fit in the read buffer, but always at least one block.
+            const size_t firstBlock = m_activeReadNextBlock;
+            const u64 readOffset = info.m_offset + blockOffsets[firstBlock];
+            const size_t alignment = aznumeric_cast<size_t>(m_alignment);
+            const size_t offsetAdjustment = readOffset - AZ_SIZE_ALIGN_DOWN(readOffset, alignment);
+            size_t lastBlock = firstBlock + 1;
+            while (lastBlock < endBlock &&
+                AZ_SIZE_ALIGN_UP(offsetAdjustment + (blockOffsets[lastBlock + 1] - blockOffsets[firstBlock]), alignment) <= m_readBufferSize)
+            {
+                ++lastBlock;
+            }
+            for (size_t block = firstBlock; block < lastBlock; ++block)
+            {
+                if (blockOffsets[block + 1] < blockOffsets[block])
+                {
+                    AZ_Error("Streamer", false, "Block table for compressed file in archive '%s' has out of order offsets.",
+                        info.m_archiveFilename.GetRelativePath());
+                    abortActiveRead(IStreamerTypes::RequestStatus::Failed);
+                    return true;
+                }
+            }
+            const size_t compressedSize = blockOffsets[lastBlock] - blockOffsets[firstBlock];
+            const size_t bufferSize = AZ_SIZE_ALIGN_UP(offsetAdjustment + compressedSize, alignment);
+
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                ReadSlot& slot = m_readSlots[i];
+                if (slot.m_status != ReadSlotStatus::Unused)
+                {
+                    continue;
+                }
+
+                if (slot.m_bufferSize < bufferSize)
+                {
+                    if (slot.m_buffer)
+                    {
+                        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+                        m_memoryUsage -= slot.m_bufferSize;
+                    }
+                    // Blocks that are larger than the read buffer get a dedicated buffer that's released after the block is decompressed.
+                    slot.m_bufferSize = AZStd::max(bufferSize, m_readBufferSize);
+                    slot.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                        slot.m_bufferSize, m_alignment, 0, "AZ::IO::Streamer BlockDecompressor", __FILE__, __LINE__));
+                    m_memoryUsage += slot.m_bufferSize;
+                }
+                slot.m_alignmentOffset = offsetAdjustment;
+                slot.m_firstBlock = firstBlock;
+                slot.m_nextBlock = firstBlock;
+                slot.m_endBlock = lastBlock;
+                slot.m_compressedRequest = compressedReadRequest;
+
+                // Keep the compressed read from completing between the reads for its blocks.
+                const bool isLastRead = lastBlock == endBlock;
+                if (!isLastRead && !m_activeReadHold)
+                {
+                    m_activeReadHold = m_context->GetNewInternalRequest();
+                    m_activeReadHold->CreateWait(compressedReadRequest);
+                }
+
+                // As with the FullFileDecompressor the buffer is aligned down but the offset is not corrected so the same data isn't
+                // read multiple times, which would negate the block cache's ability to detect these cases.
+                FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
+                archiveReadRequest->CreateRead(compressedReadRequest, slot.m_buffer + offsetAdjustment, slot.m_bufferSize - offsetAdjustment,
+                    info.m_archiveFilename, readOffset, compressedSize, info.m_isSharedPak);
+                archiveReadRequest->SetCompletionCallback(
+                    [this, readSlot = i](FileRequest& request)
+                    {
+                        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                        FinishBlockRead(&request, readSlot);
+                    });
+                slot.m_request = archiveReadRequest;
+                slot.m_status = ReadSlotStatus::ReadInFlight;
+
+                AZ_Assert(m_numInFlightReads < m_maxNumReads,
+                    "A FileRequest was queued for reading in BlockDecompressor, but there's no slots available.");
+                m_numInFlightReads++;
+                m_next->QueueRequest(archiveReadRequest);
+
+                if (isLastRead)
+                {
+                    finishActiveRead(IStreamerTypes::RequestStatus::Completed);
+                    return true;
+                }
+                m_activeReadNextBlock = lastBlock;
+                return false;
+            }
+            AZ_Assert(false, "%u of %u read slots are use in the BlockDecompressor, but no empty slot was found.", m_numInFlightReads, m_maxNumReads);
+            return false;
+        }
+
+        void BlockDecompressor::FinishBlockRead(FileRequest* readRequest, u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ_Assert(slot.m_request == readRequest, "Request in the block read slot isn't the same as request that's being completed.");
+            AZ_Assert(slot.m_compressedRequest == readRequest->GetParent(),
+                "Read request started by BlockDecompressor doesn't belong to the compressed request in its read slot.");
+
+            if (readRequest->GetStatus() == IStreamerTypes::RequestStatus::Completed)
+            {
+                slot.m_status = ReadSlotStatus::PendingDecompression;
+                ++m_numPendingDecompression;
+
+                // Add this wait so the compressed request isn't completed before the decompression of its blocks have been queued.
+                FileRequest* waitRequest = m_context->GetNewInternalRequest();
+                waitRequest->CreateWait(slot.m_compressedRequest);
+                slot.m_request = waitRequest;
+            }
+            else
+            {
+                ReleaseReadSlot(readSlot);
+            }
+        }
+
+        bool BlockDecompressor::StartDecompressions()
+        {
+            bool queuedJobs = false;
+            u32 jobSlot = 0;
+            for (u32 readSlot = 0; readSlot < m_maxNumReads && m_numRunningJobs < m_maxNumJobs; ++readSlot)
+            {
+                ReadSlot& slot = m_readSlots[readSlot];
+                if (slot.m_status != ReadSlotStatus::PendingDecompression)
+                {
+                    continue;
+                }
+
+                auto data = AZStd::get_if<FileRequest::CompressedReadData>(&slot.m_compressedRequest->GetCommand());
+                AZ_Assert(data, "Compressed request in BlockDecompressor that's starting decompression didn't contain compression read data.");
+                const CompressionInfo& compressionInfo = data->m_compressionInfo;
+                AZ_Assert(compressionInfo.m_decompressor, "BlockDecompressor is queuing a decompression job but couldn't find a decompressor.");
+                const CompressedBlockTable& blockTable = *compressionInfo.m_blockTable;
+                const u64 readEnd = data->m_readOffset + data->m_readSize;
+
+                // There's no need to decompress the remaining blocks if an earlier block already failed.
+                IStreamerTypes::RequestStatus status = slot.m_compressedRequest->GetStatus();
+                if (status == IStreamerTypes::RequestStatus::Failed || status == IStreamerTypes::RequestStatus::Canceled)
+                {
+                    slot.m_nextBlock = slot.m_endBlock;
+                }
+
+                while (slot.m_nextBlock < slot.m_endBlock && m_numRunningJobs < m_maxNumJobs)
+                {
+                    while (jobSlot < m_maxNumJobs && m_processingJobs[jobSlot].IsProcessing())
+                    {
+                        ++jobSlot;
+                    }
+                    AZ_Assert(jobSlot < m_maxNumJobs, "BlockDecompressor has fewer running jobs than available but no free job slot.");
+
+                    size_t block = slot.m_nextBlock++;
+                    u64 blockStart = aznumeric_cast<u64>(block) * blockTable.m_blockSize;
+                    u64 blockEnd = AZStd::min(blockStart + blockTable.m_blockSize, aznumeric_cast<u64>(compressionInfo.m_uncompressedSize));
+                    u64 copyStart = AZStd::max(data->m_readOffset, blockStart);
+                    u64 copyEnd = AZStd::min(readEnd, blockEnd);
+
+                    DecompressionInformation& info = m_processingJobs[jobSlot];
+                    info.m_compressionInfo = &compressionInfo;
+                    info.m_compressedData = slot.m_buffer + slot.m_alignmentOffset +
+                        (blockTable.m_blockOffsets[block] - blockTable.m_blockOffsets[slot.m_firstBlock]);
+                    info.m_compressedSize = blockTable.m_blockOffsets[block + 1] - blockTable.m_blockOffsets[block];
+                    info.m_blockSize = aznumeric_caster(blockEnd - blockStart);
+                    info.m_blockOffset = aznumeric_caster(copyStart - blockStart);
+                    info.m_copySize = aznumeric_caster(copyEnd - copyStart);
+                    info.m_output = reinterpret_cast<u8*>(data->m_output) + (copyStart - data->m_readOffset);
+                    info.m_readSlot = readSlot;
+
+                    // Blocks that are only partially requested are decompressed into a scratch buffer first.
+                    if (info.m_copySize != info.m_blockSize && info.m_scratchBufferSize < info.m_blockSize)
+                    {
+                        if (info.m_scratchBuffer)
+                        {
+                            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(info.m_scratchBuffer, info.m_scratchBufferSize);
+                            m_memoryUsage -= info.m_scratchBufferSize;
+                        }
+                        info.m_scratchBufferSize = blockTable.m_blockSize;
+                        info.m_scratchBuffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                            info.m_scratchBufferSize, AZCORE_GLOBAL_NEW_ALIGNMENT, 0, "AZ::IO::Streamer BlockDecompressor", __FILE__, __LINE__));
+                        m_memoryUsage += info.m_scratchBufferSize;
+                    }
+
+                    FileRequest* waitRequest = m_context->GetNewInternalRequest();
+                    waitRequest->CreateWait(slot.m_compressedRequest);
+                    waitRequest->SetCompletionCallback([this, jobSlot](FileRequest& request)
+                        {
+                            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                            FinishDecompression(&request, jobSlot);
+                        });
+                    info.m_waitRequest = waitRequest;
+                    info.m_queueStartTime = AZStd::chrono::high_resolution_clock::now();
+                    info.m_jobStartTime = info.m_queueStartTime; // Set these to the same in case the scheduler requests an update before the job has started.
+
+                    auto job = [this, &info]()
+                    {
+                        DecompressBlock(m_context, info);
+                    };
+                    AZ::Job* decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                    ++slot.m_numRunningJobs;
+                    ++m_numRunningJobs;
+                    decompressionJob->Start();
+                    queuedJobs = true;
+                }
+
+                if (slot.m_nextBlock == slot.m_endBlock)
+                {
+                    // All blocks have been queued, so the waits for the individual blocks now keep the compressed request alive.
+                    slot.m_request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(slot.m_request);
+                    slot.m_request = nullptr;
+                    slot.m_status = ReadSlotStatus::Decompressing;
+                    --m_numPendingDecompression;
+                    if (slot.m_numRunningJobs == 0)
+                    {
+                        ReleaseReadSlot(readSlot);
+                    }
+                    queuedJobs = true;
+                }
+            }
+            return queuedJobs;
+        }
+
+        void BlockDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 jobSlot)
+        {
+            DecompressionInformation& jobInfo = m_processingJobs[jobSlot];
+            AZ_Assert(jobInfo.m_waitRequest == waitRequest, "Job slot didn't contain the expected wait request.");
+
+            auto endTime = AZStd::chrono::high_resolution_clock::now();
+
+            m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
+            m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                endTime - jobInfo.m_jobStartTime).count());
+            m_bytesDecompressed.PushEntry(jobInfo.m_compressedSize);
+
+            jobInfo.m_waitRequest = nullptr;
+            jobInfo.m_compressionInfo = nullptr;
+            AZ_Assert(m_numRunningJobs > 0, "About to complete a decompression job, but the internal count doesn't see a running job.");
+            --m_numRunningJobs;
+
+            ReadSlot& slot = m_readSlots[jobInfo.m_readSlot];
+            AZ_Assert(slot.m_numRunningJobs > 0, "About to complete a decompression job, but its read slot doesn't have a running job.");
+            --slot.m_numRunningJobs;
+            if (slot.m_status == ReadSlotStatus::Decompressing && slot.m_numRunningJobs == 0)
+            {
+                ReleaseReadSlot(jobInfo.m_readSlot);
+            }
+        }
+
+        void BlockDecompressor::ReleaseReadSlot(u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            // Buffers for blocks that didn't fit in the regular read buffer are released to keep the memory usage bounded.
+            if (slot.m_bufferSize > m_readBufferSize)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_buffer, slot.m_bufferSize, m_alignment);
+                m_memoryUsage -= slot.m_bufferSize;
+                slot.m_buffer = nullptr;
+                slot.m_bufferSize = 0;
+            }
+            slot.m_request = nullptr;
+            slot.m_compressedRequest = nullptr;
+            slot.m_status = ReadSlotStatus::Unused;
+
+            AZ_Assert(m_numInFlightReads > 0, "Trying to release a read slot in BlockDecompressor, but no read slots are supposed to be in use.");
+            m_numInFlightReads--;
+        }
+
+        void BlockDecompressor::DecompressBlock(StreamerContext* context, DecompressionInformation& info)
+        {
+            info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
+
+            const CompressionInfo& compressionInfo = *info.m_compressionInfo;
+            AZ_Assert(compressionInfo.m_decompressor, "Block decompression job started, but there's no decompressor callback assigned.");
+
+            bool success;
+            if (info.m_copySize == info.m_blockSize)
+            {
+                success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData, info.m_compressedSize,
+                    info.m_output, info.m_blockSize);
+            }
+            else
+            {
+                success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData, info.m_compressedSize,
+                    info.m_scratchBuffer, info.m_blockSize);
+                if (success)
+                {
+                    memcpy(info.m_output, info.m_scratchBuffer + info.m_blockOffset, info.m_copySize);
+                }
+            }
+            info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+
+            context->MarkRequestAsCompleted(info.m_waitRequest);
+            context->WakeUpSchedulingThread();
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct BlockDecompressorConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::BlockDecompressorConfig, "{5E4F3B1A-7C2D-4A8E-9F61-3D0B8C7E2A54}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(BlockDecompressorConfig, AZ::SystemAllocator, 0);
+
+            ~BlockDecompressorConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Maximum number of reads that are kept in flight. Every read has its own buffer for compressed data.
+            u32 m_maxNumReads{ 2 };
+            //! Maximum number of blocks that can be decompressed simultaneously.
+            u32 m_maxNumJobs{ 4 };
+            //! The size of the buffer for compressed data for every read in kilobytes. As many blocks as will fit in the
+            //! buffer are read at the same time.
+            u32 m_readBufferSizeKib{ 1024 };
+        };
+
+        //! Entry in the streaming stack that decompresses files from an archive that are stored as a series of independently
+        //! compressed blocks as described by a CompressedBlockTable. Only the blocks that overlap with the requested section are
+        //! read and decompressed, so partial reads of large files don't require decompressing the entire file. Blocks are
+        //! decompressed in parallel. Blocks that are fully requested are decompressed directly into the output buffer and only
+        //! the blocks at the start and end of a request use a scratch buffer, so the memory used is limited to the read buffers
+        //! and one block per job.
+        //! Files without a block table are left for other entries such as the FullFileDecompressor to handle.
+        class BlockDecompressor
+            : public StreamStackEntry
+        {
+        public:
+            BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, size_t readBufferSize, u32 alignment);
+            ~BlockDecompressor() override;
+
+            void PrepareRequest(FileRequest* request) override;
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            enum class ReadSlotStatus : uint8_t
+            {
+                Unused,
+                ReadInFlight,
+                PendingDecompression, //!< The read has completed but not all blocks have been queued for decompression yet.
+                Decompressing //!< All blocks have been queued for decompression, but not all have completed yet.
+            };
+
+            struct ReadSlot
+            {
+                FileRequest* m_compressedRequest{ nullptr };
+                //! The read request while reading or the wait request that keeps the compressed request alive until all blocks have
+                //! been queued for decompression.
+                FileRequest* m_request{ nullptr };
+                u8* m_buffer{ nullptr };
+                size_t m_bufferSize{ 0 };
+                size_t m_alignmentOffset{ 0 };
+                size_t m_firstBlock{ 0 };
+                size_t m_nextBlock{ 0 }; //!< The next block to queue for decompression.
+                size_t m_endBlock{ 0 };
+                u32 m_numRunningJobs{ 0 };
+                ReadSlotStatus m_status{ ReadSlotStatus::Unused };
+            };
+
+            struct DecompressionInformation
+            {
+                bool IsProcessing() const;
+
+                AZStd::chrono::high_resolution_clock::time_point m_queueStartTime;
+                AZStd::chrono::high_resolution_clock::time_point m_jobStartTime;
+                const CompressionInfo* m_compressionInfo{ nullptr };
+                FileRequest* m_waitRequest{ nullptr };
+                const u8* m_compressedData{ nullptr };
+                u8* m_output{ nullptr };
+                u8* m_scratchBuffer{ nullptr };
+                size_t m_scratchBufferSize{ 0 };
+                size_t m_compressedSize{ 0 };
+                size_t m_blockSize{ 0 }; //!< Uncompressed size of the block.
+                size_t m_blockOffset{ 0 }; //!< Offset into the uncompressed block to start copying from.
+                size_t m_copySize{ 0 }; //!< Number of bytes to copy from the uncompressed block.
+                u32 m_readSlot{ 0 };
+            };
+
+            bool IsIdle() const;
+
+            void PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data);
+
+            void EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+                AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
+            static size_t CalculateCompressedBytesToRead(const FileRequest::CompressedReadData& data);
+
+            bool StartBlockRead(FileRequest* compressedReadRequest);
+            void FinishBlockRead(FileRequest* readRequest, u32 readSlot);
+            bool StartDecompressions();
+            void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
+            void ReleaseReadSlot(u32 readSlot);
+
+            static void DecompressBlock(StreamerContext* context, DecompressionInformation& info);
+
+            AZStd::deque<FileRequest*> m_pendingReads;
+            //! The compressed read at the front of the pending reads if some of its blocks have been queued for reading.
+            FileRequest* m_activeRead{ nullptr };
+            //! Wait request that keeps the active compressed read from completing between the reads of its blocks. This is only
+            //! needed if the blocks don't fit in a single read buffer.
+            FileRequest* m_activeReadHold{ nullptr };
+            size_t m_activeReadNextBlock{ 0 };
+
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_blocksPerRequest;
+
+            AZStd::unique_ptr<ReadSlot[]> m_readSlots;
+            AZStd::unique_ptr<DecompressionInformation[]> m_processingJobs;
+            AZStd::unique_ptr<JobManager> m_decompressionJobManager;
+            AZStd::unique_ptr<JobContext> m_decompressionjobContext;
+
+            size_t m_readBufferSize{ 0 };
+            size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            u32 m_maxNumReads{ 2 };
+            u32 m_numInFlightReads{ 0 };
+            u32 m_numPendingDecompression{ 0 };
+            u32 m_maxNumJobs{ 1 };
+            u32 m_numRunningJobs{ 0 };
+            u32 m_alignment{ 0 };
+        };
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,858 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/DiskCache.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> DiskCacheConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            if (m_cachePath.empty())
+            {
+                // No location for the cache has been provided so there's nothing to add to the stack.
+                return parent;
+            }
+
+            size_t blockSize;
+            switch (m_blockSize)
+            {
+            case BlockCacheConfig::BlockSize::MaxTransfer:
+                blockSize = hardware.m_maxTransfer;
+                break;
+            case BlockCacheConfig::BlockSize::MemoryAlignment:
+                blockSize = hardware.m_maxPhysicalSectorSize;
+                break;
+            case BlockCacheConfig::BlockSize::SizeAlignment:
+                blockSize = hardware.m_maxLogicalSectorSize;
+                break;
+            default:
+                blockSize = m_blockSize;
+                break;
+            }
+
+            u64 cacheSize = aznumeric_cast<u64>(m_cacheSizeMib) * 1_mib;
+            if (blockSize * 2 > cacheSize)
+            {
+                AZ_Warning("Streamer", false, "Size (%llu) for DiskCache isn't big enough to hold at least two cache blocks of size (%zu). "
+                    "The cache size will be increased to fit 2 cache blocks.", cacheSize, blockSize);
+                cacheSize = blockSize * 2;
+            }
+
+            auto stackEntry = AZStd::make_shared<DiskCache>(m_cachePath, cacheSize, aznumeric_caster(blockSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void DiskCacheConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<DiskCacheConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("CachePath", &DiskCacheConfig::m_cachePath)
+                    ->Field("CacheSizeMib", &DiskCacheConfig::m_cacheSizeMib)
+                    ->Field("BlockSize", &DiskCacheConfig::m_blockSize);
+            }
+        }
+
+        static constexpr char CacheHitRateName[] = "Cache hit rate";
+        static constexpr char DataFileName[] = "StreamerCache.data";
+        static constexpr char IndexFileName[] = "StreamerCache.index";
+        static constexpr char TempIndexFileName[] = "StreamerCache.index.tmp";
+
+        namespace DiskCacheInternal
+        {
+            static constexpr u32 IndexMagic = 0x43445A41; // "AZDC"
+            static constexpr u32 IndexVersion = 1;
+
+            struct IndexHeader
+            {
+                u32 m_magic;
+                u32 m_version;
+                u32 m_blockSize;
+                u32 m_numSlots;
+                u32 m_numFiles;
+                u32 m_numBlocks;
+            };
+
+            //! Stored for every file in the index and followed by the path of the file.
+            struct IndexFile
+            {
+                u64 m_modificationTime;
+                u64 m_fileSize;
+                u32 m_pathLength;
+                u32 m_padding;
+            };
+
+            //! Stored for every block in the index, ordered from least to most recently used.
+            struct IndexBlock
+            {
+                u64 m_blockIndex;
+                u32 m_fileIndex;
+                u32 m_slot;
+                u32 m_size;
+                u32 m_padding;
+            };
+
+            static void Append(AZStd::vector<u8>& buffer, const void* data, size_t size)
+            {
+                const u8* bytes = reinterpret_cast<const u8*>(data);
+                buffer.insert(buffer.end(), bytes, bytes + size);
+            }
+
+            static bool Extract(const AZStd::vector<u8>& buffer, size_t& offset, void* data, size_t size)
+            {
+                if (offset + size > buffer.size())
+                {
+                    return false;
+                }
+                memcpy(data, buffer.data() + offset, size);
+                offset += size;
+                return true;
+            }
+        } // namespace DiskCacheInternal
+
+        bool DiskCache::BlockKey::operator==(const BlockKey& rhs) const
+        {
+            return m_blockIndex == rhs.m_blockIndex && m_fileIndex == rhs.m_fileIndex;
+        }
+
+        size_t DiskCache::BlockKeyHasher::operator()(const BlockKey& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_blockIndex, key.m_fileIndex);
+            return seed;
+        }
+
+        DiskCache::DiskCache(AZStd::string cachePath, u64 cacheSize, u32 blockSize)
+            : StreamStackEntry("Disk cache")
+            , m_cachePath(AZStd::move(cachePath))
+            , m_blockSize(blockSize)
+        {
+            AZ_Assert(blockSize > 0, "The block size for the disk cache can't be zero.");
+            m_numSlots = aznumeric_caster(cacheSize / blockSize);
+            m_slots = AZStd::unique_ptr<Slot[]>(new Slot[m_numSlots]);
+        }
+
+        DiskCache::~DiskCache()
+        {
+            SaveIndex();
+            m_dataFile.Close();
+        }
+
+        void DiskCache::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                {
+                    ReadFile(request, args);
+                    return;
+                }
+                else
+                {
+                    if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                    {
+                        FlushCache(args.m_path);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                    {
+                        FlushEntireCache();
+                    }
+                    StreamStackEntry::QueueRequest(request);
+                }
+            }, request->GetCommand());
+        }
+
+        bool DiskCache::ExecuteRequests()
+        {
+            bool hitProcessed = false;
+            if (!m_pendingHits.empty())
+            {
+                // Only serve one block per call so the scheduler gets a chance to queue up more work for the next entries.
+                PendingHit hit = m_pendingHits.front();
+                m_pendingHits.pop_front();
+                ServeHit(hit);
+                hitProcessed = true;
+            }
+
+            if (m_numUnsavedChanges >= s_maxUnsavedChanges)
+            {
+                SaveIndex();
+            }
+
+            bool nextResult = StreamStackEntry::ExecuteRequests();
+            return nextResult || hitProcessed;
+        }
+
+        void DiskCache::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            status.m_isIdle = status.m_isIdle && m_pendingHits.empty();
+        }
+
+        void DiskCache::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            // Reads from the cache are processed in order, one per call to ExecuteRequests.
+            TimedAverageWindowDuration averageReadTime = m_cacheReadTimeAverage.CalculateAverage();
+            TimedAverageWindowDuration cumulativeReadTime{ 0 };
+            for (PendingHit& hit : m_pendingHits)
+            {
+                cumulativeReadTime += averageReadTime;
+                hit.m_wait->SetEstimatedCompletion(now + cumulativeReadTime);
+            }
+
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        }
+
+        void DiskCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, m_hitRateStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Cached blocks", aznumeric_cast<s64>(m_blockLookup.size())));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Cache usage (MB)",
+                aznumeric_cast<double>(m_blockLookup.size()) * aznumeric_cast<double>(m_blockSize) * bytesToMB));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Written (MB)", aznumeric_cast<double>(m_bytesWritten) * bytesToMB));
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        void DiskCache::SaveIndex()
+        {
+            using namespace DiskCacheInternal;
+
+            if (!m_isOpen || (m_numUnsavedChanges == 0 && m_pendingFreeSlots.empty()))
+            {
+                return;
+            }
+
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            // Make sure that all blocks are on disk before the index that refers to them is written.
+            m_dataFile.Flush();
+
+            // Only store files that have blocks in the cache and compact the file indices accordingly.
+            AZStd::vector<u32> fileRemap(m_files.size(), s_invalidIndex);
+            u32 numFiles = 0;
+            for (size_t i = 0; i < m_files.size(); ++i)
+            {
+                if (m_files[i].m_numBlocks > 0)
+                {
+                    fileRemap[i] = numFiles++;
+                }
+            }
+
+            AZStd::vector<u8> buffer;
+            IndexHeader header{ IndexMagic, IndexVersion, m_blockSize, m_numSlots, numFiles, aznumeric_caster(m_blockLookup.size()) };
+            Append(buffer, &header, sizeof(header));
+            for (size_t i = 0; i < m_files.size(); ++i)
+            {
+                if (fileRemap[i] != s_invalidIndex)
+                {
+                    const CachedFile& file = m_files[i];
+                    IndexFile entry{ file.m_modificationTime, file.m_fileSize, aznumeric_caster(file.m_path.size()), 0 };
+                    Append(buffer, &entry, sizeof(entry));
+                    Append(buffer, file.m_path.data(), file.m_path.size());
+                }
+            }
+            for (u32 slotIndex : m_lru)
+            {
+                const Slot& slot = m_slots[slotIndex];
+                IndexBlock entry{ slot.m_blockIndex, fileRemap[slot.m_fileIndex], slotIndex, slot.m_size, 0 };
+                Append(buffer, &entry, sizeof(entry));
+            }
+            // The magic is repeated at the end to detect truncated files.
+            Append(buffer, &IndexMagic, sizeof(IndexMagic));
+
+            // Write to a temporary file first and then replace the index in one step so there's always a complete index on disk.
+            AZStd::string tempIndexPath = m_cachePath + "/" + TempIndexFileName;
+            SystemFile indexFile;
+            if (!indexFile.Open(tempIndexPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning("Streamer", false, "Unable to create the index file for the disk cache at '%s'.", tempIndexPath.c_str());
+                return;
+            }
+            bool written = indexFile.Write(buffer.data(), buffer.size()) == buffer.size();
+            indexFile.Flush();
+            indexFile.Close();
+            if (!written || !SystemFile::Rename(tempIndexPath.c_str(), m_indexFilePath.c_str(), true))
+            {
+                AZ_Warning("Streamer", false, "Unable to store the index file for the disk cache at '%s'.", m_indexFilePath.c_str());
+                return;
+            }
+            m_numUnsavedChanges = 0;
+
+            // The stored index no longer refers to the evicted slots so they can now be safely reused.
+            auto pendingEnd = AZStd::remove_if(m_pendingFreeSlots.begin(), m_pendingFreeSlots.end(),
+                [this](u32 slotIndex)
+                {
+                    Slot& slot = m_slots[slotIndex];
+                    if (slot.m_numReaders == 0)
+                    {
+                        slot.m_state = SlotState::Free;
+                        m_freeSlots.push_back(slotIndex);
+                        return true;
+                    }
+                    return false;
+                });
+            m_pendingFreeSlots.erase(pendingEnd, m_pendingFreeSlots.end());
+        }
+
+        u32 DiskCache::GetNumCachedBlocks() const
+        {
+            return aznumeric_caster(m_blockLookup.size());
+        }
+
+        bool DiskCache::OpenCache()
+        {
+            if (m_isOpen)
+            {
+                return true;
+            }
+            if (m_isDisabled)
+            {
+                return false;
+            }
+
+            // The path is resolved on first use because aliases might not be available when the streaming stack is created.
+            char resolvedPath[AZ::IO::MaxPathLength];
+            FileIOBase* fileIO = FileIOBase::GetInstance();
+            if (fileIO && fileIO->ResolvePath(m_cachePath.c_str(), resolvedPath, AZ_ARRAY_SIZE(resolvedPath)))
+            {
+                m_cachePath = resolvedPath;
+            }
+            m_dataFilePath = m_cachePath + "/" + DataFileName;
+            m_indexFilePath = m_cachePath + "/" + IndexFileName;
+
+            if (SystemFile::Exists(m_dataFilePath.c_str()) && m_dataFile.Open(m_dataFilePath.c_str(), SystemFile::SF_OPEN_READ_WRITE))
+            {
+                LoadIndex();
+            }
+            else if (m_dataFile.Open(m_dataFilePath.c_str(),
+                SystemFile::SF_OPEN_READ_WRITE | SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH))
+            {
+                // An index without the data it refers to has no value.
+                if (SystemFile::Exists(m_indexFilePath.c_str()))
+                {
+                    SystemFile::Delete(m_indexFilePath.c_str());
+                }
+                ResetCache();
+            }
+            else
+            {
+                AZ_Warning("Streamer", false, "Unable to open the disk cache at '%s'. The disk cache will be disabled.", m_dataFilePath.c_str());
+                m_isDisabled = true;
+                return false;
+            }
+
+            m_isOpen = true;
+            return true;
+        }
+
+        void DiskCache::LoadIndex()
+        {
+            using namespace DiskCacheInternal;
+
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            ResetCache();
+
+            if (!SystemFile::Exists(m_indexFilePath.c_str()))
+            {
+                return;
+            }
+
+            AZStd::vector<u8> buffer;
+            buffer.resize_no_construct(SystemFile::Length(m_indexFilePath.c_str()));
+            if (SystemFile::Read(m_indexFilePath.c_str(), buffer.data(), buffer.size()) != buffer.size())
+            {
+                AZ_Warning("Streamer", false, "Unable to read the index of the disk cache at '%s'. Starting with an empty cache.",
+                    m_indexFilePath.c_str());
+                return;
+            }
+
+            size_t offset = 0;
+            IndexHeader header;
+            if (!Extract(buffer, offset, &header, sizeof(header)) ||
+                header.m_magic != IndexMagic ||
+                header.m_version != IndexVersion ||
+                header.m_blockSize != m_blockSize ||
+                header.m_numSlots != m_numSlots)
+            {
+                AZ_TracePrintf("Streamer", "The index of the disk cache at '%s' is from a different version or configuration. "
+                    "Starting with an empty cache.\n", m_indexFilePath.c_str());
+                return;
+            }
+
+            auto indexIsCorrupted = [this]()
+            {
+                AZ_Warning("Streamer", false, "The index of the disk cache at '%s' is corrupted. Starting with an empty cache.",
+                    m_indexFilePath.c_str());
+                ResetCache();
+            };
+
+            for (u32 i = 0; i < header.m_numFiles; ++i)
+            {
+                IndexFile entry;
+                if (!Extract(buffer, offset, &entry, sizeof(entry)) || offset + entry.m_pathLength > buffer.size())
+                {
+                    indexIsCorrupted();
+                    return;
+                }
+                CachedFile file;
+                file.m_path.assign(reinterpret_cast<const char*>(buffer.data() + offset), entry.m_pathLength);
+                file.m_modificationTime = entry.m_modificationTime;
+                file.m_fileSize = entry.m_fileSize;
+                offset += entry.m_pathLength;
+
+                if (!m_fileLookup.emplace(file.m_path, i).second)
+                {
+                    indexIsCorrupted();
+                    return;
+                }
+                m_files.push_back(AZStd::move(file));
+            }
+
+            u64 dataFileLength = m_dataFile.Length();
+            for (u32 i = 0; i < header.m_numBlocks; ++i)
+            {
+                IndexBlock entry;
+                if (!Extract(buffer, offset, &entry, sizeof(entry)) ||
+                    entry.m_fileIndex >= header.m_numFiles ||
+                    entry.m_slot >= m_numSlots ||
+                    entry.m_size == 0 || entry.m_size > m_blockSize ||
+                    aznumeric_cast<u64>(entry.m_slot) * m_blockSize + entry.m_size > dataFileLength ||
+                    m_slots[entry.m_slot].m_state != SlotState::Free)
+                {
+                    indexIsCorrupted();
+                    return;
+                }
+                if (!m_blockLookup.emplace(BlockKey{ entry.m_blockIndex, entry.m_fileIndex }, entry.m_slot).second)
+                {
+                    indexIsCorrupted();
+                    return;
+                }
+
+                Slot& slot = m_slots[entry.m_slot];
+                slot.m_blockIndex = entry.m_blockIndex;
+                slot.m_fileIndex = entry.m_fileIndex;
+                slot.m_size = entry.m_size;
+                slot.m_state = SlotState::Used;
+                slot.m_lruPosition = m_lru.insert(m_lru.end(), entry.m_slot);
+                m_files[entry.m_fileIndex].m_numBlocks++;
+            }
+
+            u32 footer = 0;
+            if (!Extract(buffer, offset, &footer, sizeof(footer)) || footer != IndexMagic || offset != buffer.size())
+            {
+                indexIsCorrupted();
+                return;
+            }
+
+            m_freeSlots.clear();
+            for (u32 i = m_numSlots; i > 0; --i)
+            {
+                if (m_slots[i - 1].m_state == SlotState::Free)
+                {
+                    m_freeSlots.push_back(i - 1);
+                }
+            }
+        }
+
+        void DiskCache::ResetCache()
+        {
+            m_blockLookup.clear();
+            m_fileLookup.clear();
+            m_files.clear();
+            m_lru.clear();
+            m_pendingFreeSlots.clear();
+            m_freeSlots.clear();
+            m_freeSlots.reserve(m_numSlots);
+            // Store the slots in reverse so the slots at the start of the data file are used first.
+            for (u32 i = m_numSlots; i > 0; --i)
+            {
+                m_slots[i - 1] = Slot{};
+                m_freeSlots.push_back(i - 1);
+            }
+        }
+
+        void DiskCache::ReadFile(FileRequest* request, FileRequest::ReadData& data)
+        {
+            if (!m_next)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
+            if (data.m_size == 0 || !OpenCache())
+            {
+                m_next->QueueRequest(request);
+                return;
+            }
+
+            u32 fileIndex = VerifyFile(data.m_path);
+            if (fileIndex == s_invalidIndex || data.m_offset + data.m_size > m_files[fileIndex].m_fileSize)
+            {
+                // Either the file can't be cached or the read is invalid, in which case the next entry will report the error.
+                m_next->QueueRequest(request);
+                return;
+            }
+
+            const u64 fileSize = m_files[fileIndex].m_fileSize;
+            const u64 readEnd = data.m_offset + data.m_size;
+            const u64 firstBlock = data.m_offset / m_blockSize;
+            const u64 endBlock = (readEnd + m_blockSize - 1) / m_blockSize;
+            u8* output = reinterpret_cast<u8*>(data.m_output);
+
+            // Consecutive blocks that are missing from the cache and are fully requested are read from the original file
+            // with a single read.
+            u64 missingRangeStart = endBlock;
+            for (u64 block = firstBlock; block < endBlock; ++block)
+            {
+                const u64 blockStart = block * m_blockSize;
+                const u64 blockEnd = AZStd::min(blockStart + m_blockSize, fileSize);
+                const u64 copyStart = AZStd::max(data.m_offset, blockStart);
+                const u64 copyEnd = AZStd::min(readEnd, blockEnd);
+                u8* blockOutput = output + (copyStart - data.m_offset);
+
+                u32 slot = FindBlock(fileIndex, block);
+                if (slot != s_invalidIndex)
+                {
+                    if (missingRangeStart != endBlock)
+                    {
+                        ReadFromSource(request, data, fileIndex, missingRangeStart, block);
+                        missingRangeStart = endBlock;
+                    }
+
+                    PendingHit hit;
+                    hit.m_wait = m_context->GetNewInternalRequest();
+                    hit.m_wait->CreateWait(request);
+                    hit.m_output = blockOutput;
+                    hit.m_sourceOffset = copyStart;
+                    hit.m_copySize = copyEnd - copyStart;
+                    hit.m_blockOffset = aznumeric_caster(copyStart - blockStart);
+                    hit.m_slot = slot;
+                    m_pendingHits.push_back(hit);
+
+                    m_slots[slot].m_numReaders++;
+                    TouchSlot(slot);
+
+                    m_hitRateStat.PushSample(1.0);
+                }
+                else
+                {
+                    if (copyStart == blockStart && copyEnd == blockEnd)
+                    {
+                        if (missingRangeStart == endBlock)
+                        {
+                            missingRangeStart = block;
+                        }
+                    }
+                    else
+                    {
+                        if (missingRangeStart != endBlock)
+                        {
+                            ReadFromSource(request, data, fileIndex, missingRangeStart, block);
+                            missingRangeStart = endBlock;
+                        }
+                        ReadPartialBlock(request, data, fileIndex, block, blockOutput,
+                            aznumeric_caster(copyStart - blockStart), copyEnd - copyStart);
+                    }
+
+                    m_hitRateStat.PushSample(0.0);
+                }
+                Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            }
+
+            if (missingRangeStart != endBlock)
+            {
+                ReadFromSource(request, data, fileIndex, missingRangeStart, endBlock);
+            }
+        }
+
+        void DiskCache::ReadFromSource(FileRequest* request, FileRequest::ReadData& data, u32 fileIndex, u64 firstBlock, u64 endBlock)
+        {
+            const u64 readOffset = firstBlock * m_blockSize;
+            const u64 readSize = AZStd::min(endBlock * m_blockSize, m_files[fileIndex].m_fileSize) - readOffset;
+            AZ_Assert(readOffset >= data.m_offset && readOffset + readSize <= data.m_offset + data.m_size,
+                "DiskCache tried to read blocks from the original file that weren't fully requested.");
+            u8* output = reinterpret_cast<u8*>(data.m_output) + (readOffset - data.m_offset);
+
+            auto storeBlocks = [this, fileIndex, firstBlock, endBlock, output, readSize, generation = m_files[fileIndex].m_generation]
+                (FileRequest& readRequest)
+            {
+                if (readRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed &&
+                    m_files[fileIndex].m_generation == generation)
+                {
+                    for (u64 block = firstBlock; block < endBlock; ++block)
+                    {
+                        const u64 blockOffset = (block - firstBlock) * m_blockSize;
+                        StoreBlock(fileIndex, block, output + blockOffset, aznumeric_caster(AZStd::min<u64>(m_blockSize, readSize - blockOffset)));
+                    }
+                }
+            };
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(request, output, readSize, data.m_path, readOffset, readSize, data.m_sharedRead);
+            readRequest->SetCompletionCallback(AZStd::move(storeBlocks));
+            m_next->QueueRequest(readRequest);
+        }
+
+        void DiskCache::ReadPartialBlock(FileRequest* request, FileRequest::ReadData& data, u32 fileIndex, u64 blockIndex,
+            u8* output, u32 blockOffset, u64 copySize)
+        {
+            const u64 blockStart = blockIndex * m_blockSize;
+            const u32 blockSize = aznumeric_caster(AZStd::min<u64>(m_blockSize, m_files[fileIndex].m_fileSize - blockStart));
+            u8* buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, 0, "AZ::IO::Streamer DiskCache", __FILE__, __LINE__));
+
+            auto copyAndStoreBlock = [this, fileIndex, blockIndex, buffer, blockSize, output, blockOffset, copySize,
+                generation = m_files[fileIndex].m_generation](FileRequest& readRequest)
+            {
+                if (readRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed)
+                {
+                    memcpy(output, buffer + blockOffset, copySize);
+                    if (m_files[fileIndex].m_generation == generation)
+                    {
+                        StoreBlock(fileIndex, blockIndex, buffer, blockSize);
+                    }
+                }
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            };
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(request, buffer, blockSize, data.m_path, blockStart, blockSize, data.m_sharedRead);
+            readRequest->SetCompletionCallback(AZStd::move(copyAndStoreBlock));
+            m_next->QueueRequest(readRequest);
+        }
+
+        void DiskCache::ServeHit(const PendingHit& hit)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            Slot& slot = m_slots[hit.m_slot];
+            AZ_Assert(slot.m_numReaders > 0, "Slot %u in the disk cache is being read but wasn't marked as having a reader.", hit.m_slot);
+            slot.m_numReaders--;
+
+            bool isRead;
+            {
+                TIMED_AVERAGE_WINDOW_SCOPE(m_cacheReadTimeAverage);
+                m_dataFile.Seek(aznumeric_cast<u64>(hit.m_slot) * m_blockSize + hit.m_blockOffset, SystemFile::SF_SEEK_BEGIN);
+                isRead = m_dataFile.Read(hit.m_copySize, hit.m_output) == hit.m_copySize;
+            }
+
+            if (!isRead)
+            {
+                // The cache couldn't be read, so remove the block and fall back to reading from the original file.
+                AZ_Warning("Streamer", false, "Unable to read block %u from the disk cache at '%s'.", hit.m_slot, m_dataFilePath.c_str());
+                if (slot.m_state == SlotState::Used)
+                {
+                    ReleaseSlot(hit.m_slot);
+                }
+
+                FileRequest* parent = hit.m_wait->GetParent();
+                AZ_Assert(parent, "Wait request in the disk cache doesn't have a parent.");
+                auto& data = AZStd::get<FileRequest::ReadData>(parent->GetCommand());
+                FileRequest* readRequest = m_context->GetNewInternalRequest();
+                readRequest->CreateRead(parent, hit.m_output, hit.m_copySize, data.m_path, hit.m_sourceOffset, hit.m_copySize,
+                    data.m_sharedRead);
+                m_next->QueueRequest(readRequest);
+            }
+
+            hit.m_wait->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(hit.m_wait);
+        }
+
+        u32 DiskCache::VerifyFile(const RequestPath& path)
+        {
+            const char* absolutePath = path.GetAbsolutePath();
+
+            u32 fileIndex;
+            auto it = m_fileLookup.find(absolutePath);
+            if (it != m_fileLookup.end())
+            {
+                fileIndex = it->second;
+            }
+            else
+            {
+                fileIndex = aznumeric_caster(m_files.size());
+                CachedFile file;
+                file.m_path = absolutePath;
+                m_fileLookup.emplace(file.m_path, fileIndex);
+                m_files.push_back(AZStd::move(file));
+            }
+
+            CachedFile& file = m_files[fileIndex];
+            if (!file.m_verified)
+            {
+                // Only check the file once per run as the files that are read by the streamer aren't expected to change while
+                // running. Flushing a file from the cache will cause it to be checked again.
+                u64 modificationTime = SystemFile::ModificationTime(absolutePath);
+                u64 fileSize = SystemFile::Length(absolutePath);
+                if (file.m_modificationTime != modificationTime || file.m_fileSize != fileSize)
+                {
+                    FlushFile(fileIndex);
+                    file.m_modificationTime = modificationTime;
+                    file.m_fileSize = fileSize;
+                }
+                file.m_verified = true;
+            }
+            // Files that don't exist on disk, for instance because they're in an archive, have no modification time and
+            // can't be reliably cached.
+            return (file.m_modificationTime != 0 && file.m_fileSize != 0) ? fileIndex : s_invalidIndex;
+        }
+
+        u32 DiskCache::FindBlock(u32 fileIndex, u64 blockIndex) const
+        {
+            auto it = m_blockLookup.find(BlockKey{ blockIndex, fileIndex });
+            return it != m_blockLookup.end() ? it->second : s_invalidIndex;
+        }
+
+        void DiskCache::StoreBlock(u32 fileIndex, u64 blockIndex, const u8* data, u32 size)
+        {
+            if (FindBlock(fileIndex, blockIndex) != s_invalidIndex)
+            {
+                // Another read already stored this block.
+                return;
+            }
+
+            u32 slotIndex = AllocateSlot();
+            if (slotIndex == s_invalidIndex)
+            {
+                return;
+            }
+
+            m_dataFile.Seek(aznumeric_cast<u64>(slotIndex) * m_blockSize, SystemFile::SF_SEEK_BEGIN);
+            if (m_dataFile.Write(data, size) != size)
+            {
+                AZ_Warning("Streamer", false, "Unable to write to the disk cache at '%s'.", m_dataFilePath.c_str());
+                // The slot isn't referenced by any index so it can be reused immediately.
+                m_freeSlots.push_back(slotIndex);
+                return;
+            }
+
+            Slot& slot = m_slots[slotIndex];
+            slot.m_blockIndex = blockIndex;
+            slot.m_fileIndex = fileIndex;
+            slot.m_size = size;
+            slot.m_state = SlotState::Used;
+            slot.m_lruPosition = m_lru.insert(m_lru.end(), slotIndex);
+            m_blockLookup.emplace(BlockKey{ blockIndex, fileIndex }, slotIndex);
+            m_files[fileIndex].m_numBlocks++;
+
+            m_bytesWritten += size;
+            m_numUnsavedChanges++;
+        }
+
+        u32 DiskCache::AllocateSlot()
+        {
+            if (m_freeSlots.empty())
+            {
+                EvictBlocks();
+                if (m_freeSlots.empty())
+                {
+                    return s_invalidIndex;
+                }
+            }
+            u32 slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return slot;
+        }
+
+        void DiskCache::EvictBlocks()
+        {
+            // Evict blocks in batches as every eviction requires the index to be written before the slots can be reused.
+            u32 numToEvict = AZStd::max(m_numSlots / 16, 1u);
+            auto it = m_lru.begin();
+            while (numToEvict > 0 && it != m_lru.end())
+            {
+                u32 slot = *it;
+                ++it;
+                if (m_slots[slot].m_numReaders == 0)
+                {
+                    ReleaseSlot(slot);
+                    numToEvict--;
+                }
+            }
+            SaveIndex();
+        }
+
+        void DiskCache::ReleaseSlot(u32 slotIndex)
+        {
+            Slot& slot = m_slots[slotIndex];
+            AZ_Assert(slot.m_state == SlotState::Used, "Releasing slot %u in the disk cache that isn't in use.", slotIndex);
+            m_lru.erase(slot.m_lruPosition);
+            m_blockLookup.erase(BlockKey{ slot.m_blockIndex, slot.m_fileIndex });
+            m_files[slot.m_fileIndex].m_numBlocks--;
+            slot.m_state = SlotState::PendingFree;
+            m_pendingFreeSlots.push_back(slotIndex);
+            m_numUnsavedChanges++;
+        }
+
+        void DiskCache::TouchSlot(u32 slot)
+        {
+            m_lru.splice(m_lru.end(), m_lru, m_slots[slot].m_lruPosition);
+        }
+
+        void DiskCache::FlushCache(const RequestPath& filePath)
+        {
+            if (m_isOpen)
+            {
+                auto it = m_fileLookup.find(filePath.GetAbsolutePath());
+                if (it != m_fileLookup.end())
+                {
+                    FlushFile(it->second);
+                }
+            }
+        }
+
+        void DiskCache::FlushFile(u32 fileIndex)
+        {
+            CachedFile& file = m_files[fileIndex];
+            if (file.m_numBlocks > 0)
+            {
+                for (u32 i = 0; i < m_numSlots; ++i)
+                {
+                    if (m_slots[i].m_state == SlotState::Used && m_slots[i].m_fileIndex == fileIndex)
+                    {
+                        ReleaseSlot(i);
+                    }
+                }
+            }
+            file.m_generation++;
+            file.m_verified = false;
+        }
+
+        void DiskCache::FlushEntireCache()
+        {
+            if (m_isOpen)
+            {
+                for (u32 i = 0; i < m_files.size(); ++i)
+                {
+                    FlushFile(i);
+                }
+                SaveIndex();
+            }
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct DiskCacheConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::DiskCacheConfig, "{A3C1D7E4-2B6F-4F0A-8E19-6D4B2C7F9A31}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(DiskCacheConfig, AZ::SystemAllocator, 0);
+
+            ~DiskCacheConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The folder the cache files are stored in. This can contain aliases such as "@user@". If left empty the disk cache
+            //! is not added to the streaming stack.
+            AZStd::string m_cachePath;
+            //! The maximum size the cache can take up on disk in megabytes.
+            u32 m_cacheSizeMib{ 1024 };
+            //! The size of the individual blocks inside the cache.
+            BlockCacheConfig::BlockSize m_blockSize{ BlockCacheConfig::BlockSize::MaxTransfer };
+        };
+
+        //! Entry in the streaming stack that keeps a persistent cache of recently read blocks on a fast local disk, so data
+        //! from slow or large archives doesn't have to be read from the original file again in following runs.
+        //! Blocks are stored in fixed size slots in a single data file and are identified by the file path and the block
+        //! index. The modification time and size of every file are recorded and if either changed the blocks for that file
+        //! are discarded. The least recently used blocks are evicted when the cache is full.
+        //! The list of cached blocks is stored in a separate index file, which is replaced as a whole, and slots of evicted
+        //! blocks are only reused once an index without them has been written. This guarantees that the index never
+        //! references a slot with different data than it recorded, even if the application terminates unexpectedly.
+        //! The cache is intended for a fast local drive, so reads from and writes to the cache are done directly on the
+        //! streaming thread, one block at a time.
+        class DiskCache
+            : public StreamStackEntry
+        {
+        public:
+            DiskCache(AZStd::string cachePath, u64 cacheSize, u32 blockSize);
+            ~DiskCache() override;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+            //! Writes the index file if there are any changes that haven't been stored yet.
+            void SaveIndex();
+
+            u32 GetNumCachedBlocks() const;
+
+        private:
+            static constexpr u32 s_invalidIndex = AZStd::numeric_limits<u32>::max();
+            static constexpr u32 s_maxUnsavedChanges = 64;
+
+            enum class SlotState : u8
+            {
+                Free,
+                Used,
+                PendingFree //!< Evicted but possibly still in the stored index, so can't be reused until the index is saved.
+            };
+
+            struct Slot
+            {
+                AZStd::list<u32>::iterator m_lruPosition;
+                u64 m_blockIndex{ 0 };
+                u32 m_fileIndex{ 0 };
+                u32 m_size{ 0 }; //!< Size of the data in the block. Only the last block of a file can be smaller than the block size.
+                u32 m_numReaders{ 0 }; //!< Number of reads from the cache that are waiting to be processed.
+                SlotState m_state{ SlotState::Free };
+            };
+
+            struct CachedFile
+            {
+                AZStd::string m_path;
+                u64 m_modificationTime{ 0 };
+                u64 m_fileSize{ 0 };
+                u32 m_numBlocks{ 0 };
+                //! Incremented every time the cached blocks of the file are discarded, so reads that were started before
+                //! don't store outdated data.
+                u32 m_generation{ 0 };
+                bool m_verified{ false }; //!< Whether or not the modification time and size have been checked during this run.
+            };
+
+            struct BlockKey
+            {
+                bool operator==(const BlockKey& rhs) const;
+
+                u64 m_blockIndex;
+                u32 m_fileIndex;
+            };
+
+            struct BlockKeyHasher
+            {
+                size_t operator()(const BlockKey& key) const;
+            };
+
+            //! A section of a read that's served from the cache.
+            struct PendingHit
+            {
+                FileRequest* m_wait{ nullptr };
+                u8* m_output{ nullptr };
+                u64 m_sourceOffset{ 0 }; //!< Offset in the original file, used if the cache can't be read.
+                u64 m_copySize{ 0 };
+                u32 m_blockOffset{ 0 };
+                u32 m_slot{ 0 };
+            };
+
+            bool OpenCache();
+            void LoadIndex();
+            void ResetCache();
+
+            void ReadFile(FileRequest* request, FileRequest::ReadData& data);
+            void ReadFromSource(FileRequest* request, FileRequest::ReadData& data, u32 fileIndex, u64 firstBlock, u64 endBlock);
+            void ReadPartialBlock(FileRequest* request, FileRequest::ReadData& data, u32 fileIndex, u64 blockIndex,
+                u8* output, u32 blockOffset, u64 copySize);
+            void ServeHit(const PendingHit& hit);
+
+            //! Returns the index of the file in the cache if the file can be cached, otherwise s_invalidIndex.
+            u32 VerifyFile(const RequestPath& path);
+            u32 FindBlock(u32 fileIndex, u64 blockIndex) const;
+            void StoreBlock(u32 fileIndex, u64 blockIndex, const u8* data, u32 size);
+            u32 AllocateSlot();
+            void EvictBlocks();
+            void ReleaseSlot(u32 slot);
+            void TouchSlot(u32 slot);
+
+            void FlushCache(const RequestPath& filePath);
+            void FlushFile(u32 fileIndex);
+            void FlushEntireCache();
+
+            AZStd::string m_cachePath;
+            AZStd::string m_dataFilePath;
+            AZStd::string m_indexFilePath;
+            SystemFile m_dataFile;
+
+            AZStd::unique_ptr<Slot[]> m_slots;
+            AZStd::unordered_map<BlockKey, u32, BlockKeyHasher> m_blockLookup;
+            AZStd::unordered_map<AZStd::string, u32> m_fileLookup;
+            AZStd::vector<CachedFile> m_files;
+            AZStd::vector<u32> m_freeSlots;
+            AZStd::vector<u32> m_pendingFreeSlots;
+            //! Slots ordered from least to most recently used.
+            AZStd::list<u32> m_lru;
+            AZStd::deque<PendingHit> m_pendingHits;
+
+            AZ::Statistics::RunningStatistic m_hitRateStat;
+            TimedAverageWindow<s_statisticsWindowSize> m_cacheReadTimeAverage;
+            u64 m_bytesWritten{ 0 };
+
+            u32 m_blockSize{ 0 };
+            u32 m_numSlots{ 0 };
+            u32 m_numUnsavedChanges{ 0 };
+            bool m_isOpen{ false };
+            bool m_isDisabled{ false };
+        };
+    } // namespace IO
+} // namespace AZ
@@ -288,7 +288,8 @@ namespace AZ
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const
         {
             auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
-            if (data)
+            // Files that are compressed in blocks are decompressed and estimated by the BlockDecompressor.
+            if (data && !data->m_compressionInfo.m_blockTable)
             {
                 AZStd::chrono::microseconds processingTime = decompressionDelay;
                 size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
@@ -7,6 +7,8 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/sort.h>
 
@@ -120,6 +122,11 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreateFloat(SchedulerName, "Processing speed (avg. mbps)", m_processingSpeedStat.CalculateAverage()));
         statistics.push_back(Statistic::CreatePercentage(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetAverage()));
 #endif
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, "Reads before merging", aznumeric_caster(m_numReadsBeforeMerging)));
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, "Reads after merging", aznumeric_caster(m_numReadsAfterMerging)));
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, "Duplicate reads", aznumeric_caster(m_numDuplicateReads)));
+        statistics.push_back(Statistic::CreateFloat(SchedulerName, "Bytes saved by merging (MB)",
+            aznumeric_cast<double>(m_mergeBytesSaved) / 1_mib));
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
@@ -225,28 +232,21 @@ namespace AZ::IO
                 size_t size = parentReadRequest->m_size;
                 if (parentReadRequest->m_output == nullptr)
                 {
-                    AZ_Assert(parentReadRequest->m_allocator,
-                        "The read request was issued without a memory allocator or valid output address.");
                     u64 recommendedSize = size;
                     if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                     {
                         recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
                     }
-                    IStreamerTypes::RequestMemoryAllocatorResult allocation =
-                        parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
-                    if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
+                    if (!Thread_AllocateOutput(*parentReadRequest, recommendedSize))
                     {
                         next->SetStatus(IStreamerTypes::RequestStatus::Failed);
                         m_context.MarkRequestAsCompleted(next);
                         return;
                     }
-                    parentReadRequest->m_output = allocation.m_address;
-                    parentReadRequest->m_outputSize = allocation.m_size;
-                    parentReadRequest->m_memoryType = allocation.m_type;
                     if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                     {
                         args.m_output = parentReadRequest->m_output;
-                        args.m_outputSize = allocation.m_size;
+                        args.m_outputSize = parentReadRequest->m_outputSize;
                     }
                     else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                     {
@@ -261,12 +261,15 @@ namespace AZ::IO
                 }
 #endif
                 
+                FileRequest* queuedRequest = next;
                 if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                 {
-                    m_threadData.m_lastFilePath = args.m_path;
-                    m_threadData.m_lastFileOffset = args.m_offset + args.m_size;
+                    queuedRequest = Thread_MergeReads(next, args);
+                    auto& queuedRead = AZStd::get<FileRequest::ReadData>(queuedRequest->GetCommand());
+                    m_threadData.m_lastFilePath = queuedRead.m_path;
+                    m_threadData.m_lastFileOffset = queuedRead.m_offset + queuedRead.m_size;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
-                    m_processingSize += args.m_size;
+                    m_processingSize += queuedRead.m_size;
 #endif
                 }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
@@ -280,7 +283,7 @@ namespace AZ::IO
                 }
                 AZ_PROFILE_INTERVAL_START_COLORED(AZ::Debug::ProfileCategory::AzCore, next, ProfilerColor,
                     "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
-                m_threadData.m_streamStack->QueueRequest(next);
+                m_threadData.m_streamStack->QueueRequest(queuedRequest);
             }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
             {
@@ -309,6 +312,215 @@ namespace AZ::IO
         }, next->GetCommand());
     }
 
+    bool Scheduler::Thread_AllocateOutput(FileRequest::ReadRequestData& readRequest, u64 recommendedSize)
+    {
+        AZ_Assert(readRequest.m_allocator, "The read request was issued without a memory allocator or valid output address.");
+        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+            readRequest.m_allocator->Allocate(readRequest.m_size, recommendedSize, m_recommendations.m_memoryAlignment);
+        if (allocation.m_address == nullptr || allocation.m_size < readRequest.m_size)
+        {
+            return false;
+        }
+        readRequest.m_output = allocation.m_address;
+        readRequest.m_outputSize = allocation.m_size;
+        readRequest.m_memoryType = allocation.m_type;
+        return true;
+    }
+
+    FileRequest* Scheduler::Thread_MergeReads(FileRequest* read, FileRequest::ReadData& data)
+    {
+        m_numReadsBeforeMerging++;
+        m_numReadsAfterMerging++;
+
+        StreamerContext::PreparedQueue& pendingQueue = m_context.GetPreparedRequests();
+        if (pendingQueue.empty() || data.m_size == 0)
+        {
+            return read;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        // Collect all pending reads from the same file. The read that's about to be queued is the most important one, so any reads
+        // that are combined with it will be read sooner than scheduled, which keeps their deadlines intact.
+        AZStd::vector<MergeCandidate>& candidates = m_threadData.m_mergeCandidates;
+        candidates.clear();
+        candidates.push_back(MergeCandidate{ read, nullptr, data.m_offset, data.m_size });
+        for (FileRequest* pending : pendingQueue)
+        {
+            auto pendingRead = AZStd::get_if<FileRequest::ReadData>(&pending->GetCommand());
+            if (pendingRead && pendingRead->m_size > 0 && pendingRead->m_sharedRead == data.m_sharedRead &&
+                pendingRead->m_path == data.m_path && pending->GetCommandFromChain<FileRequest::ReadRequestData>() != nullptr)
+            {
+                candidates.push_back(MergeCandidate{ pending, nullptr, pendingRead->m_offset, pendingRead->m_size });
+            }
+        }
+        if (candidates.size() == 1)
+        {
+            return read;
+        }
+
+        // Order by offset and put the largest read first if reads start at the same offset, so exact duplicates end up next to
+        // each other.
+        AZStd::sort(candidates.begin(), candidates.end(),
+            [](const MergeCandidate& lhs, const MergeCandidate& rhs)
+            {
+                return lhs.m_offset != rhs.m_offset ? lhs.m_offset < rhs.m_offset : lhs.m_size > rhs.m_size;
+            });
+
+        // Find the group of reads that contains the queued read and together form a continuous section of the file. The section is
+        // limited to the size the drive can read in one go so merged reads don't take so long that other deadlines are missed.
+        const u64 maxMergedSize = AZStd::max(m_recommendations.m_granularity, data.m_size);
+        size_t groupBegin = 0;
+        size_t groupEnd = 1;
+        u64 mergedOffset = candidates[0].m_offset;
+        u64 mergedEnd = candidates[0].m_offset + candidates[0].m_size;
+        bool containsRead = candidates[0].m_request == read;
+        for (size_t i = 1; i < candidates.size(); ++i)
+        {
+            const MergeCandidate& candidate = candidates[i];
+            u64 candidateEnd = candidate.m_offset + candidate.m_size;
+            u64 extendedEnd = AZStd::max(mergedEnd, candidateEnd);
+            if (candidate.m_offset <= mergedEnd && extendedEnd - mergedOffset <= maxMergedSize)
+            {
+                mergedEnd = extendedEnd;
+            }
+            else if (containsRead)
+            {
+                break;
+            }
+            else
+            {
+                groupBegin = i;
+                mergedOffset = candidate.m_offset;
+                mergedEnd = candidateEnd;
+            }
+            containsRead = containsRead || candidate.m_request == read;
+            groupEnd = i + 1;
+        }
+        if (groupEnd - groupBegin == 1)
+        {
+            return read;
+        }
+
+        // Make sure all reads have a buffer to receive the data in. Pending reads are moved to processing. They can still be canceled
+        // through the combined read, which is tracked until it completes.
+        const u64 mergedSize = mergedEnd - mergedOffset;
+        AZStd::vector<MergeCandidate> members;
+        members.reserve(groupEnd - groupBegin);
+        u8* directOutput = nullptr;
+        u64 requestedSize = 0;
+        AZStd::chrono::system_clock::time_point deadline = FileRequest::s_noDeadlineTime;
+        IStreamerTypes::Priority priority = IStreamerTypes::s_priorityLowest;
+        for (size_t i = groupBegin; i < groupEnd; ++i)
+        {
+            MergeCandidate member = candidates[i];
+            auto& memberData = AZStd::get<FileRequest::ReadData>(member.m_request->GetCommand());
+            auto parentReadRequest = member.m_request->GetCommandFromChain<FileRequest::ReadRequestData>();
+            if (member.m_request != read)
+            {
+                member.m_request->SetStatus(IStreamerTypes::RequestStatus::Processing);
+                if (parentReadRequest->m_output == nullptr)
+                {
+                    if (!Thread_AllocateOutput(*parentReadRequest,
+                        m_recommendations.CalculateRecommendedMemorySize(parentReadRequest->m_size, parentReadRequest->m_offset)))
+                    {
+                        member.m_request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                        m_context.MarkRequestAsCompleted(member.m_request);
+                        continue;
+                    }
+                    memberData.m_output = parentReadRequest->m_output;
+                    memberData.m_outputSize = parentReadRequest->m_outputSize;
+                }
+            }
+            member.m_output = reinterpret_cast<u8*>(memberData.m_output);
+            if (directOutput == nullptr && member.m_offset == mergedOffset && member.m_size == mergedSize)
+            {
+                directOutput = member.m_output;
+            }
+            if (!members.empty() && members.back().m_offset == member.m_offset && members.back().m_size == member.m_size)
+            {
+                m_numDuplicateReads++;
+            }
+            requestedSize += member.m_size;
+            deadline = AZStd::min(deadline, parentReadRequest->m_deadline);
+            priority = AZStd::max(priority, parentReadRequest->m_priority);
+            members.push_back(member);
+        }
+
+        // Remove the combined reads from the pending queue.
+        AZStd::sort(candidates.begin() + groupBegin, candidates.begin() + groupEnd,
+            [](const MergeCandidate& lhs, const MergeCandidate& rhs) { return lhs.m_request < rhs.m_request; });
+        auto groupStart = candidates.begin() + groupBegin;
+        auto groupStop = candidates.begin() + groupEnd;
+        pendingQueue.erase(AZStd::remove_if(pendingQueue.begin(), pendingQueue.end(),
+            [groupStart, groupStop](FileRequest* pending)
+            {
+                auto it = AZStd::lower_bound(groupStart, groupStop, pending,
+                    [](const MergeCandidate& candidate, FileRequest* request) { return candidate.m_request < request; });
+                return it != groupStop && it->m_request == pending;
+            }), pendingQueue.end());
+
+        m_numReadsBeforeMerging += members.size() - 1;
+        m_mergeBytesSaved += requestedSize > mergedSize ? requestedSize - mergedSize : 0;
+
+        // If one of the reads covers the entire section the data can be read directly into its buffer, otherwise a temporary buffer is
+        // needed to read into and the data is copied to the reads from there.
+        bool ownsBuffer = directOutput == nullptr;
+        u8* buffer = directOutput;
+        if (ownsBuffer)
+        {
+            buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                mergedSize, aznumeric_caster(m_recommendations.m_memoryAlignment), 0, "AZ::IO::Streamer Scheduler", __FILE__, __LINE__));
+        }
+
+        // The combined read is linked to a request of its own instead of to one of the reads, so canceling one of the reads doesn't
+        // cancel the others. The link carries the most urgent deadline and priority so the stream stack schedules the combined read
+        // for the read that needs it first.
+        MergedRead merged;
+        merged.m_link = m_context.GetNewExternalRequest();
+        merged.m_link->m_request.CreateReadRequest(read->GetCommandFromChain<FileRequest::ReadRequestData>()->m_path, buffer, mergedSize,
+            mergedOffset, mergedSize, deadline, priority);
+        FileRequest* linkRequest = m_context.GetNewInternalRequest();
+        linkRequest->CreateRequestLink(FileRequestPtr(merged.m_link));
+        merged.m_read = m_context.GetNewInternalRequest();
+        merged.m_read->CreateRead(&merged.m_link->m_request, buffer, mergedSize, data.m_path, mergedOffset, mergedSize, data.m_sharedRead);
+        merged.m_read->SetCompletionCallback(
+            [this, buffer, mergedOffset, mergedSize, ownsBuffer](FileRequest& request)
+            {
+                auto& mergedReads = m_threadData.m_mergedReads;
+                auto tracked = AZStd::find_if(mergedReads.begin(), mergedReads.end(),
+                    [&request](const MergedRead& entry) { return entry.m_read == &request; });
+                AZ_Assert(tracked != mergedReads.end(), "A combined read completed that isn't tracked by the scheduler.");
+
+                IStreamerTypes::RequestStatus status = request.GetStatus();
+                for (const MergeCandidate& member : tracked->m_members)
+                {
+                    // Canceled reads keep their status and don't receive any data, but aren't completed until now as the combined
+                    // read might still be writing to their buffer.
+                    if (member.m_request->GetStatus() != IStreamerTypes::RequestStatus::Canceled)
+                    {
+                        if (status == IStreamerTypes::RequestStatus::Completed && member.m_output != buffer)
+                        {
+                            memcpy(member.m_output, buffer + (member.m_offset - mergedOffset), member.m_size);
+                        }
+                        member.m_request->SetStatus(status);
+                    }
+                    m_context.MarkRequestAsCompleted(member.m_request);
+                }
+                mergedReads.erase(tracked);
+
+                if (ownsBuffer)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(
+                        buffer, mergedSize, aznumeric_caster(m_recommendations.m_memoryAlignment));
+                }
+            });
+        merged.m_members = AZStd::move(members);
+        FileRequest* mergedRead = merged.m_read;
+        m_threadData.m_mergedReads.push_back(AZStd::move(merged));
+        return mergedRead;
+    }
+
     bool Scheduler::Thread_ExecuteRequests()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
@@ -405,7 +617,31 @@ namespace AZ::IO
                 ++pendingIt;
             }
         }
-        
+
+        // Reads that have been combined can't be canceled individually as the other reads still need the combined read. Mark them as
+        // canceled so they don't receive any data and only cancel the combined read once all of its reads have been canceled.
+        for (MergedRead& merged : m_threadData.m_mergedReads)
+        {
+            if (merged.m_numCanceled == merged.m_members.size())
+            {
+                continue;
+            }
+            for (const MergeCandidate& member : merged.m_members)
+            {
+                if (member.m_request->GetStatus() != IStreamerTypes::RequestStatus::Canceled && member.m_request->WorksOn(data.m_target))
+                {
+                    member.m_request->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                    merged.m_numCanceled++;
+                }
+            }
+            if (merged.m_numCanceled == merged.m_members.size())
+            {
+                FileRequest* cancelMerged = m_context.GetNewInternalRequest();
+                cancelMerged->CreateCancel(merged.m_link);
+                m_threadData.m_streamStack->QueueRequest(cancelMerged);
+            }
+        }
+
         m_threadData.m_streamStack->QueueRequest(request);
     }
 
@@ -551,6 +787,16 @@ namespace AZ::IO
             pendingQueue.begin(), pendingQueue.end());
         m_threadData.m_internalPendingRequests.clear();
 
+        // The reads that have been combined complete when the combined read completes.
+        for (const MergedRead& merged : m_threadData.m_mergedReads)
+        {
+            AZStd::chrono::system_clock::time_point estimate = merged.m_read->GetEstimatedCompletion();
+            for (const MergeCandidate& member : merged.m_members)
+            {
+                member.m_request->SetEstimatedCompletion(estimate);
+            }
+        }
+
         if (m_context.GetNumPreparedRequests() > 1)
         {
             AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore,
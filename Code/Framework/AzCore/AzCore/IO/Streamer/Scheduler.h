@@ -57,6 +57,10 @@ namespace AZ::IO
 
         void Thread_MainLoop();
         void Thread_QueueNextRequest();
+        bool Thread_AllocateOutput(FileRequest::ReadRequestData& readRequest, u64 recommendedSize);
+        //! Combines the read with pending reads from the same file that overlap with or are adjacent to it into a single read.
+        //! Returns the request that needs to be queued, which is either the provided read or the combined read.
+        FileRequest* Thread_MergeReads(FileRequest* read, FileRequest::ReadData& data);
         bool Thread_ExecuteRequests();
         bool Thread_PrepareRequests(AZStd::vector<FileRequestPtr>& outstandingRequests);
         void Thread_ProcessTillIdle();
@@ -73,12 +77,38 @@ namespace AZ::IO
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
 
+        //! A read that's part of a combined read.
+        struct MergeCandidate final
+        {
+            FileRequest* m_request{ nullptr };
+            u8* m_output{ nullptr };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+        };
+
+        //! A read that combines several reads from the same file and is being processed by the stream stack.
+        struct MergedRead final
+        {
+            //! Request that links the combined read to the stream stack. It holds the earliest deadline and highest priority of
+            //! the combined reads and is used as the target to cancel the combined read.
+            FileRequestPtr m_link;
+            FileRequest* m_read{ nullptr }; //!< The combined read that's queued on the stream stack.
+            AZStd::vector<MergeCandidate> m_members; //!< The reads that receive data from the combined read.
+            size_t m_numCanceled{ 0 }; //!< Number of members that have been canceled.
+        };
+
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
         {
             //! Requests pending in the Streaming stack entries. Cached here so it doesn't need to allocate
             //! and free memory whenever scheduling happens.
             AZStd::vector<FileRequest*> m_internalPendingRequests;
+            //! Reads that are considered for merging. Cached here so it doesn't need to allocate and free memory
+            //! whenever a read is queued.
+            AZStd::vector<MergeCandidate> m_mergeCandidates;
+            //! Combined reads that haven't completed yet. Kept so the reads they combine can still be canceled and receive
+            //! completion estimates.
+            AZStd::vector<MergedRead> m_mergedReads;
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
@@ -89,6 +119,10 @@ namespace AZ::IO
         IStreamerTypes::Recommendations m_recommendations;
 
         StreamStackEntry::Status m_stackStatus;
+        u64 m_numReadsBeforeMerging{ 0 }; //!< Number of reads queued for processing.
+        u64 m_numReadsAfterMerging{ 0 }; //!< Number of reads sent to the stream stack after merging.
+        u64 m_numDuplicateReads{ 0 }; //!< Number of reads that requested the exact same data as another read.
+        u64 m_mergeBytesSaved{ 0 }; //!< Number of bytes that didn't need to be read because reads overlapped.
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::system_clock::time_point m_processingStartTime;
         size_t m_processingSize{ 0 };
@@ -11,7 +11,9 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
+#include <AzCore/IO/Streamer/DiskCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
@@ -190,7 +192,9 @@ namespace AZ
         }
 
         BlockCacheConfig::Reflect(context);
+        BlockDecompressorConfig::Reflect(context);
         DedicatedCacheConfig::Reflect(context);
+        DiskCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
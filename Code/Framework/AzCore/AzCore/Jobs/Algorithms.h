@@ -9,6 +9,9 @@
 
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/std/allocator_stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/std/parallel/spin_mutex.h>
 
@@ -686,6 +689,402 @@ namespace AZ
         parallel_for_each_start(start, end, function, dependent, auto_partitioner(), jobContext, allocator);
     }
 
+    namespace Internal
+    {
+        //! Blocks smaller than this are not worth a job, the parallel algorithms below run serially under it.
+        static const ParallelIndexType ParallelAlgorithmMinBlockSize = 1024;
+
+        /**
+         * Number of blocks the block based algorithms (reduce, scan, sort, partition) split numElements into. It
+         * follows the partitioner: one block per chunk, and with load balancing partitioners (auto_partitioner) a few
+         * blocks per chunk so the assisting jobs have something to balance.
+         */
+        template<class Partition>
+        inline ParallelIndexType GetNumParallelBlocks(ParallelIndexType numElements, const Partition& partition, JobContext* jobContext)
+        {
+            ParallelIndexType numBlocks = partition.GetNumChunks(numElements, jobContext);
+            if (Partition::s_isSpawnAssistJob)
+            {
+                numBlocks *= 4;
+            }
+            numBlocks = AZStd::GetMin(numBlocks, numElements / ParallelAlgorithmMinBlockSize);
+            return AZStd::GetMax(numBlocks, static_cast<ParallelIndexType>(1));
+        }
+
+        //! Runs function(blockIndex) for every block, blocks are already sized by the partitioner.
+        template<class Function, class Partition>
+        inline void ParallelForBlocks(ParallelIndexType numBlocks, const Function& function, const Partition&, JobContext* jobContext)
+        {
+            if (numBlocks == 1)
+            {
+                function(0);
+            }
+            else if (Partition::s_isSpawnAssistJob)
+            {
+                parallel_for(0, numBlocks, function, auto_partitioner(), jobContext);
+            }
+            else
+            {
+                parallel_for(0, numBlocks, function, static_partitioner(), jobContext);
+            }
+        }
+
+        //! Evenly splits numElements into numBlocks, returns the first element of the block (block == numBlocks returns numElements).
+        inline ParallelIndexType GetParallelBlockStart(ParallelIndexType block, ParallelIndexType numBlocks, ParallelIndexType numElements)
+        {
+            return static_cast<ParallelIndexType>((static_cast<AZ::s64>(block) * numElements) / numBlocks);
+        }
+
+        /**
+         * Merge path search: returns how many elements of [first1, first1 + size1) are in the first outputIndex
+         * elements of the merge of both (sorted) ranges. Ties take from the first range, so the merge is stable.
+         */
+        template<class RandomIterator, class Compare>
+        inline ParallelIndexType MergePathSplit(RandomIterator first1, ParallelIndexType size1, RandomIterator first2, ParallelIndexType size2,
+            ParallelIndexType outputIndex, const Compare& comp)
+        {
+            ParallelIndexType low = AZStd::GetMax(static_cast<ParallelIndexType>(0), outputIndex - size2);
+            ParallelIndexType high = AZStd::GetMin(outputIndex, size1);
+            while (low < high)
+            {
+                const ParallelIndexType mid = low + (high - low) / 2;
+                if (comp(first2[outputIndex - mid - 1], first1[mid]))
+                {
+                    high = mid;
+                }
+                else
+                {
+                    low = mid + 1;
+                }
+            }
+            return low;
+        }
+
+        template<class InputIterator, class OutputIterator, class Compare>
+        inline void MoveMerge(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2, OutputIterator result, const Compare& comp)
+        {
+            for (; first1 != last1 && first2 != last2; ++result)
+            {
+                if (comp(*first2, *first1))
+                {
+                    *result = AZStd::move(*first2);
+                    ++first2;
+                }
+                else
+                {
+                    *result = AZStd::move(*first1);
+                    ++first1;
+                }
+            }
+            for (; first1 != last1; ++first1, ++result)
+            {
+                *result = AZStd::move(*first1);
+            }
+            for (; first2 != last2; ++first2, ++result)
+            {
+                *result = AZStd::move(*first2);
+            }
+        }
+
+        /**
+         * One merge pass of parallel_sort, merges pairs of runs of runLength elements from source into destination.
+         * Each pair is merged by several blocks, every block finds its part of both runs with a merge path search so
+         * even the last pass (a single pair) uses all the workers.
+         */
+        template<class SourceIterator, class DestinationIterator, class Compare, class Partition>
+        inline void ParallelMergePass(SourceIterator source, DestinationIterator destination, ParallelIndexType numElements, ParallelIndexType runLength,
+            ParallelIndexType numBlocks, const Compare& comp, const Partition& partition, JobContext* jobContext)
+        {
+            const ParallelIndexType pairLength = runLength * 2;
+            const ParallelIndexType numPairs = (numElements + pairLength - 1) / pairLength;
+            const ParallelIndexType blocksPerPair = AZStd::GetMax(static_cast<ParallelIndexType>(1), numBlocks / numPairs);
+            auto mergeBlock = [&](ParallelIndexType blockIndex)
+            {
+                const ParallelIndexType pair = blockIndex / blocksPerPair;
+                const ParallelIndexType pairBlock = blockIndex % blocksPerPair;
+                const ParallelIndexType pairStart = pair * pairLength;
+                const ParallelIndexType size1 = AZStd::GetMin(runLength, numElements - pairStart);
+                const ParallelIndexType size2 = AZStd::GetMin(runLength, numElements - pairStart - size1);
+                const SourceIterator first1 = source + pairStart;
+                const SourceIterator first2 = first1 + size1;
+
+                const ParallelIndexType outputStart = GetParallelBlockStart(pairBlock, blocksPerPair, size1 + size2);
+                const ParallelIndexType outputEnd = GetParallelBlockStart(pairBlock + 1, blocksPerPair, size1 + size2);
+                const ParallelIndexType start1 = MergePathSplit(first1, size1, first2, size2, outputStart, comp);
+                const ParallelIndexType end1 = MergePathSplit(first1, size1, first2, size2, outputEnd, comp);
+                MoveMerge(first1 + start1, first1 + end1, first2 + (outputStart - start1), first2 + (outputEnd - end1),
+                    destination + (pairStart + outputStart), comp);
+            };
+            ParallelForBlocks(numPairs * blocksPerPair, mergeBlock, partition, jobContext);
+        }
+    }
+
+    /**
+     * Parallel reduction of [first, last) with an associative binary operation, returns op(init, first[0] op ... op first[n - 1]).
+     * The operation is applied in a different (but order preserving) grouping than a serial accumulate, so it must be
+     * associative, it doesn't need to be commutative. Blocks until the reduction is complete, like parallel_for.
+     */
+    template<class RandomIterator, class T, class BinaryOperation, class Partition>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements <= 0)
+        {
+            return init;
+        }
+
+        const Internal::ParallelIndexType numBlocks = Internal::GetNumParallelBlocks(numElements, partition, context);
+        AZStd::vector<T> blockResults(numBlocks);
+        Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+        {
+            RandomIterator blockFirst = first + Internal::GetParallelBlockStart(block, numBlocks, numElements);
+            RandomIterator blockLast = first + Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            T result = *blockFirst;
+            for (++blockFirst; blockFirst != blockLast; ++blockFirst)
+            {
+                result = op(result, *blockFirst);
+            }
+            blockResults[block] = AZStd::move(result);
+        }, partition, context);
+
+        for (T& blockResult : blockResults)
+        {
+            init = op(init, blockResult);
+        }
+        return init;
+    }
+
+    template<class RandomIterator, class T, class BinaryOperation>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, init, op, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class T>
+    T parallel_reduce(RandomIterator first, RandomIterator last, T init, JobContext* jobContext = nullptr)
+    {
+        return parallel_reduce(first, last, init, AZStd::plus<>(), auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel inclusive prefix scan, result[i] = first[0] op ... op first[i]. The operation must be associative.
+     * The output range can be the input range (in place scan). Works in two passes over the data: the first one
+     * reduces every block, the second one scans the blocks starting from the combined value of the previous blocks.
+     * Returns the end of the output range. Blocks until the scan is complete.
+     */
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation, class Partition>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result, const BinaryOperation& op,
+        const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements <= 0)
+        {
+            return result;
+        }
+
+        const Internal::ParallelIndexType numBlocks = Internal::GetNumParallelBlocks(numElements, partition, context);
+        auto scanBlock = [&](Internal::ParallelIndexType block, const value_type* carry)
+        {
+            const Internal::ParallelIndexType blockStart = Internal::GetParallelBlockStart(block, numBlocks, numElements);
+            const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            value_type sum = carry ? op(*carry, first[blockStart]) : value_type(first[blockStart]);
+            result[blockStart] = sum;
+            for (Internal::ParallelIndexType i = blockStart + 1; i < blockEnd; ++i)
+            {
+                sum = op(sum, first[i]);
+                result[i] = sum;
+            }
+        };
+
+        if (numBlocks == 1)
+        {
+            scanBlock(0, nullptr);
+            return result + numElements;
+        }
+
+        // the last block doesn't contribute to any carry, so it is not reduced
+        AZStd::vector<value_type> carries(numBlocks - 1);
+        Internal::ParallelForBlocks(numBlocks - 1, [&](Internal::ParallelIndexType block)
+        {
+            const Internal::ParallelIndexType blockStart = Internal::GetParallelBlockStart(block, numBlocks, numElements);
+            const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            value_type sum = first[blockStart];
+            for (Internal::ParallelIndexType i = blockStart + 1; i < blockEnd; ++i)
+            {
+                sum = op(sum, first[i]);
+            }
+            carries[block] = AZStd::move(sum);
+        }, partition, context);
+
+        for (size_t i = 1; i < carries.size(); ++i)
+        {
+            carries[i] = op(carries[i - 1], carries[i]);
+        }
+
+        Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+        {
+            scanBlock(block, block > 0 ? &carries[block - 1] : nullptr);
+        }, partition, context);
+        return result + numElements;
+    }
+
+    template<class RandomIterator, class OutputRandomIterator, class BinaryOperation>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result, const BinaryOperation& op, JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, result, op, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator, class OutputRandomIterator>
+    OutputRandomIterator parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputRandomIterator result, JobContext* jobContext = nullptr)
+    {
+        return parallel_inclusive_scan(first, last, result, AZStd::plus<>(), auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel merge sort. Every block is sorted with AZStd::sort, then the sorted runs are merged pairwise, each
+     * merge being split between the blocks, using a temporary buffer of the size of the range. Like AZStd::sort the
+     * sort is not stable. The value type must be default constructible and movable. Blocks until the sort is complete.
+     */
+    template<class RandomIterator, class Compare, class Partition>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        const Internal::ParallelIndexType numBlocks = numElements > 1 ? Internal::GetNumParallelBlocks(numElements, partition, context) : 1;
+        if (numBlocks == 1)
+        {
+            AZStd::sort(first, last, comp);
+            return;
+        }
+
+        // sort runs of equal length, so the merge passes can double the run length
+        const Internal::ParallelIndexType runLength = (numElements + numBlocks - 1) / numBlocks;
+        const Internal::ParallelIndexType numRuns = (numElements + runLength - 1) / runLength;
+        Internal::ParallelForBlocks(numRuns, [&](Internal::ParallelIndexType run)
+        {
+            RandomIterator runFirst = first + run * runLength;
+            AZStd::sort(runFirst, runFirst + AZStd::GetMin(runLength, numElements - run * runLength), comp);
+        }, partition, context);
+
+        AZStd::vector<value_type> buffer(numElements);
+        bool isInBuffer = false;
+        for (Internal::ParallelIndexType length = runLength; length < numElements; length *= 2)
+        {
+            if (isInBuffer)
+            {
+                Internal::ParallelMergePass(buffer.begin(), first, numElements, length, numBlocks, comp, partition, context);
+            }
+            else
+            {
+                Internal::ParallelMergePass(first, buffer.begin(), numElements, length, numBlocks, comp, partition, context);
+            }
+            isInBuffer = !isInBuffer;
+        }
+
+        if (isInBuffer)
+        {
+            Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+            {
+                const Internal::ParallelIndexType blockStart = Internal::GetParallelBlockStart(block, numBlocks, numElements);
+                const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+                AZStd::move(buffer.begin() + blockStart, buffer.begin() + blockEnd, first + blockStart);
+            }, partition, context);
+        }
+    }
+
+    template<class RandomIterator, class Compare>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, comp, auto_partitioner(), jobContext);
+    }
+
+    template<class RandomIterator>
+    void parallel_sort(RandomIterator first, RandomIterator last, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, AZStd::less<>(), auto_partitioner(), jobContext);
+    }
+
+    /**
+     * Parallel stable partition, moves the elements for which the predicate returns true before the others, keeping
+     * the relative order in both groups. Every block counts its matching elements, the counts are scanned to find where
+     * each block writes, then the blocks scatter their elements to a temporary buffer which is moved back. Returns the
+     * first element of the second group. Blocks until the partition is complete.
+     */
+    template<class RandomIterator, class Predicate, class Partition>
+    RandomIterator parallel_partition(RandomIterator first, RandomIterator last, const Predicate& pred, const Partition& partition, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        if (numElements <= 0)
+        {
+            return first;
+        }
+
+        const Internal::ParallelIndexType numBlocks = Internal::GetNumParallelBlocks(numElements, partition, context);
+        AZStd::vector<Internal::ParallelIndexType> numTrue(numBlocks + 1, 0);
+        Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+        {
+            const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            Internal::ParallelIndexType count = 0;
+            for (Internal::ParallelIndexType i = Internal::GetParallelBlockStart(block, numBlocks, numElements); i < blockEnd; ++i)
+            {
+                count += pred(first[i]) ? 1 : 0;
+            }
+            numTrue[block + 1] = count;
+        }, partition, context);
+
+        // numTrue[block] becomes the number of matching elements before the block
+        for (Internal::ParallelIndexType block = 1; block <= numBlocks; ++block)
+        {
+            numTrue[block] += numTrue[block - 1];
+        }
+        const Internal::ParallelIndexType totalTrue = numTrue[numBlocks];
+
+        AZStd::vector<value_type> buffer(numElements);
+        Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+        {
+            const Internal::ParallelIndexType blockStart = Internal::GetParallelBlockStart(block, numBlocks, numElements);
+            const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            Internal::ParallelIndexType trueIndex = numTrue[block];
+            Internal::ParallelIndexType falseIndex = totalTrue + (blockStart - numTrue[block]);
+            for (Internal::ParallelIndexType i = blockStart; i < blockEnd; ++i)
+            {
+                // the predicate is evaluated again instead of storing the flags, it's expected to be cheap
+                if (pred(first[i]))
+                {
+                    buffer[trueIndex++] = AZStd::move(first[i]);
+                }
+                else
+                {
+                    buffer[falseIndex++] = AZStd::move(first[i]);
+                }
+            }
+        }, partition, context);
+
+        Internal::ParallelForBlocks(numBlocks, [&](Internal::ParallelIndexType block)
+        {
+            const Internal::ParallelIndexType blockStart = Internal::GetParallelBlockStart(block, numBlocks, numElements);
+            const Internal::ParallelIndexType blockEnd = Internal::GetParallelBlockStart(block + 1, numBlocks, numElements);
+            AZStd::move(buffer.begin() + blockStart, buffer.begin() + blockEnd, first + blockStart);
+        }, partition, context);
+
+        return first + totalTrue;
+    }
+
+    template<class RandomIterator, class Predicate>
+    RandomIterator parallel_partition(RandomIterator first, RandomIterator last, const Predicate& pred, JobContext* jobContext = nullptr)
+    {
+        return parallel_partition(first, last, pred, auto_partitioner(), jobContext);
+    }
+
     /**
      * Invokes the specified functions in parallel and waits until they are all complete. Overloads for up to 8
      * function parameters are provided.
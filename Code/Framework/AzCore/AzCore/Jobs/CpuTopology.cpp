@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    const CpuTopology::LogicalCpu* CpuTopology::FindCpu(int cpuId) const
+    {
+        for (const LogicalCpu& cpu : m_cpus)
+        {
+            if (cpu.m_cpuId == cpuId)
+            {
+                return &cpu;
+            }
+        }
+        return nullptr;
+    }
+
+    AZStd::vector<int> CpuTopology::GetWorkerPlacementOrder() const
+    {
+        AZStd::vector<LogicalCpu> cpus = m_cpus;
+        AZStd::sort(cpus.begin(), cpus.end(), [](const LogicalCpu& lhs, const LogicalCpu& rhs)
+        {
+            if (lhs.m_numaNode != rhs.m_numaNode)
+            {
+                return lhs.m_numaNode < rhs.m_numaNode;
+            }
+            if (lhs.m_cacheDomain != rhs.m_cacheDomain)
+            {
+                return lhs.m_cacheDomain < rhs.m_cacheDomain;
+            }
+            return lhs.m_cpuId < rhs.m_cpuId;
+        });
+
+        // First pass takes the first logical CPU of every physical core, the second pass the remaining SMT siblings.
+        AZStd::vector<int> order;
+        order.reserve(cpus.size());
+        AZStd::vector<AZ::u8> placed(cpus.size(), 0);
+        for (size_t i = 0; i < cpus.size(); ++i)
+        {
+            bool coreUsed = false;
+            for (size_t j = 0; j < i && !coreUsed; ++j)
+            {
+                coreUsed = placed[j] && cpus[j].m_coreId == cpus[i].m_coreId && cpus[j].m_packageId == cpus[i].m_packageId
+                    && cpus[i].m_coreId != -1;
+            }
+            if (!coreUsed)
+            {
+                placed[i] = 1;
+                order.push_back(cpus[i].m_cpuId);
+            }
+        }
+        for (size_t i = 0; i < cpus.size(); ++i)
+        {
+            if (!placed[i])
+            {
+                order.push_back(cpus[i].m_cpuId);
+            }
+        }
+        return order;
+    }
+
+    CpuTopology CpuTopology::Query()
+    {
+        CpuTopology topology;
+        if (!Platform::QueryCpuTopology(topology))
+        {
+            topology.m_cpus.clear();
+        }
+        return topology;
+    }
+}
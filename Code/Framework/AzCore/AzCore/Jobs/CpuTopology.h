@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Description of the logical CPUs of the machine, used by the job manager for cache aware work stealing and for
+     * pinning worker threads to cores. Values are -1 when the platform doesn't report them.
+     */
+    struct CpuTopology
+    {
+        struct LogicalCpu
+        {
+            int m_cpuId = -1;       ///< Index of the logical CPU, the value used for JobManagerThreadDesc::m_cpuId.
+            int m_coreId = -1;      ///< Physical core, SMT siblings share it (unique within a package).
+            int m_packageId = -1;   ///< Socket.
+            int m_numaNode = -1;    ///< NUMA memory node.
+            int m_cacheDomain = -1; ///< Id of the last level cache shared by this CPU (lowest CPU id sharing it).
+        };
+
+        AZStd::vector<LogicalCpu> m_cpus;
+
+        bool IsValid() const { return !m_cpus.empty(); }
+
+        /// Returns the CPU with the given logical index, or nullptr if it's not part of the topology.
+        const LogicalCpu* FindCpu(int cpuId) const;
+
+        /**
+         * Returns logical CPU ids in the order worker threads should be placed on them: first one CPU per physical
+         * core, then the SMT siblings. Within each pass CPUs are grouped by NUMA node and cache domain, so consecutive
+         * workers share a last level cache.
+         */
+        AZStd::vector<int> GetWorkerPlacementOrder() const;
+
+        /// Queries the topology of the machine, returns an invalid topology on platforms without support.
+        static CpuTopology Query();
+    };
+
+    namespace Platform
+    {
+        /// Fills the topology from the OS, returns false if not supported on this platform.
+        bool QueryCpuTopology(CpuTopology& topology);
+
+        /// Returns the logical CPU the calling thread is currently running on, or -1 if not supported.
+        int GetCurrentCpu();
+    }
+}
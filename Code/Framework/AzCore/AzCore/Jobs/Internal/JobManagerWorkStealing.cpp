@@ -13,6 +13,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
 
 #include <AzCore/Debug/Profiler.h>
 
@@ -30,44 +31,92 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
 
 void WorkQueue::LocalInsert(Job* job)
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
+    if (job->GetPriority() == 0)
+    {
+        m_queue.PushBottom(job);
+        return;
+    }
+
+    LockGuard lock(m_prioritizedLock);
+    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_prioritizedQueue.begin(),
+                                                                                   m_prioritizedQueue.end(),
                                                                                    job->GetPriority(),
                                                                                    CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    m_prioritizedQueue.insert(locationToinsert, job);
+    m_numPrioritizedJobs.fetch_add(1, AZStd::memory_order_release);
 }
 
 Job* WorkQueue::LocalPopFront()
 {
-    LockGuard lock(m_lock);
+    Job* result = PopPrioritized(true);
+    if (!result)
+    {
+        result = m_queue.PopBottom();
+        if (!result)
+        {
+            result = PopPrioritized(false);
+        }
+    }
+    return result;
+}
+
+Job* WorkQueue::TryStealFront()
+{
+    Job* result = TryStealPrioritized(true);
+    if (!result)
+    {
+        result = m_queue.StealTop();
+        if (!result)
+        {
+            result = TryStealPrioritized(false);
+        }
+    }
+    return result;
+}
+
+Job* WorkQueue::PopPrioritized(bool higherPriority)
+{
+    // fast path, the prioritized queue is almost always empty
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    LockGuard lock(m_prioritizedLock);
 
     Job* result = nullptr;
-    if (!m_queue.empty())
+    if (!m_prioritizedQueue.empty() && ((m_prioritizedQueue.front()->GetPriority() > 0) == higherPriority))
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = m_prioritizedQueue.front();
+        m_prioritizedQueue.pop_front();
+        m_numPrioritizedJobs.fetch_sub(1, AZStd::memory_order_release);
     }
 
     return result;
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::TryStealPrioritized(bool higherPriority)
 {
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
     {
         // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        if (m_prioritizedLock.try_lock())
         {
             Job* result = nullptr;
-            if (!m_queue.empty())
+            if (!m_prioritizedQueue.empty() && ((m_prioritizedQueue.front()->GetPriority() > 0) == higherPriority))
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                result = m_prioritizedQueue.front();
+                m_prioritizedQueue.pop_front();
+                m_numPrioritizedJobs.fetch_sub(1, AZStd::memory_order_release);
             }
 
-            m_lock.unlock();
+            m_prioritizedLock.unlock();
             return result;
         }
 
@@ -82,6 +131,8 @@ AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_cu
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
+    , m_topology(desc.m_topologyAwareStealing ? CpuTopology::Query() : CpuTopology())
+    , m_topologyAwareStealing(desc.m_topologyAwareStealing && m_topology.IsValid())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
@@ -140,11 +191,17 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
             ++info->m_jobsDone;
 #endif
         }
+        return;
     }
-    else if (info && info->m_isWorker && (info->m_owningManager == this))
+
+#ifdef JOBMANAGER_ENABLE_STATS
+    job->m_queuedTime = AZStd::GetTimeNowTicks();
+#endif
+
+    if (info && info->m_isWorker && (info->m_owningManager == this))
     {
-        //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
+        //current thread is a worker, insert into the local queue of the job's priority class
+        info->m_pendingJobs[static_cast<unsigned int>(job->GetPriorityClass())].LocalInsert(job);
 #ifdef JOBMANAGER_ENABLE_STATS
         ++info->m_jobsForked;
 #endif
@@ -153,15 +210,11 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     }
     else
     {
-        //current thread is not a worker thread, insert into the global queue based on the job's priority
+        //current thread is not a worker thread, insert into the global queue of the job's priority class
         if (IsAsynchronous())
         {
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
+            InsertGlobalJob(job);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
             ActivateWorker();
@@ -170,11 +223,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         {
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                           m_globalJobQueue.end(),
-                                                                                           job->GetPriority(),
-                                                                                           CompareJobPriorities);
-                m_globalJobQueue.insert(locationToinsert, job);
+                InsertGlobalJob(job);
             }
 
             //no workers, so must process the jobs right now
@@ -192,6 +241,7 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
     AZ_Assert(info->m_currentJob == job, ("Can't suspend a job which isn't currently running"));
 
     info->m_currentJob = NULL; //clear current job
+    RecordTraceEvent(info, JobTraceEventType::Suspend, job);
 
     if (IsAsynchronous())
     {
@@ -202,6 +252,7 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
         ProcessJobsSynchronous(info, job, NULL);
     }
 
+    RecordTraceEvent(info, JobTraceEventType::Resume, job);
     info->m_currentJob = job; //restore current job
 }
 
@@ -243,8 +294,16 @@ void JobManagerWorkStealing::ClearStats()
         info->m_jobsForked = 0;
         info->m_jobsDone = 0;
         info->m_jobsStolen = 0;
+        info->m_stealAttempts = 0;
+        info->m_jobsStolenOutsideCacheDomain = 0;
         info->m_jobTime = 0;
         info->m_stealTime = 0;
+        for (unsigned int priorityClass = 0; priorityClass < NumPriorityClasses; ++priorityClass)
+        {
+            info->m_jobsStartedPerClass[priorityClass] = 0;
+            info->m_queueLatencyPerClass[priorityClass] = 0;
+            info->m_maxQueueLatencyPerClass[priorityClass] = 0;
+        }
     }
 #endif
 }
@@ -255,21 +314,149 @@ void JobManagerWorkStealing::PrintStats()
     char str[256];
     printf("===================================================\n");
     printf("Job System Stats:\n");
-    printf("Thread   Global jobs    Forks/dependents   Jobs done   Jobs stolen    Job time (ms)  Steal time (ms)  Total time (ms)\n");
-    printf("------   -------------  -----------------  ----------  ------------   -------------  ---------------  ---------------\n");
+    printf("Thread   Global jobs    Forks/dependents   Jobs done   Jobs stolen    Steal attempts   Remote steals   Job time (ms)  Steal time (ms)  Total time (ms)\n");
+    printf("------   -------------  -----------------  ----------  ------------   --------------   -------------   -------------  ---------------  ---------------\n");
     for (unsigned int i = 0; i < m_threads.size(); ++i)
     {
         ThreadInfo* info = m_threads[i];
         double jobTime = 1000.0f * static_cast<double>(info->m_jobTime) / AZStd::GetTimeTicksPerSecond();
         double stealTime = 1000.0f * static_cast<double>(info->m_stealTime) / AZStd::GetTimeTicksPerSecond();
-        azsnprintf(str, AZ_ARRAY_SIZE(str),  " %d:        %5d          %5d           %5d         %5d            %3.2f           %3.2f         %3.2f\n",
-            i, info->m_globalJobs, info->m_jobsForked, info->m_jobsDone, info->m_jobsStolen, jobTime, stealTime, jobTime + stealTime);
+        azsnprintf(str, AZ_ARRAY_SIZE(str),  " %d:        %5d          %5d           %5d         %5d          %7d          %7d            %3.2f           %3.2f         %3.2f\n",
+            i, info->m_globalJobs, info->m_jobsForked, info->m_jobsDone, info->m_jobsStolen, info->m_stealAttempts, info->m_jobsStolenOutsideCacheDomain, jobTime, stealTime, jobTime + stealTime);
+        printf(str);
+    }
+
+    static const char* priorityClassNames[NumPriorityClasses] = { "Critical", "Normal", "Background" };
+    printf("\nQueue latency (time from being queued to starting execution):\n");
+    printf("Class        Jobs started   Avg latency (ms)   Max latency (ms)\n");
+    printf("----------   ------------   ----------------   ----------------\n");
+    for (unsigned int priorityClass = 0; priorityClass < NumPriorityClasses; ++priorityClass)
+    {
+        u64 numJobs = 0;
+        u64 totalLatency = 0;
+        u64 maxLatency = 0;
+        for (ThreadInfo* info : m_threads)
+        {
+            numJobs += info->m_jobsStartedPerClass[priorityClass];
+            totalLatency += info->m_queueLatencyPerClass[priorityClass];
+            maxLatency = AZStd::GetMax(maxLatency, info->m_maxQueueLatencyPerClass[priorityClass]);
+        }
+        double avgLatency = numJobs ? 1000.0 * static_cast<double>(totalLatency) / (numJobs * AZStd::GetTimeTicksPerSecond()) : 0.0;
+        double maxLatencyMs = 1000.0 * static_cast<double>(maxLatency) / AZStd::GetTimeTicksPerSecond();
+        azsnprintf(str, AZ_ARRAY_SIZE(str), "%-10s   %12llu   %16.3f   %16.3f\n",
+            priorityClassNames[priorityClass], static_cast<unsigned long long>(numJobs), avgLatency, maxLatencyMs);
         printf(str);
     }
 #endif
 }
 
 
+JobTraceBuffer* JobManagerWorkStealing::GetOrCreateTraceBuffer(ThreadInfo* info)
+{
+    JobTraceBuffer* buffer = info->m_traceBuffer.load(AZStd::memory_order_relaxed);
+    if (!buffer)
+    {
+        //only the owning thread records to its buffer, publish it for ExportTrace
+        buffer = aznew JobTraceBuffer;
+        info->m_traceBuffer.store(buffer, AZStd::memory_order_release);
+    }
+    return buffer;
+}
+
+void JobManagerWorkStealing::ExportTrace(AZStd::string& output) const
+{
+    static const char* priorityClassNames[NumPriorityClasses] = { "Critical", "Normal", "Background" };
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+
+    AZStd::vector<AZStd::vector<JobTraceEvent>> threadEvents(m_threads.size());
+    AZStd::sys_time_t startTime = AZStd::numeric_limits<AZStd::sys_time_t>::max();
+    for (size_t i = 0; i < m_threads.size(); ++i)
+    {
+        if (const JobTraceBuffer* buffer = m_threads[i]->m_traceBuffer.load(AZStd::memory_order_acquire))
+        {
+            buffer->Read(threadEvents[i]);
+            if (!threadEvents[i].empty())
+            {
+                startTime = AZStd::GetMin(startTime, threadEvents[i].front().m_time);
+            }
+        }
+    }
+    const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+    char str[256];
+    output = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool isFirstEvent = true;
+    auto appendEvent = [&output, &isFirstEvent](const char* event)
+    {
+        if (!isFirstEvent)
+        {
+            output += ",\n";
+        }
+        isFirstEvent = false;
+        output += event;
+    };
+
+    for (size_t i = 0; i < m_threads.size(); ++i)
+    {
+        const ThreadInfo* info = m_threads[i];
+        if (info->m_isWorker)
+        {
+            azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":\"Job worker %u\"}}", i, info->m_workerId);
+        }
+        else
+        {
+            azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":\"User thread %zu\"}}", i, i - m_workerThreads.size());
+        }
+        appendEvent(str);
+
+        for (const JobTraceEvent& event : threadEvents[i])
+        {
+            const double timestamp = static_cast<double>(event.m_time - startTime) * microsecondsPerTick;
+            const unsigned long long job = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(event.m_job));
+            switch (event.m_type)
+            {
+            case JobTraceEventType::JobBegin:
+                azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"Job\",\"cat\":\"job\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%zu,\"args\":{\"job\":\"0x%llx\",\"class\":\"%s\"}}",
+                    timestamp, i, job, event.m_arg >= 0 && event.m_arg < static_cast<AZ::s32>(NumPriorityClasses) ? priorityClassNames[event.m_arg] : "Unknown");
+                break;
+            case JobTraceEventType::JobEnd:
+            case JobTraceEventType::Resume:
+            case JobTraceEventType::Wake:
+                azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"ph\":\"E\",\"ts\":%.3f,\"pid\":0,\"tid\":%zu}", timestamp, i);
+                break;
+            case JobTraceEventType::Steal:
+                azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"Steal\",\"cat\":\"steal\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":0,\"tid\":%zu,\"args\":{\"job\":\"0x%llx\",\"victim\":%d}}",
+                    timestamp, i, job, event.m_arg);
+                break;
+            case JobTraceEventType::Suspend:
+                azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"WaitForChildren\",\"cat\":\"job\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%zu,\"args\":{\"job\":\"0x%llx\"}}",
+                    timestamp, i, job);
+                break;
+            case JobTraceEventType::Sleep:
+                azsnprintf(str, AZ_ARRAY_SIZE(str), "{\"name\":\"Sleep\",\"cat\":\"worker\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%zu}", timestamp, i);
+                break;
+            default:
+                continue;
+            }
+            appendEvent(str);
+        }
+    }
+    output += "]}\n";
+}
+
+void JobManagerWorkStealing::ClearTrace()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+    for (ThreadInfo* info : m_threads)
+    {
+        if (JobTraceBuffer* buffer = info->m_traceBuffer.load(AZStd::memory_order_acquire))
+        {
+            buffer->Clear();
+        }
+    }
+}
+
 Job* JobManagerWorkStealing::GetCurrentJob() const
 {
     const ThreadInfo* info = m_currentThreadInfo;
@@ -305,6 +492,8 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
     //setup thread-local storage
     m_currentThreadInfo = info;
 
+    UpdateWorkerLocality(info);
+
     ProcessJobsInternal(info, NULL, NULL);
 
     m_currentThreadInfo = NULL;
@@ -324,8 +513,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 {
     AZ_Assert(IsAsynchronous(), "ProcessJobs is only to be used when we have worker threads (can be called on non-workers too though)");
 
-    //get thread local job queue
-    WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
+    //get thread local job queues
+    WorkQueue* pendingJobs = info->m_isWorker ? info->m_pendingJobs : nullptr;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
     while (true)
@@ -352,7 +541,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    if (IsGlobalQueueEmpty())
                     {
                         shouldSleep = true;
 
@@ -369,9 +558,14 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 if (shouldSleep)
                 {
                     //no available work, so go to sleep (or we have already been signaled by another thread and will acquire the semaphore but not actually sleep)
+                    RecordTraceEvent(info, JobTraceEventType::Sleep, nullptr);
                     info->m_waitEvent.acquire();
+                    RecordTraceEvent(info, JobTraceEventType::Wake, nullptr);
                     AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::JobManagerDetailed, info);
 
+                    //the OS may have moved us while we were asleep
+                    UpdateWorkerLocality(info);
+
                     if (m_quitRequested)
                     {
                         return;
@@ -386,24 +580,10 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
-#ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
-            }
         }
 
-        if (!job && pendingJobs)
-        {
-            //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
-        }
+        //take the highest priority class job from the global or local queues
+        job = PopJob(info, pendingJobs);
 
         bool isTerminated = false;
         while (!isTerminated)
@@ -415,7 +595,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             while (job)
             {
                 info->m_currentJob = job;
+                RecordTraceEvent(info, JobTraceEventType::JobBegin, job, static_cast<AZ::s32>(job->GetPriorityClass()));
                 Process(job);
+                RecordTraceEvent(info, JobTraceEventType::JobEnd, job);
                 info->m_currentJob = nullptr;
 
                 //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
@@ -429,19 +611,12 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
-                if (pendingJobs)
+                //pop a new job, a higher priority class job from the global queue takes precedence over the local queue
+                job = PopJob(info, pendingJobs);
+                if (job)
                 {
-                    job = pendingJobs->LocalPopFront();
-                    if (job)
-                    {
-                        // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
-                        ActivateWorker();
-                    }
-                }
-                else
-                {
-                    job = nullptr;
+                    // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
+                    ActivateWorker();
                 }
             }
 
@@ -469,17 +644,11 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
-
-                    //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    //attempt the steal, using the same victim as the previous successful steal if possible
+                    job = StealJob(info, m_workerThreads[victim]);
                     if (job)
                     {
                         //success, continue with the stolen job
-#ifdef JOBMANAGER_ENABLE_STATS
-                        ++info->m_jobsStolen;
-#endif
                         break;
                     }
 
@@ -499,12 +668,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    victim = SelectNextVictim(info, victim, numStealAttempts);
                 }
             }
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -521,13 +685,12 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    while (Job* job = PopJob(info, nullptr))
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop_front();
-
         info->m_currentJob = job;
+        RecordTraceEvent(info, JobTraceEventType::JobBegin, job, static_cast<AZ::s32>(job->GetPriorityClass()));
         Process(job);
+        RecordTraceEvent(info, JobTraceEventType::JobEnd, job);
         info->m_currentJob = NULL;
 
         //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
@@ -652,6 +815,17 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
 
         info->m_threadId = info->m_thread.get_id();
 
+        //pinned workers never move, so their locality is known up front
+        if (m_topologyAwareStealing && desc.m_cpuId >= 0)
+        {
+            if (const CpuTopology::LogicalCpu* cpu = m_topology.FindCpu(desc.m_cpuId))
+            {
+                info->m_isPinned = true;
+                info->m_cacheDomain.store(cpu->m_cacheDomain, AZStd::memory_order_relaxed);
+                info->m_numaNode.store(cpu->m_numaNode, AZStd::memory_order_relaxed);
+            }
+        }
+
         workerThreads[iThread] = info;
         m_threads.push_back(info);
     }
@@ -659,6 +833,182 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
+unsigned int JobManagerWorkStealing::GetFirstPriorityClass(ThreadInfo* info) const
+{
+    ++info->m_numJobPicks;
+    if ((info->m_numJobPicks % BackgroundStarvationInterval) == 0)
+    {
+        return static_cast<unsigned int>(JobPriorityClass::Background);
+    }
+    if ((info->m_numJobPicks % NormalStarvationInterval) == 0)
+    {
+        return static_cast<unsigned int>(JobPriorityClass::Normal);
+    }
+    return static_cast<unsigned int>(JobPriorityClass::Critical);
+}
+
+Job* JobManagerWorkStealing::PopJob(ThreadInfo* info, WorkQueue* pendingJobs)
+{
+    //the first class is usually Critical, but can be a lower class to avoid starvation. After that go through the
+    //remaining classes in priority order. Within a class the global queue is checked before the local queue, the
+    //counters let us skip the global lock when there is nothing there.
+    const unsigned int firstClass = GetFirstPriorityClass(info);
+    for (unsigned int i = 0; i <= NumPriorityClasses; ++i)
+    {
+        const unsigned int priorityClass = (i == 0) ? firstClass : i - 1;
+        if (i != 0 && priorityClass == firstClass)
+        {
+            continue;
+        }
+
+        Job* job = nullptr;
+        if (m_numGlobalJobs[priorityClass].load(AZStd::memory_order_acquire) > 0)
+        {
+            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+            job = PopGlobalJob(info, priorityClass);
+        }
+        if (!job && pendingJobs)
+        {
+            job = pendingJobs[priorityClass].LocalPopFront();
+        }
+        if (job)
+        {
+#ifdef JOBMANAGER_ENABLE_STATS
+            RecordQueueLatency(info, job);
+#endif
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+Job* JobManagerWorkStealing::PopGlobalJob([[maybe_unused]] ThreadInfo* info, unsigned int priorityClass)
+{
+    //must be called while holding m_globalJobQueueMutex
+    GlobalJobQueue& globalJobQueue = m_globalJobQueues[priorityClass];
+    if (globalJobQueue.empty())
+    {
+        return nullptr;
+    }
+
+    Job* job = globalJobQueue.front();
+    globalJobQueue.pop_front();
+    m_numGlobalJobs[priorityClass].fetch_sub(1, AZStd::memory_order_release);
+#ifdef JOBMANAGER_ENABLE_STATS
+    ++info->m_globalJobs;
+#endif
+    return job;
+}
+
+Job* JobManagerWorkStealing::StealJob(ThreadInfo* info, ThreadInfo* victim)
+{
+#ifdef JOBMANAGER_ENABLE_STATS
+    ++info->m_stealAttempts;
+#endif
+    for (unsigned int priorityClass = 0; priorityClass < NumPriorityClasses; ++priorityClass)
+    {
+        Job* job = victim->m_pendingJobs[priorityClass].TryStealFront();
+        if (job)
+        {
+#ifdef JOBMANAGER_ENABLE_STATS
+            ++info->m_jobsStolen;
+            if (m_topologyAwareStealing && info->m_cacheDomain.load(AZStd::memory_order_relaxed) != victim->m_cacheDomain.load(AZStd::memory_order_relaxed))
+            {
+                ++info->m_jobsStolenOutsideCacheDomain;
+            }
+            RecordQueueLatency(info, job);
+#endif
+            RecordTraceEvent(info, JobTraceEventType::Steal, job, static_cast<AZ::s32>(victim->m_workerId));
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobManagerWorkStealing::InsertGlobalJob(Job* job)
+{
+    //must be called while holding m_globalJobQueueMutex, jobs are sorted by their priority within the class queue
+    const unsigned int priorityClass = static_cast<unsigned int>(job->GetPriorityClass());
+    GlobalJobQueue& globalJobQueue = m_globalJobQueues[priorityClass];
+    const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(globalJobQueue.begin(),
+                                                                               globalJobQueue.end(),
+                                                                               job->GetPriority(),
+                                                                               CompareJobPriorities);
+    globalJobQueue.insert(locationToinsert, job);
+    m_numGlobalJobs[priorityClass].fetch_add(1, AZStd::memory_order_release);
+}
+
+bool JobManagerWorkStealing::IsGlobalQueueEmpty() const
+{
+    for (const GlobalJobQueue& globalJobQueue : m_globalJobQueues)
+    {
+        if (!globalJobQueue.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef JOBMANAGER_ENABLE_STATS
+void JobManagerWorkStealing::RecordQueueLatency(ThreadInfo* info, Job* job)
+{
+    const unsigned int priorityClass = static_cast<unsigned int>(job->GetPriorityClass());
+    const u64 latency = AZStd::GetTimeNowTicks() - job->m_queuedTime;
+    ++info->m_jobsStartedPerClass[priorityClass];
+    info->m_queueLatencyPerClass[priorityClass] += latency;
+    info->m_maxQueueLatencyPerClass[priorityClass] = AZStd::GetMax(info->m_maxQueueLatencyPerClass[priorityClass], latency);
+}
+#endif
+
+void JobManagerWorkStealing::UpdateWorkerLocality(ThreadInfo* info)
+{
+    if (!m_topologyAwareStealing || info->m_isPinned)
+    {
+        return;
+    }
+
+    if (const CpuTopology::LogicalCpu* cpu = m_topology.FindCpu(Platform::GetCurrentCpu()))
+    {
+        info->m_cacheDomain.store(cpu->m_cacheDomain, AZStd::memory_order_relaxed);
+        info->m_numaNode.store(cpu->m_numaNode, AZStd::memory_order_relaxed);
+    }
+}
+
+unsigned int JobManagerWorkStealing::SelectNextVictim(ThreadInfo* info, unsigned int victim, unsigned int numStealAttempts) const
+{
+    const unsigned int numWorkers = static_cast<unsigned int>(m_workerThreads.size());
+
+    //locality tiers: 0 - same last level cache, 1 - same NUMA node, 2 - any worker. Every tier gets one round of
+    //attempts over the workers before widening the search, the caller gives up after three rounds.
+    const unsigned int anyWorkerTier = 2;
+    unsigned int tier = m_topologyAwareStealing ? AZStd::GetMin(numStealAttempts / numWorkers, anyWorkerTier) : anyWorkerTier;
+    const int cacheDomain = info->m_cacheDomain.load(AZStd::memory_order_relaxed);
+    const int numaNode = info->m_numaNode.load(AZStd::memory_order_relaxed);
+
+    for (; tier <= anyWorkerTier; ++tier)
+    {
+        for (unsigned int offset = 1; offset <= numWorkers; ++offset)
+        {
+            const unsigned int candidate = (victim + offset) % numWorkers;
+            const ThreadInfo* candidateInfo = m_workerThreads[candidate];
+            if (candidateInfo == info)
+            {
+                //don't steal from ourselves
+                continue;
+            }
+
+            if ((tier == anyWorkerTier) ||
+                (tier == 0 && cacheDomain != -1 && candidateInfo->m_cacheDomain.load(AZStd::memory_order_relaxed) == cacheDomain) ||
+                (tier == 1 && numaNode != -1 && candidateInfo->m_numaNode.load(AZStd::memory_order_relaxed) == numaNode))
+            {
+                return candidate;
+            }
+        }
+    }
+    return victim;
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
@@ -10,10 +10,15 @@
 // Included directly from JobManager.h
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
+#include <AzCore/Jobs/Internal/JobTrace.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -26,6 +31,14 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue. Jobs with the default priority go into a lock-free Chase-Lev deque, so the owning worker
+         * never takes a lock to push or pop its own jobs and thieves only contend on a single CAS. Jobs with a non-default
+         * priority are rare, they are kept sorted in a small locked queue which is only checked when it is not empty:
+         * higher priority jobs are run before the deque, lower priority jobs after it.
+         * Note that the owner pops default priority jobs in LIFO order (the most recently forked job is the hottest in
+         * cache), while thieves take the oldest ones.
+         */
         class WorkQueue final
         {
         public:
@@ -41,8 +54,14 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            Job* PopPrioritized(bool higherPriority);
+            Job* TryStealPrioritized(bool higherPriority);
+
+            WorkStealingDeque<Job*> m_queue;
+
+            AZStd::deque<Job*> m_prioritizedQueue;
+            AZStd::atomic_uint m_numPrioritizedJobs{ 0 };
+            LockType m_prioritizedLock;
         };
 
         /**
@@ -79,13 +98,33 @@ namespace AZ
 
             AZ::u32 GetWorkerThreadId() const;
 
+            /// Enables or disables recording of job timeline events (job begin/end, steals, suspends, sleeps).
+            void SetTraceEnabled(bool enabled) { m_isTraceEnabled.store(enabled, AZStd::memory_order_relaxed); }
+            bool IsTraceEnabled() const { return m_isTraceEnabled.load(AZStd::memory_order_relaxed); }
+            /// Writes the recorded events in the Chrome trace event JSON format (chrome://tracing, ui.perfetto.dev).
+            void ExportTrace(AZStd::string& output) const;
+            /// Discards the recorded events.
+            void ClearTrace();
+
         private:
+            static const unsigned int NumPriorityClasses = static_cast<unsigned int>(JobPriorityClass::Count);
+
+            enum
+            {
+                // Starvation protection: every Nth job pick a thread starts looking for work at the lower class,
+                // so a constant stream of higher class jobs can only delay lower class jobs, not block them.
+                NormalStarvationInterval = 8,
+                BackgroundStarvationInterval = 32,
+            };
 
             void ActivateWorker();
 
             struct ThreadInfo
             {
-                AZ_CLASS_ALLOCATOR(ThreadInfo, ThreadPoolAllocator, 0)
+                // SystemAllocator as the work queue is cache line aligned and too big for the pool allocators
+                AZ_CLASS_ALLOCATOR(ThreadInfo, SystemAllocator, 0)
+
+                ~ThreadInfo() { delete m_traceBuffer.load(AZStd::memory_order_acquire); }
 
                 AZStd::thread::id m_threadId;
                 bool m_isWorker = false;
@@ -96,16 +135,29 @@ namespace AZ
                 AZStd::thread m_thread;
                 AZStd::atomic_bool m_isAvailable{false};
                 AZStd::binary_semaphore m_waitEvent;
-                WorkQueue m_pendingJobs;
+                WorkQueue m_pendingJobs[NumPriorityClasses]; //one local queue per JobPriorityClass
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                unsigned int m_numJobPicks = 0; //used for the starvation protection, only accessed by the owning thread
+                // locality of the worker for topology aware stealing, read by other workers when choosing a victim
+                AZStd::atomic_int m_cacheDomain{ -1 };
+                AZStd::atomic_int m_numaNode{ -1 };
+                bool m_isPinned = false;
+                // created by the owning thread the first time it records a trace event, read by ExportTrace
+                AZStd::atomic<JobTraceBuffer*> m_traceBuffer{ nullptr };
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
                 unsigned int m_jobsForked = 0;
                 unsigned int m_jobsDone = 0;
                 unsigned int m_jobsStolen = 0;
+                unsigned int m_stealAttempts = 0;
+                unsigned int m_jobsStolenOutsideCacheDomain = 0;
                 u64 m_jobTime = 0;
                 u64 m_stealTime = 0;
+                // time from being queued to starting execution, per JobPriorityClass
+                unsigned int m_jobsStartedPerClass[NumPriorityClasses] = {};
+                u64 m_queueLatencyPerClass[NumPriorityClasses] = {};
+                u64 m_maxQueueLatencyPerClass[NumPriorityClasses] = {};
 #endif
             };
             using ThreadList = AZStd::vector<ThreadInfo*>;
@@ -115,12 +167,32 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+            void UpdateWorkerLocality(ThreadInfo* info);
+            unsigned int SelectNextVictim(ThreadInfo* info, unsigned int victim, unsigned int numStealAttempts) const;
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
             ThreadInfo* FindCurrentThreadInfo() const;
             ThreadInfo* GetCurrentOrCreateThreadInfo();
 
+            unsigned int GetFirstPriorityClass(ThreadInfo* info) const;
+            Job* PopJob(ThreadInfo* info, WorkQueue* pendingJobs);
+            Job* PopGlobalJob(ThreadInfo* info, unsigned int priorityClass);
+            Job* StealJob(ThreadInfo* info, ThreadInfo* victim);
+            void InsertGlobalJob(Job* job);
+            bool IsGlobalQueueEmpty() const;
+#ifdef JOBMANAGER_ENABLE_STATS
+            void RecordQueueLatency(ThreadInfo* info, Job* job);
+#endif
+            AZ_FORCE_INLINE void RecordTraceEvent(ThreadInfo* info, JobTraceEventType type, const void* job, AZ::s32 arg = 0)
+            {
+                if (m_isTraceEnabled.load(AZStd::memory_order_relaxed))
+                {
+                    GetOrCreateTraceBuffer(info)->Record(type, job, arg);
+                }
+            }
+            JobTraceBuffer* GetOrCreateTraceBuffer(ThreadInfo* info);
+
             bool m_isAsynchronous;
 
             ThreadList m_threads;
@@ -128,16 +200,21 @@ namespace AZ
 
             AZStd::semaphore m_initSemaphore;
 
-            const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads and m_initSemaphore
+            const CpuTopology m_topology; //only queried when topology aware stealing is requested
+            const bool m_topologyAwareStealing;
+
+            const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads, m_initSemaphore and m_topology
 
             using GlobalJobQueue = AZStd::deque<Job*>;
             using GlobalQueueMutexType = AZStd::mutex;
 
-            GlobalJobQueue              m_globalJobQueue;
+            GlobalJobQueue              m_globalJobQueues[NumPriorityClasses]; //one global queue per JobPriorityClass
+            AZStd::atomic_uint          m_numGlobalJobs[NumPriorityClasses] = {}; //allows checking for global jobs without taking the lock
             GlobalQueueMutexType        m_globalJobQueueMutex;
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
+            AZStd::atomic_bool          m_isTraceEnabled{false};
 
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
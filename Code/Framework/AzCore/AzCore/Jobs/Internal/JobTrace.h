@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        enum class JobTraceEventType : AZ::u8
+        {
+            JobBegin,   ///< A job started processing, the argument is its JobPriorityClass.
+            JobEnd,     ///< The job finished processing.
+            Steal,      ///< A job was stolen, the argument is the worker id of the victim.
+            Suspend,    ///< The job waits for its children (WaitForChildren), other jobs run nested on the thread.
+            Resume,     ///< The suspended job continues.
+            Sleep,      ///< The worker ran out of work and goes to sleep.
+            Wake,       ///< The worker was woken up.
+        };
+
+        struct JobTraceEvent
+        {
+            AZStd::sys_time_t m_time;
+            const void* m_job;
+            AZ::s32 m_arg;
+            JobTraceEventType m_type;
+        };
+
+        /**
+         * Fixed size ring buffer of job trace events recorded by a single thread. Recording is wait-free: the owning
+         * thread writes the slot and publishes it by advancing the write index. When full the oldest events are
+         * overwritten. Any thread can read the buffer while it's recorded to, events the writer may have overwritten
+         * during the copy are discarded.
+         */
+        class JobTraceBuffer final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(JobTraceBuffer, SystemAllocator, 0)
+
+            static const AZ::u64 Capacity = 16 * 1024; // power of 2
+
+            /// Records an event, only the owning thread may call this.
+            void Record(JobTraceEventType type, const void* job, AZ::s32 arg)
+            {
+                const AZ::u64 index = m_writeIndex.load(AZStd::memory_order_relaxed);
+                JobTraceEvent& event = m_events[index & (Capacity - 1)];
+                event.m_time = AZStd::GetTimeNowTicks();
+                event.m_job = job;
+                event.m_arg = arg;
+                event.m_type = type;
+                m_writeIndex.store(index + 1, AZStd::memory_order_release);
+            }
+
+            /// Appends the events recorded since the last Clear, oldest first.
+            void Read(AZStd::vector<JobTraceEvent>& events) const
+            {
+                const AZ::u64 start = m_clearIndex.load(AZStd::memory_order_relaxed);
+                const AZ::u64 end = m_writeIndex.load(AZStd::memory_order_acquire);
+                AZ::u64 first = end > Capacity ? AZStd::GetMax(start, end - Capacity) : start;
+                const size_t offset = events.size();
+                for (AZ::u64 index = first; index < end; ++index)
+                {
+                    events.push_back(m_events[index & (Capacity - 1)]);
+                }
+
+                // drop what the writer may have overwritten while we were copying, including the slot at newEnd which
+                // the writer may be filling in right now
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                const AZ::u64 newEnd = m_writeIndex.load(AZStd::memory_order_relaxed);
+                if (newEnd >= Capacity && newEnd - Capacity + 1 > first)
+                {
+                    const AZ::u64 numOverwritten = AZStd::GetMin(newEnd - Capacity + 1, end) - first;
+                    events.erase(events.begin() + offset, events.begin() + offset + static_cast<size_t>(numOverwritten));
+                }
+            }
+
+            /// Forgets the recorded events, they won't be returned by Read anymore.
+            void Clear()
+            {
+                m_clearIndex.store(m_writeIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+            }
+
+        private:
+            AZStd::atomic<AZ::u64> m_writeIndex{ 0 };
+            AZStd::atomic<AZ::u64> m_clearIndex{ 0 };
+            JobTraceEvent m_events[Capacity];
+        };
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_pointer.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Lock-free Chase-Lev work-stealing deque of pointers.
+         * Only the owning thread may call PushBottom and PopBottom, any thread may call StealTop. The owner works in
+         * LIFO order at the bottom (best cache locality for freshly forked jobs) while thieves take the oldest entries
+         * from the top. The memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models"
+         * (Le, Pop, Cohen, Zappa Nardelli 2013).
+         *
+         * The ring buffer doubles in size when full. Retired buffers may still be read by a thief that raced with the
+         * resize, so they are kept alive until the deque is destroyed. As every buffer is twice the size of the previous
+         * one, the retired buffers never take more memory than the live buffer (bounded growth).
+         */
+        template<typename T>
+        class WorkStealingDeque final
+        {
+        public:
+            static_assert(AZStd::is_pointer<T>::value, "WorkStealingDeque only stores pointers");
+
+            static const AZ::s64 DefaultCapacity = 256;
+
+            explicit WorkStealingDeque(AZ::s64 initialCapacity = DefaultCapacity);
+            ~WorkStealingDeque();
+
+            /// Push a value at the bottom of the deque. Owner thread only.
+            void PushBottom(T value);
+            /// Pop the most recently pushed value. Owner thread only, returns nullptr if the deque is empty.
+            T PopBottom();
+            /// Take the oldest value from the deque. Can be called from any thread, returns nullptr if the deque is empty
+            /// or if another thread won the race for the last element.
+            T StealTop();
+
+            /// Approximate number of elements, exact only when called from the owner thread without concurrent steals.
+            AZ::s64 Size() const;
+            bool Empty() const { return Size() <= 0; }
+
+            /// Capacity of the current ring buffer, mostly useful for stats and tests.
+            AZ::s64 Capacity() const { return m_buffer.load(AZStd::memory_order_relaxed)->m_capacity; }
+
+        private:
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            struct RingBuffer
+            {
+                AZ::s64 m_capacity;
+                AZ::s64 m_mask;
+                RingBuffer* m_retired; ///< Previous (smaller) buffer, released when the deque is destroyed.
+                AZStd::atomic<T>* m_slots;
+
+                T Load(AZ::s64 index) const { return m_slots[index & m_mask].load(AZStd::memory_order_relaxed); }
+                void Store(AZ::s64 index, T value) { m_slots[index & m_mask].store(value, AZStd::memory_order_relaxed); }
+            };
+
+            static RingBuffer* CreateBuffer(AZ::s64 capacity, RingBuffer* retired);
+            static void DestroyBuffer(RingBuffer* buffer);
+            RingBuffer* Grow(RingBuffer* buffer, AZ::s64 bottom, AZ::s64 top);
+
+            // top and bottom are written by different threads, keep them on separate cache lines to avoid false sharing
+            alignas(64) AZStd::atomic<AZ::s64> m_top{ 0 };
+            alignas(64) AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            alignas(64) AZStd::atomic<RingBuffer*> m_buffer{ nullptr };
+        };
+
+        //============================================================================================================
+        //============================================================================================================
+        //============================================================================================================
+
+        template<typename T>
+        inline WorkStealingDeque<T>::WorkStealingDeque(AZ::s64 initialCapacity)
+        {
+            AZ_Assert(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "WorkStealingDeque capacity must be a power of 2");
+            m_buffer.store(CreateBuffer(initialCapacity, nullptr), AZStd::memory_order_relaxed);
+        }
+
+        template<typename T>
+        inline WorkStealingDeque<T>::~WorkStealingDeque()
+        {
+            RingBuffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+            while (buffer)
+            {
+                RingBuffer* retired = buffer->m_retired;
+                DestroyBuffer(buffer);
+                buffer = retired;
+            }
+        }
+
+        template<typename T>
+        inline void WorkStealingDeque<T>::PushBottom(T value)
+        {
+            const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+            RingBuffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+            if (bottom - top > buffer->m_capacity - 1)
+            {
+                buffer = Grow(buffer, bottom, top);
+            }
+            buffer->Store(bottom, value);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+
+        template<typename T>
+        inline T WorkStealingDeque<T>::PopBottom()
+        {
+            const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            RingBuffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+            T result = nullptr;
+            if (top <= bottom)
+            {
+                result = buffer->Load(bottom);
+                if (top == bottom)
+                {
+                    // last element, race against the thieves for it
+                    if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                    {
+                        result = nullptr;
+                    }
+                    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // deque was empty, restore bottom
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        template<typename T>
+        inline T WorkStealingDeque<T>::StealTop()
+        {
+            AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+            T result = nullptr;
+            if (top < bottom)
+            {
+                // acquire (instead of consume) pairs with the release store in Grow, so the copied slots are visible
+                RingBuffer* buffer = m_buffer.load(AZStd::memory_order_acquire);
+                result = buffer->Load(top);
+                if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    // lost the race against the owner or another thief
+                    result = nullptr;
+                }
+            }
+            return result;
+        }
+
+        template<typename T>
+        inline AZ::s64 WorkStealingDeque<T>::Size() const
+        {
+            const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            const AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+            return bottom - top;
+        }
+
+        template<typename T>
+        inline typename WorkStealingDeque<T>::RingBuffer* WorkStealingDeque<T>::CreateBuffer(AZ::s64 capacity, RingBuffer* retired)
+        {
+            void* memory = azmalloc(sizeof(RingBuffer) + sizeof(AZStd::atomic<T>) * capacity, alignof(RingBuffer), AZ::SystemAllocator, "WorkStealingDeque");
+            RingBuffer* buffer = new(memory) RingBuffer;
+            buffer->m_capacity = capacity;
+            buffer->m_mask = capacity - 1;
+            buffer->m_retired = retired;
+            buffer->m_slots = reinterpret_cast<AZStd::atomic<T>*>(buffer + 1);
+            for (AZ::s64 i = 0; i < capacity; ++i)
+            {
+                new(&buffer->m_slots[i]) AZStd::atomic<T>(nullptr);
+            }
+            return buffer;
+        }
+
+        template<typename T>
+        inline void WorkStealingDeque<T>::DestroyBuffer(RingBuffer* buffer)
+        {
+            // AZStd::atomic<T*> and RingBuffer are trivially destructible
+            azfree(buffer, AZ::SystemAllocator);
+        }
+
+        template<typename T>
+        inline typename WorkStealingDeque<T>::RingBuffer* WorkStealingDeque<T>::Grow(RingBuffer* buffer, AZ::s64 bottom, AZ::s64 top)
+        {
+            RingBuffer* newBuffer = CreateBuffer(buffer->m_capacity * 2, buffer);
+            for (AZ::s64 i = top; i < bottom; ++i)
+            {
+                newBuffer->Store(i, buffer->Load(i));
+            }
+            m_buffer.store(newBuffer, AZStd::memory_order_release);
+            return newBuffer;
+        }
+    }
+}
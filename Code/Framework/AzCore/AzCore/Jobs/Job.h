@@ -24,6 +24,7 @@ namespace AZ
     namespace Internal
     {
         class JobManagerBase;
+        class JobManagerWorkStealing;
     }
 
     /**
@@ -58,7 +59,8 @@ namespace AZ
          * isCompletion will allow the job to run when the dependent count is zero without being scheduled.
          * priority is used to sort jobs such that higher priority jobs are run before lower priority ones.
          *          The valid range is -128 (lowest priority) to 127 (highest priority), the default is 0,
-         *          and jobs with equal priority values will be run in the same order as added to the queue.
+         *          and jobs with equal priority values will be run in the same order as added to the queue. The exception
+         *          are default priority jobs forked from a worker thread, the worker runs those most recent first.
          */
         Job(bool isAutoDelete, JobContext* context, bool isCompletion = false, AZ::s8 priority = 0);
 
@@ -172,6 +174,16 @@ namespace AZ
          */
         AZ::s8 GetPriority() const;
 
+        /**
+         * Overrides the priority class inherited from the job context. Only valid before the job is started.
+         */
+        void SetPriorityClass(JobPriorityClass priorityClass);
+
+        /*
+         * Get the priority class of this job, see JobPriorityClass.
+         */
+        JobPriorityClass GetPriorityClass() const;
+
 #ifdef AZ_DEBUG_JOB_STATE
         int GetState() const    { return m_state; }
 #endif // AZ_DEBUG_JOB_STATE
@@ -229,6 +241,13 @@ namespace AZ
         AZStd::atomic<Job*> m_dependent; //job which is dependent on us, and will be notified when we complete
 #endif
 
+        JobPriorityClass m_priorityClass; //fits in the padding after the dependent count
+
+#ifdef JOBMANAGER_ENABLE_STATS
+        AZ::u64 m_queuedTime = 0; //time the job was added to a queue, used for the per priority class latency stats
+        friend class Internal::JobManagerWorkStealing;
+#endif
+
         //state is only really necessary for debugging... we could squeeze it into the dependent count member, but it
         //would require atomic ops to set/read it, so not really worth it.
         int m_state;
@@ -261,6 +280,7 @@ namespace AZ
         countAndFlags |= (unsigned int)((priority << FLAG_PRIORITY_START_BIT) & FLAG_PRIORITY_MASK);
         SetDependentCountAndFlags(countAndFlags);
         StoreDependent(NULL);
+        m_priorityClass = m_context->GetPriorityClass();
 
 #ifdef AZ_DEBUG_JOB_STATE
         SetState(STATE_SETUP);
@@ -497,6 +517,20 @@ namespace AZ
         return (GetDependentCountAndFlags() >> FLAG_PRIORITY_START_BIT) & 0xff;
     }
 
+    AZ_FORCE_INLINE void Job::SetPriorityClass(JobPriorityClass priorityClass)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "The priority class can only be changed before the job is started");
+#endif
+        AZ_Assert(priorityClass < JobPriorityClass::Count, "Invalid job priority class");
+        m_priorityClass = priorityClass;
+    }
+
+    AZ_FORCE_INLINE JobPriorityClass Job::GetPriorityClass() const
+    {
+        return m_priorityClass;
+    }
+
 #ifdef AZ_DEBUG_JOB_STATE
     AZ_FORCE_INLINE void Job::SetState(int state)
     {
@@ -13,6 +13,19 @@ namespace AZ
 {
     class JobManager;
 
+    /**
+     * Coarse scheduling class of a job. Each class has its own global and per worker queues, workers always look for
+     * work in the higher classes first. The signed Job priority value is still used to order jobs within a class.
+     * To keep lower classes from starving, workers periodically start their search at a lower class.
+     */
+    enum class JobPriorityClass : AZ::u8
+    {
+        Critical,   ///< Latency critical frame work, e.g. culling, skinning.
+        Normal,     ///< Default class.
+        Background, ///< Long running work which can be delayed, e.g. asset decompression, streaming.
+        Count
+    };
+
     /**
      * A job context stores information about the execution environment of jobs, a single context should be shared
      * between many jobs.
@@ -22,17 +35,20 @@ namespace AZ
     public:
         AZ_CLASS_ALLOCATOR(JobContext, ThreadPoolAllocator, 0)
 
-        JobContext(JobManager& jobManager)
+        JobContext(JobManager& jobManager, JobPriorityClass priorityClass = JobPriorityClass::Normal)
             : m_jobManager(jobManager)
-            , m_cancelGroup(NULL) { }
+            , m_cancelGroup(NULL)
+            , m_priorityClass(priorityClass) { }
 
-        JobContext(JobManager& jobManager, JobCancelGroup& cancelGroup)
+        JobContext(JobManager& jobManager, JobCancelGroup& cancelGroup, JobPriorityClass priorityClass = JobPriorityClass::Normal)
             : m_jobManager(jobManager)
-            , m_cancelGroup(&cancelGroup) { }
+            , m_cancelGroup(&cancelGroup)
+            , m_priorityClass(priorityClass) { }
 
         JobContext(const JobContext& rhs)
             : m_jobManager(rhs.m_jobManager)
-            , m_cancelGroup(rhs.m_cancelGroup) { }
+            , m_cancelGroup(rhs.m_cancelGroup)
+            , m_priorityClass(rhs.m_priorityClass) { }
 
         JobContext& operator=(const JobContext&) = delete;
 
@@ -45,6 +61,14 @@ namespace AZ
 
         JobCancelGroup* GetCancelGroup() const { return m_cancelGroup; }
 
+        /**
+         * Priority class given to jobs created with this context. Call this only before jobs using this context have
+         * been created, it is not threadsafe.
+         */
+        void SetPriorityClass(JobPriorityClass priorityClass) { m_priorityClass = priorityClass; }
+
+        JobPriorityClass GetPriorityClass() const { return m_priorityClass; }
+
         /**
          * Sets the global job context, this is what will be used when creating a top-level job without specifying
          * the context explicitly.
@@ -63,6 +87,7 @@ namespace AZ
 
         JobManager& m_jobManager;
         JobCancelGroup* m_cancelGroup;
+        JobPriorityClass m_priorityClass;
     };
 }
 
@@ -76,6 +76,19 @@ namespace AZ
         /// Returns 0 based worker index (for legacy Job compatibility)
         AZ::u32 GetWorkerThreadId() const { return m_impl.GetWorkerThreadId(); }
 
+        /**
+         * Enables or disables the job timeline trace. When enabled every thread records job begin/end, steal, suspend
+         * and sleep events in its own ring buffer (the most recent events are kept). Can be toggled at any time.
+         */
+        void SetTraceEnabled(bool enabled) { m_impl.SetTraceEnabled(enabled); }
+        bool IsTraceEnabled() const { return m_impl.IsTraceEnabled(); }
+
+        /// Exports the recorded trace as Chrome trace event JSON, viewable in chrome://tracing or ui.perfetto.dev.
+        void ExportTrace(AZStd::string& output) const { m_impl.ExportTrace(output); }
+
+        /// Discards the recorded trace events.
+        void ClearTrace() { m_impl.ClearTrace(); }
+
     private:
         //non-copyable
         JobManager(const JobManager& manager);
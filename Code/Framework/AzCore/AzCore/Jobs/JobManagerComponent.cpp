@@ -6,6 +6,9 @@
  */
 
 #include <AzCore/Jobs/JobManagerComponent.h>
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Crc.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
@@ -19,6 +22,42 @@
 
 namespace AZ
 {
+    static void OnJobTraceEnabledChanged(const bool& enabled)
+    {
+        if (JobContext* context = JobContext::GetGlobalContext())
+        {
+            context->GetJobManager().SetTraceEnabled(enabled);
+        }
+    }
+
+    AZ_CVAR(bool, job_traceEnabled, false, &OnJobTraceEnabledChanged, ConsoleFunctorFlags::Null,
+        "Records a timeline of the jobs run by the global job manager, use job_traceDump to save it.");
+
+    static void job_traceDump(const ConsoleCommandContainer& arguments)
+    {
+        JobContext* context = JobContext::GetGlobalContext();
+        if (!context)
+        {
+            AZ_Warning("JobManager", false, "job_traceDump: there is no global job context.");
+            return;
+        }
+
+        AZStd::string trace;
+        context->GetJobManager().ExportTrace(trace);
+
+        const AZStd::string path = arguments.empty() ? AZStd::string("JobTrace.json") : AZStd::string(arguments.front());
+        IO::SystemFile file;
+        if (!file.Open(path.c_str(), IO::SystemFile::SF_OPEN_CREATE | IO::SystemFile::SF_OPEN_CREATE_PATH | IO::SystemFile::SF_OPEN_WRITE_ONLY)
+            || file.Write(trace.data(), trace.size()) != trace.size())
+        {
+            AZ_Warning("JobManager", false, "job_traceDump: failed to write the job trace to '%s'.", path.c_str());
+            return;
+        }
+        AZ_TracePrintf("JobManager", "Job trace written to '%s', open it in chrome://tracing or ui.perfetto.dev.\n", path.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(job_traceDump, ConsoleFunctorFlags::Null,
+        "Saves the job timeline recorded with job_traceEnabled as a Chrome trace JSON file. Parameter: file path (default JobTrace.json)");
+
     //=========================================================================
     // JobManagerComponent
     // [5/29/2012]
@@ -28,6 +67,8 @@ namespace AZ
         , m_jobGlobalContext(nullptr)
         , m_numberOfWorkerThreads(0)
         , m_firstThreadCPU(-1)
+        , m_topologyAwareStealing(false)
+        , m_pinWorkersToCores(false)
     {
     }
 
@@ -53,13 +94,26 @@ namespace AZ
         #endif // (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
         }
 
+        AZStd::vector<int> cpuPlacementOrder;
+        if (m_pinWorkersToCores)
+        {
+            cpuPlacementOrder = CpuTopology::Query().GetWorkerPlacementOrder();
+            AZ_Warning("JobManagerComponent", !cpuPlacementOrder.empty(), "CPU topology is not available on this platform, worker threads will not be pinned.");
+        }
+
         threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
         for (int i = 0; i < numberOfWorkerThreads; ++i)
         {
+            if (!cpuPlacementOrder.empty())
+            {
+                threadDesc.m_cpuId = cpuPlacementOrder[i % cpuPlacementOrder.size()];
+            }
             desc.m_workerThreads.push_back(threadDesc);
         }
+        desc.m_topologyAwareStealing = m_topologyAwareStealing;
 
         m_jobManager = aznew JobManager(desc);
+        m_jobManager->SetTraceEnabled(job_traceEnabled);
         m_jobGlobalContext = aznew JobContext(*m_jobManager);
 
         JobContext::SetGlobalContext(m_jobGlobalContext);
@@ -115,9 +169,11 @@ namespace AZ
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
         {
             serializeContext->Class<JobManagerComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("NumberOfWorkerThreads", &JobManagerComponent::m_numberOfWorkerThreads)
                 ->Field("FirstThreadCPUID", &JobManagerComponent::m_firstThreadCPU)
+                ->Field("TopologyAwareStealing", &JobManagerComponent::m_topologyAwareStealing)
+                ->Field("PinWorkersToCores", &JobManagerComponent::m_pinWorkersToCores)
                 ;
 
             if (EditContext* editContext = serializeContext->GetEditContext())
@@ -133,6 +189,8 @@ namespace AZ
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &JobManagerComponent::m_firstThreadCPU, "CPU ID", "First CPU ID for a worker thread, each consecutive thread will use the next CPU ID. -1 Will not assign CPU Ids")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 16)
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &JobManagerComponent::m_topologyAwareStealing, "Topology aware stealing", "Idle workers steal from workers sharing their cache or NUMA node first. Linux only.")
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &JobManagerComponent::m_pinWorkersToCores, "Pin workers to cores", "Pin each worker thread to its own core, SMT siblings are used last. Linux only.")
                     ;
             }
         }
@@ -51,6 +51,8 @@ namespace AZ
         JobContext*  m_jobGlobalContext;
         int          m_numberOfWorkerThreads;   ///< Number of worked threads to spawn for this process. If <= 0 we will use all cores.
         int          m_firstThreadCPU;          ///< ID of the first thread, afterwards we just increment. If == -1, no CPU will be set.(TODO: We can have a full array)
+        bool         m_topologyAwareStealing;   ///< Steal from workers sharing the same cache / NUMA node first, see JobManagerDesc::m_topologyAwareStealing.
+        bool         m_pinWorkersToCores;       ///< Pin each worker to its own core (SMT siblings last) based on the CPU topology.
     };
 }
 
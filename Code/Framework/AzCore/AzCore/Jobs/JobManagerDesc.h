@@ -52,5 +52,13 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         * When enabled the job manager queries the CPU topology (see CpuTopology) and idle workers try to steal from
+         * workers sharing their last level cache first, then from workers on the same NUMA node, and only then from
+         * the rest. Locality comes from the thread's m_cpuId when it's pinned, otherwise workers sample the CPU they
+         * run on whenever they wake up. Has no effect on platforms without topology support.
+         */
+        bool m_topologyAwareStealing = false;
     };
 }
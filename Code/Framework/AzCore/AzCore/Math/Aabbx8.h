@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/Vector3x8.h>
+
+namespace AZ
+{
+    //! Eight axis aligned bounding boxes stored as a structure of arrays.
+    //! Used to test many boxes against the same plane or transform at once, results are returned as a bit mask with
+    //! bit i set for box i.
+    class Aabbx8
+    {
+    public:
+
+        static constexpr int32_t ElementCount = Vector3x8::ElementCount;
+
+        Aabbx8() = default;
+
+        static Aabbx8 CreateFromMinMax(const Vector3x8& min, const Vector3x8& max);
+
+        static Aabbx8 CreateCenterHalfExtents(const Vector3x8& center, const Vector3x8& halfExtents);
+
+        //! Loads eight consecutive Aabb values.
+        static Aabbx8 CreateFromAabbs(const Aabb* aabbs);
+
+        //! Stores the eight boxes to consecutive Aabb values.
+        void StoreToAabbs(Aabb* aabbs) const;
+
+        const Vector3x8& GetMin() const;
+
+        const Vector3x8& GetMax() const;
+
+        Vector3x8 GetCenter() const;
+
+        Vector3x8 GetExtents() const;
+
+        //! Returns one of the eight boxes, this is slow and intended for debugging and tests.
+        Aabb GetElement(int32_t index) const;
+
+        //! Returns the boxes containing each of the eight transformed boxes.
+        [[nodiscard]] Aabbx8 GetTransformedAabb(const Transform& transform) const;
+
+        //! Returns a mask of the boxes lying entirely behind the plane, matching ShapeIntersection::Overlaps(Frustum, Aabb)
+        //! when used with each frustum plane.
+        int32_t GetPlaneExteriorMask(const Plane& plane) const;
+
+        //! Returns a mask of the boxes lying entirely in front of the plane, matching ShapeIntersection::Contains(Frustum, Aabb)
+        //! when used with each frustum plane.
+        int32_t GetPlaneInteriorMask(const Plane& plane) const;
+
+    private:
+
+        //! Computes the signed distance of each box center to the plane and the projected radius of each box onto the plane normal.
+        void GetPlaneDistanceAndRadius(const Plane& plane, Simd::Vec8::FloatType& distance, Simd::Vec8::FloatType& radius) const;
+
+        Vector3x8 m_min;
+        Vector3x8 m_max;
+    };
+}
+
+#include <AzCore/Math/Aabbx8.inl>
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE Aabbx8 Aabbx8::CreateFromMinMax(const Vector3x8& min, const Vector3x8& max)
+    {
+        Aabbx8 result;
+        result.m_min = min;
+        result.m_max = max;
+        return result;
+    }
+
+
+    AZ_MATH_INLINE Aabbx8 Aabbx8::CreateCenterHalfExtents(const Vector3x8& center, const Vector3x8& halfExtents)
+    {
+        return CreateFromMinMax(center - halfExtents, center + halfExtents);
+    }
+
+
+    AZ_MATH_INLINE Aabbx8 Aabbx8::CreateFromAabbs(const Aabb* aabbs)
+    {
+        Vector3 mins[ElementCount];
+        Vector3 maxs[ElementCount];
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            mins[i] = aabbs[i].GetMin();
+            maxs[i] = aabbs[i].GetMax();
+        }
+        return CreateFromMinMax(Vector3x8::CreateFromVector3s(mins), Vector3x8::CreateFromVector3s(maxs));
+    }
+
+
+    AZ_MATH_INLINE void Aabbx8::StoreToAabbs(Aabb* aabbs) const
+    {
+        Vector3 mins[ElementCount];
+        Vector3 maxs[ElementCount];
+        m_min.StoreToVector3s(mins);
+        m_max.StoreToVector3s(maxs);
+        for (int32_t i = 0; i < ElementCount; ++i)
+        {
+            aabbs[i].Set(mins[i], maxs[i]);
+        }
+    }
+
+
+    AZ_MATH_INLINE const Vector3x8& Aabbx8::GetMin() const
+    {
+        return m_min;
+    }
+
+
+    AZ_MATH_INLINE const Vector3x8& Aabbx8::GetMax() const
+    {
+        return m_max;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Aabbx8::GetCenter() const
+    {
+        return (m_min + m_max) * 0.5f;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Aabbx8::GetExtents() const
+    {
+        return m_max - m_min;
+    }
+
+
+    AZ_MATH_INLINE Aabb Aabbx8::GetElement(int32_t index) const
+    {
+        return Aabb::CreateFromMinMax(m_min.GetElement(index), m_max.GetElement(index));
+    }
+
+
+    AZ_MATH_INLINE Aabbx8 Aabbx8::GetTransformedAabb(const Transform& transform) const
+    {
+        // The half extents of the result are the box half extents projected onto each world axis by the absolute basis
+        const Vector3x8 halfExtents = GetExtents() * 0.5f;
+        const Vector3x8 absBasisX = Vector3x8(transform.GetBasisX().GetAbs());
+        const Vector3x8 absBasisY = Vector3x8(transform.GetBasisY().GetAbs());
+        const Vector3x8 absBasisZ = Vector3x8(transform.GetBasisZ().GetAbs());
+        const Vector3x8 newHalfExtents = absBasisZ.GetMadd(Vector3x8(halfExtents.GetZ(), halfExtents.GetZ(), halfExtents.GetZ()),
+            absBasisY.GetMadd(Vector3x8(halfExtents.GetY(), halfExtents.GetY(), halfExtents.GetY()),
+            absBasisX * Vector3x8(halfExtents.GetX(), halfExtents.GetX(), halfExtents.GetX())));
+        return CreateCenterHalfExtents(transform.TransformPoint(GetCenter()), newHalfExtents);
+    }
+
+
+    AZ_MATH_INLINE void Aabbx8::GetPlaneDistanceAndRadius(const Plane& plane, Simd::Vec8::FloatType& distance, Simd::Vec8::FloatType& radius) const
+    {
+        const Vector3 normal = plane.GetNormal();
+        distance = Simd::Vec8::Add(GetCenter().Dot(normal), Simd::Vec8::Splat(plane.GetDistance()));
+        radius = (GetExtents() * 0.5f).Dot(normal.GetAbs());
+    }
+
+
+    AZ_MATH_INLINE int32_t Aabbx8::GetPlaneExteriorMask(const Plane& plane) const
+    {
+        Simd::Vec8::FloatType distance;
+        Simd::Vec8::FloatType radius;
+        GetPlaneDistanceAndRadius(plane, distance, radius);
+        return Simd::Vec8::GetBitMask(Simd::Vec8::CmpLtEq(Simd::Vec8::Add(distance, radius), Simd::Vec8::ZeroFloat()));
+    }
+
+
+    AZ_MATH_INLINE int32_t Aabbx8::GetPlaneInteriorMask(const Plane& plane) const
+    {
+        Simd::Vec8::FloatType distance;
+        Simd::Vec8::FloatType radius;
+        GetPlaneDistanceAndRadius(plane, distance, radius);
+        return Simd::Vec8::GetBitMask(Simd::Vec8::CmpGtEq(Simd::Vec8::Sub(distance, radius), Simd::Vec8::ZeroFloat()));
+    }
+}
@@ -10,8 +10,206 @@
 
 #include <string.h>
 
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#       define AZ_CRC32C_TARGET
+#   else
+#       include <cpuid.h>
+#       include <nmmintrin.h>
+#       define AZ_CRC32C_TARGET __attribute__((target("sse4.2")))
+#   endif
+#elif defined(__ARM_FEATURE_CRC32)
+#   include <arm_acle.h>
+#endif
+
 namespace AZ
 {
+    namespace
+    {
+        //! Lookup tables for slicing-by-8, table 0 is the classic byte-wise table and table n advances
+        //! a byte through n further zero bytes, so eight bytes can be folded in with eight independent lookups.
+        //! Assumes a little endian cpu, as all supported platforms are.
+        template<u32 Polynomial>
+        struct CrcSlicingTables
+        {
+            constexpr CrcSlicingTables()
+                : m_tables{}
+            {
+                for (u32 i = 0; i < 256; ++i)
+                {
+                    u32 crc = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        crc = (crc & 1) ? (crc >> 1) ^ Polynomial : crc >> 1;
+                    }
+                    m_tables[0][i] = crc;
+                }
+                for (u32 i = 0; i < 256; ++i)
+                {
+                    for (size_t table = 1; table < 8; ++table)
+                    {
+                        const u32 previous = m_tables[table - 1][i];
+                        m_tables[table][i] = (previous >> 8) ^ m_tables[0][previous & 0xff];
+                    }
+                }
+            }
+
+            u32 m_tables[8][256];
+        };
+
+        constexpr CrcSlicingTables<0xedb88320> Crc32Tables; // IEEE, as used by AZ::Crc32
+        constexpr CrcSlicingTables<0x82f63b78> Crc32cTables; // Castagnoli
+
+        u64 LoadWord(const uint8_t* data)
+        {
+            u64 word;
+            memcpy(&word, data, sizeof(word));
+            return word;
+        }
+
+        //! Lower cases the ASCII letters in the eight bytes of word, leaving all other bytes untouched.
+        u64 ToLowerWord(u64 word)
+        {
+            constexpr u64 ones = 0x0101010101010101ull;
+            const u64 heptets = word & (0x7f * ones);
+            const u64 isAtLeastA = heptets + ((0x80 - 'A') * ones);
+            const u64 isAboveZ = heptets + ((0x80 - 'Z' - 1) * ones);
+            const u64 isUpper = isAtLeastA & ~isAboveZ & ~word & (0x80 * ones);
+            return word | (isUpper >> 2);
+        }
+
+        uint8_t ToLowerByte(uint8_t value)
+        {
+            return (value >= 'A' && value <= 'Z') ? static_cast<uint8_t>(value + 'a' - 'A') : value;
+        }
+
+        template<u32 Polynomial>
+        u32 SlicingUpdate(const CrcSlicingTables<Polynomial>& tables, u32 state, const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+            const auto& t = tables.m_tables;
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                u64 word = LoadWord(data);
+                if (forceLowerCase)
+                {
+                    word = ToLowerWord(word);
+                }
+                word ^= state;
+                state = t[7][word & 0xff] ^ t[6][(word >> 8) & 0xff] ^ t[5][(word >> 16) & 0xff] ^ t[4][(word >> 24) & 0xff] ^
+                    t[3][(word >> 32) & 0xff] ^ t[2][(word >> 40) & 0xff] ^ t[1][(word >> 48) & 0xff] ^ t[0][word >> 56];
+            }
+            for (; size > 0; --size, ++data)
+            {
+                const uint8_t value = forceLowerCase ? ToLowerByte(*data) : *data;
+                state = t[0][(state ^ value) & 0xff] ^ (state >> 8);
+            }
+            return state;
+        }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        bool HasCrc32cInstructions()
+        {
+            // CPUID leaf 1 reports SSE4.2, which includes the crc32 instruction, in bit 20 of ecx
+            constexpr unsigned int sse42Bit = 1u << 20;
+#if defined(AZ_COMPILER_MSVC)
+            int info[4];
+            __cpuid(info, 1);
+            return (static_cast<unsigned int>(info[2]) & sse42Bit) != 0;
+#else
+            unsigned int eax, ebx, ecx, edx;
+            return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & sse42Bit) != 0;
+#endif
+        }
+
+        AZ_CRC32C_TARGET u32 HardwareCrc32cUpdate(u32 state, const uint8_t* data, size_t size)
+        {
+            u64 state64 = state;
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                state64 = _mm_crc32_u64(state64, LoadWord(data));
+            }
+            state = static_cast<u32>(state64);
+            for (; size > 0; --size, ++data)
+            {
+                state = _mm_crc32_u8(state, *data);
+            }
+            return state;
+        }
+#elif defined(__ARM_FEATURE_CRC32)
+        bool HasCrc32cInstructions()
+        {
+            return true;
+        }
+
+        u32 HardwareCrc32cUpdate(u32 state, const uint8_t* data, size_t size)
+        {
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                state = __crc32cd(state, LoadWord(data));
+            }
+            for (; size > 0; --size, ++data)
+            {
+                state = __crc32cb(state, *data);
+            }
+            return state;
+        }
+
+        //! ARMv8 also has instructions for the IEEE polynomial, so AZ::Crc32 is accelerated directly.
+        u32 HardwareCrc32Update(u32 state, const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+            for (; size >= 8; size -= 8, data += 8)
+            {
+                const u64 word = LoadWord(data);
+                state = __crc32d(state, forceLowerCase ? ToLowerWord(word) : word);
+            }
+            for (; size > 0; --size, ++data)
+            {
+                state = __crc32b(state, forceLowerCase ? ToLowerByte(*data) : *data);
+            }
+            return state;
+        }
+#else
+        bool HasCrc32cInstructions()
+        {
+            return false;
+        }
+
+        u32 HardwareCrc32cUpdate(u32 state, [[maybe_unused]] const uint8_t* data, [[maybe_unused]] size_t size)
+        {
+            return state;
+        }
+#endif
+    }
+
+    namespace Internal
+    {
+        u32 Crc32Update(u32 crc, const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+#if defined(__ARM_FEATURE_CRC32)
+            return ~HardwareCrc32Update(~crc, data, size, forceLowerCase);
+#else
+            return ~SlicingUpdate(Crc32Tables, ~crc, data, size, forceLowerCase);
+#endif
+        }
+    }
+
+    bool IsCrc32cHardwareAccelerated()
+    {
+        static const bool hasCrc32cInstructions = HasCrc32cInstructions();
+        return hasCrc32cInstructions;
+    }
+
+    u32 ComputeCrc32c(const void* data, size_t size, u32 crc)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        if (IsCrc32cHardwareAccelerated())
+        {
+            return ~HardwareCrc32cUpdate(~crc, bytes, size);
+        }
+        return ~SlicingUpdate(Crc32cTables, ~crc, bytes, size, false);
+    }
+
     //=========================================================================
     //
     // Crc32 constructor
@@ -32,7 +230,7 @@ namespace AZ
     //=========================================================================
     void Crc32::Add(const void* data, size_t size, bool forceLowerCase)
     {
-        Combine(Crc32{ data, size, forceLowerCase }, size);
+        Add(reinterpret_cast<const uint8_t*>(data), size, forceLowerCase);
     }
 
     //=========================================================================
@@ -9,6 +9,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/is_constant_evaluated.h>
 
 //////////////////////////////////////////////////////////////////////////
 // Macros for pre-processor Crc32 conversion
@@ -103,6 +104,15 @@ namespace AZ
 
         u32 m_value;
     };
+
+    //! Computes the CRC-32C (Castagnoli) of a block of data, continuing from the crc of any data processed before.
+    //! Uses the SSE4.2 or ARMv8 crc instructions when the cpu has them, which is detected at runtime on x86.
+    //! The values differ from Crc32, which uses the IEEE polynomial, so this must only be used for hashes that
+    //! are never persisted or compared against Crc32 values, e.g. keys of in-memory tables.
+    u32 ComputeCrc32c(const void* data, size_t size, u32 crc = 0);
+
+    //! Returns true if ComputeCrc32c uses crc instructions on this cpu rather than table lookups.
+    bool IsCrc32cHardwareAccelerated();
 }
 
 namespace AZStd
@@ -114,6 +114,11 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Continues the crc of the data processed so far with size more bytes, returns the crc of the whole.
+        //! This is the runtime implementation of Crc32Set and Crc32::Add, it processes several bytes per step
+        //! and produces exactly the same values as the byte-wise constexpr path below.
+        u32 Crc32Update(u32 crc, const uint8_t* data, size_t size, bool forceLowerCase);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -122,6 +127,10 @@ namespace AZ
             {
                 value = 0;
             }
+            else if (!AZStd::is_constant_evaluated())
+            {
+                value = Crc32Update(0, reinterpret_cast<const uint8_t*>(data), size, forceLowerCase);
+            }
             else
             {
                 unsigned int crc = 0xffffffffL;
@@ -172,6 +181,12 @@ namespace AZ
     {
         if (!view.empty())
         {
+            if (!AZStd::is_constant_evaluated())
+            {
+                m_value = Internal::Crc32Update(m_value, reinterpret_cast<const uint8_t*>(view.data()), view.size(), true);
+                return;
+            }
+
             size_t len = view.size();
             u32 crc = static_cast<u32>(Crc32(view));
             Combine(crc, len);
@@ -183,11 +198,22 @@ namespace AZ
     //=========================================================================
     constexpr void Crc32::Add(const uint8_t* data, size_t size, bool forceLowerCase)
     {
+        if (data && !AZStd::is_constant_evaluated())
+        {
+            // Continuing the crc gives the same result as combining with the crc of the data, in linear time
+            m_value = Internal::Crc32Update(m_value, data, size, forceLowerCase);
+            return;
+        }
         Combine(Crc32{ data, size, forceLowerCase }, size);
     }
 
     constexpr void Crc32::Add(const char* data, size_t size, bool forceLowerCase)
     {
+        if (data && !AZStd::is_constant_evaluated())
+        {
+            m_value = Internal::Crc32Update(m_value, reinterpret_cast<const uint8_t*>(data), size, forceLowerCase);
+            return;
+        }
         Combine(Crc32{ data, size, forceLowerCase }, size);
     }
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/FastHash.h>
+
+#include <string.h>
+
+#if defined(AZ_COMPILER_MSVC) && defined(_M_X64)
+#   include <intrin.h>
+#endif
+
+namespace AZ
+{
+    // The construction follows wyhash (public domain): the input is consumed in 64-bit words that are mixed
+    // by multiplying them to 128 bits and folding the halves together.
+    namespace
+    {
+        constexpr u64 Secret0 = 0xa0761d6478bd642full;
+        constexpr u64 Secret1 = 0xe7037ed1a0b428dbull;
+        constexpr u64 Secret2 = 0x8ebc6af09c88c6e3ull;
+        constexpr u64 Secret3 = 0x589965cc75374cc3ull;
+
+        //! Full 64x64 to 128-bit multiply, the low half is returned in lhs and the high half in rhs.
+        void Multiply128(u64& lhs, u64& rhs)
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+            lhs = static_cast<u64>(product);
+            rhs = static_cast<u64>(product >> 64);
+#elif defined(AZ_COMPILER_MSVC) && defined(_M_X64)
+            lhs = _umul128(lhs, rhs, &rhs);
+#else
+            const u64 lhsLow = lhs & 0xffffffff;
+            const u64 lhsHigh = lhs >> 32;
+            const u64 rhsLow = rhs & 0xffffffff;
+            const u64 rhsHigh = rhs >> 32;
+            const u64 lowLow = lhsLow * rhsLow;
+            const u64 lowHigh = lhsLow * rhsHigh;
+            const u64 highLow = lhsHigh * rhsLow;
+            const u64 highHigh = lhsHigh * rhsHigh;
+            const u64 cross = (lowLow >> 32) + (highLow & 0xffffffff) + lowHigh;
+            lhs = (cross << 32) | (lowLow & 0xffffffff);
+            rhs = (highLow >> 32) + (cross >> 32) + highHigh;
+#endif
+        }
+
+        u64 MultiplyFold(u64 lhs, u64 rhs)
+        {
+            Multiply128(lhs, rhs);
+            return lhs ^ rhs;
+        }
+
+        u64 Read64(const uint8_t* data)
+        {
+            u64 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        u64 Read32(const uint8_t* data)
+        {
+            u32 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        //! Reads 1 to 3 bytes without branching on the size.
+        u64 ReadSmall(const uint8_t* data, size_t size)
+        {
+            return (static_cast<u64>(data[0]) << 16) | (static_cast<u64>(data[size >> 1]) << 8) | data[size - 1];
+        }
+    }
+
+    u64 FastHash64(const void* data, size_t size, u64 seed)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        seed ^= MultiplyFold(seed ^ Secret0, Secret1);
+
+        u64 a = 0;
+        u64 b = 0;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                // Two overlapping pairs of 32-bit reads cover every size from 4 to 16 bytes
+                const size_t offset = (size >> 3) << 2;
+                a = (Read32(bytes) << 32) | Read32(bytes + offset);
+                b = (Read32(bytes + size - 4) << 32) | Read32(bytes + size - 4 - offset);
+            }
+            else if (size > 0)
+            {
+                a = ReadSmall(bytes, size);
+            }
+        }
+        else
+        {
+            size_t remaining = size;
+            if (remaining > 48)
+            {
+                // Three independent lanes keep the multipliers busy on long inputs
+                u64 seed1 = seed;
+                u64 seed2 = seed;
+                do
+                {
+                    seed = MultiplyFold(Read64(bytes) ^ Secret1, Read64(bytes + 8) ^ seed);
+                    seed1 = MultiplyFold(Read64(bytes + 16) ^ Secret2, Read64(bytes + 24) ^ seed1);
+                    seed2 = MultiplyFold(Read64(bytes + 32) ^ Secret3, Read64(bytes + 40) ^ seed2);
+                    bytes += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= seed1 ^ seed2;
+            }
+
+            while (remaining > 16)
+            {
+                seed = MultiplyFold(Read64(bytes) ^ Secret1, Read64(bytes + 8) ^ seed);
+                bytes += 16;
+                remaining -= 16;
+            }
+
+            // The last 16 bytes of the input, which may overlap with bytes already consumed
+            a = Read64(bytes + remaining - 16);
+            b = Read64(bytes + remaining - 8);
+        }
+
+        a ^= Secret1;
+        b ^= seed;
+        Multiply128(a, b);
+        return MultiplyFold(a ^ Secret0 ^ size, b ^ Secret1);
+    }
+}
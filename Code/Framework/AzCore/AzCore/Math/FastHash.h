@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Fast non-cryptographic 64-bit hash of a block of data, in the class of xxHash3 and wyhash.
+    //! It processes 16 to 48 bytes per step using 64x64 to 128-bit multiplies, several times faster than the
+    //! byte-wise AZ::Crc32 and AZStd::hash of strings on anything longer than a few bytes.
+    //! The algorithm may change between releases, so the values must only be used in memory, never persisted
+    //! or sent over the network. Use AZ::Crc32 for those.
+    u64 FastHash64(const void* data, size_t size, u64 seed = 0);
+
+    inline u64 FastHash64(AZStd::string_view value, u64 seed = 0)
+    {
+        return FastHash64(value.data(), value.size(), seed);
+    }
+
+    //! Hasher for in-memory containers keyed by strings, e.g.
+    //! AZStd::flat_unordered_map<AZStd::string, T, AZ::FastStringHasher>.
+    struct FastStringHasher
+    {
+        size_t operator()(AZStd::string_view value) const
+        {
+            return static_cast<size_t>(FastHash64(value));
+        }
+    };
+}
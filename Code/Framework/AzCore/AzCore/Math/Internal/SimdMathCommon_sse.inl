@@ -521,7 +521,7 @@ namespace AZ
 
             AZ_MATH_INLINE __m128 Madd(__m128 mul1, __m128 mul2, __m128 add)
             {
-#if 0
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
                 return _mm_fmadd_ps(mul1, mul2, add); // Requires FMA CPUID
 #else
                 return Add(Mul(mul1, mul2), add);
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace ShapeIntersection
+    {
+        namespace
+        {
+            using Vec8 = Simd::Vec8;
+
+            constexpr size_t BatchSize = Vec8::ElementCount;
+            constexpr size_t PlaneCount = static_cast<size_t>(Frustum::PlaneId::MAX);
+
+            //! Number of primitives tested against every frustum before moving on, keeps the inputs in cache when testing several frusta.
+            constexpr size_t MultiFrustumChunkSize = 1024;
+
+            //! The frustum planes splatted across all lanes, prepared once per batch call.
+            struct BatchFrustum
+            {
+                explicit BatchFrustum(const Frustum& frustum)
+                {
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const size_t index = static_cast<size_t>(planeId);
+                        const Plane plane = frustum.GetPlane(planeId);
+                        const Vector3 normal = plane.GetNormal();
+                        m_normalX[index] = Vec8::Splat(normal.GetX());
+                        m_normalY[index] = Vec8::Splat(normal.GetY());
+                        m_normalZ[index] = Vec8::Splat(normal.GetZ());
+                        m_absNormalX[index] = Vec8::Splat(GetAbs(normal.GetX()));
+                        m_absNormalY[index] = Vec8::Splat(GetAbs(normal.GetY()));
+                        m_absNormalZ[index] = Vec8::Splat(GetAbs(normal.GetZ()));
+                        m_distance[index] = Vec8::Splat(plane.GetDistance());
+                    }
+                }
+
+                Vec8::FloatType GetPointDist(size_t index, Vec8::FloatArgType x, Vec8::FloatArgType y, Vec8::FloatArgType z) const
+                {
+                    return Vec8::Madd(m_normalZ[index], z, Vec8::Madd(m_normalY[index], y, Vec8::Madd(m_normalX[index], x, m_distance[index])));
+                }
+
+                Vec8::FloatType m_normalX[PlaneCount];
+                Vec8::FloatType m_normalY[PlaneCount];
+                Vec8::FloatType m_normalZ[PlaneCount];
+                Vec8::FloatType m_absNormalX[PlaneCount];
+                Vec8::FloatType m_absNormalY[PlaneCount];
+                Vec8::FloatType m_absNormalZ[PlaneCount];
+                Vec8::FloatType m_distance[PlaneCount];
+            };
+
+            //! Loads the values of one batch, the last batch is padded by repeating the last value.
+            Vec8::FloatType LoadBatchValues(const float* values, size_t index, size_t count)
+            {
+                if (index + BatchSize <= count)
+                {
+                    return Vec8::LoadUnaligned(values + index);
+                }
+
+                float padded[BatchSize];
+                for (size_t i = 0; i < BatchSize; ++i)
+                {
+                    padded[i] = values[AZ::GetMin(index + i, count - 1)];
+                }
+                return Vec8::LoadUnaligned(padded);
+            }
+
+            //! Mask of the lanes that hold primitives, as the last batch may be partially filled.
+            uint32_t GetValidLanes(size_t index, size_t count)
+            {
+                const size_t remaining = count - index;
+                return remaining >= BatchSize ? (1u << BatchSize) - 1 : (1u << remaining) - 1;
+            }
+
+            uint32_t GetOverlapLanes(const BatchFrustum& frustum, const SphereSoaView& spheres, size_t index)
+            {
+                const Vec8::FloatType centerX = LoadBatchValues(spheres.m_centerX, index, spheres.m_count);
+                const Vec8::FloatType centerY = LoadBatchValues(spheres.m_centerY, index, spheres.m_count);
+                const Vec8::FloatType centerZ = LoadBatchValues(spheres.m_centerZ, index, spheres.m_count);
+                const Vec8::FloatType radius = LoadBatchValues(spheres.m_radius, index, spheres.m_count);
+                const Vec8::FloatType zero = Vec8::ZeroFloat();
+
+                // A sphere is outside once it is entirely behind any plane, as in Overlaps(Frustum, Sphere)
+                uint32_t overlapLanes = GetValidLanes(index, spheres.m_count);
+                for (size_t plane = 0; plane < PlaneCount && overlapLanes != 0; ++plane)
+                {
+                    const Vec8::FloatType distance = frustum.GetPointDist(plane, centerX, centerY, centerZ);
+                    overlapLanes &= Vec8::GetBitMask(Vec8::CmpGtEq(Vec8::Add(distance, radius), zero));
+                }
+                return overlapLanes;
+            }
+
+            uint32_t GetOverlapLanes(const BatchFrustum& frustum, const AabbSoaView& aabbs, size_t index)
+            {
+                const Vec8::FloatType half = Vec8::Splat(0.5f);
+                const Vec8::FloatType minX = LoadBatchValues(aabbs.m_minX, index, aabbs.m_count);
+                const Vec8::FloatType minY = LoadBatchValues(aabbs.m_minY, index, aabbs.m_count);
+                const Vec8::FloatType minZ = LoadBatchValues(aabbs.m_minZ, index, aabbs.m_count);
+                const Vec8::FloatType maxX = LoadBatchValues(aabbs.m_maxX, index, aabbs.m_count);
+                const Vec8::FloatType maxY = LoadBatchValues(aabbs.m_maxY, index, aabbs.m_count);
+                const Vec8::FloatType maxZ = LoadBatchValues(aabbs.m_maxZ, index, aabbs.m_count);
+                const Vec8::FloatType centerX = Vec8::Mul(Vec8::Add(minX, maxX), half);
+                const Vec8::FloatType centerY = Vec8::Mul(Vec8::Add(minY, maxY), half);
+                const Vec8::FloatType centerZ = Vec8::Mul(Vec8::Add(minZ, maxZ), half);
+                const Vec8::FloatType halfExtentX = Vec8::Mul(Vec8::Sub(maxX, minX), half);
+                const Vec8::FloatType halfExtentY = Vec8::Mul(Vec8::Sub(maxY, minY), half);
+                const Vec8::FloatType halfExtentZ = Vec8::Mul(Vec8::Sub(maxZ, minZ), half);
+                const Vec8::FloatType zero = Vec8::ZeroFloat();
+
+                // Compare the center to plane distance with the projection radius of the box onto the plane normal, as in Overlaps(Frustum, Aabb)
+                uint32_t overlapLanes = GetValidLanes(index, aabbs.m_count);
+                for (size_t plane = 0; plane < PlaneCount && overlapLanes != 0; ++plane)
+                {
+                    const Vec8::FloatType distance = frustum.GetPointDist(plane, centerX, centerY, centerZ);
+                    const Vec8::FloatType radius = Vec8::Madd(frustum.m_absNormalZ[plane], halfExtentZ,
+                        Vec8::Madd(frustum.m_absNormalY[plane], halfExtentY, Vec8::Mul(frustum.m_absNormalX[plane], halfExtentX)));
+                    overlapLanes &= Vec8::GetBitMask(Vec8::CmpGt(Vec8::Add(distance, radius), zero));
+                }
+                return overlapLanes;
+            }
+
+            template <typename SoaView>
+            void OverlapsBatchMask(const Frustum& frustum, const SoaView& primitives, uint32_t* overlapMask)
+            {
+                static_assert(32 % BatchSize == 0, "Batches must not straddle mask words");
+
+                const BatchFrustum batchFrustum(frustum);
+                for (size_t index = 0; index < primitives.m_count; index += BatchSize)
+                {
+                    const uint32_t overlapLanes = GetOverlapLanes(batchFrustum, primitives, index);
+                    const size_t shift = index % 32;
+                    if (shift == 0)
+                    {
+                        overlapMask[index / 32] = overlapLanes;
+                    }
+                    else
+                    {
+                        overlapMask[index / 32] |= overlapLanes << shift;
+                    }
+                }
+            }
+
+            template <typename SoaView>
+            size_t OverlapsBatchIndexList(const Frustum& frustum, const SoaView& primitives, uint32_t* overlapIndices)
+            {
+                const BatchFrustum batchFrustum(frustum);
+                size_t overlapCount = 0;
+                for (size_t index = 0; index < primitives.m_count; index += BatchSize)
+                {
+                    uint32_t overlapLanes = GetOverlapLanes(batchFrustum, primitives, index);
+                    while (overlapLanes != 0)
+                    {
+                        overlapIndices[overlapCount++] = static_cast<uint32_t>(index + az_ctz_u32(overlapLanes));
+                        overlapLanes &= overlapLanes - 1;
+                    }
+                }
+                return overlapCount;
+            }
+
+            template <typename SoaView>
+            void OverlapsBatchMultiFrustum(const Frustum* frusta, size_t frustumCount, const SoaView& primitives, uint32_t* frustumMasks)
+            {
+                AZ_Assert(frustumCount <= 32, "OverlapsBatch supports at most 32 frusta, %zu were given", frustumCount);
+                frustumCount = AZ::GetMin<size_t>(frustumCount, 32);
+
+                for (size_t i = 0; i < primitives.m_count; ++i)
+                {
+                    frustumMasks[i] = 0;
+                }
+
+                for (size_t chunkStart = 0; chunkStart < primitives.m_count; chunkStart += MultiFrustumChunkSize)
+                {
+                    const size_t chunkEnd = AZ::GetMin(chunkStart + MultiFrustumChunkSize, primitives.m_count);
+                    for (size_t frustumIndex = 0; frustumIndex < frustumCount; ++frustumIndex)
+                    {
+                        const BatchFrustum batchFrustum(frusta[frustumIndex]);
+                        const uint32_t frustumBit = 1u << frustumIndex;
+                        for (size_t index = chunkStart; index < chunkEnd; index += BatchSize)
+                        {
+                            uint32_t overlapLanes = GetOverlapLanes(batchFrustum, primitives, index);
+                            while (overlapLanes != 0)
+                            {
+                                frustumMasks[index + az_ctz_u32(overlapLanes)] |= frustumBit;
+                                overlapLanes &= overlapLanes - 1;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        void OverlapsBatch(const Frustum& frustum, const SphereSoaView& spheres, uint32_t* overlapMask)
+        {
+            OverlapsBatchMask(frustum, spheres, overlapMask);
+        }
+
+        void OverlapsBatch(const Frustum& frustum, const AabbSoaView& aabbs, uint32_t* overlapMask)
+        {
+            OverlapsBatchMask(frustum, aabbs, overlapMask);
+        }
+
+        size_t OverlapsBatchIndices(const Frustum& frustum, const SphereSoaView& spheres, uint32_t* overlapIndices)
+        {
+            return OverlapsBatchIndexList(frustum, spheres, overlapIndices);
+        }
+
+        size_t OverlapsBatchIndices(const Frustum& frustum, const AabbSoaView& aabbs, uint32_t* overlapIndices)
+        {
+            return OverlapsBatchIndexList(frustum, aabbs, overlapIndices);
+        }
+
+        void OverlapsBatch(const Frustum* frusta, size_t frustumCount, const SphereSoaView& spheres, uint32_t* frustumMasks)
+        {
+            OverlapsBatchMultiFrustum(frusta, frustumCount, spheres, frustumMasks);
+        }
+
+        void OverlapsBatch(const Frustum* frusta, size_t frustumCount, const AabbSoaView& aabbs, uint32_t* frustumMasks)
+        {
+            OverlapsBatchMultiFrustum(frusta, frustumCount, aabbs, frustumMasks);
+        }
+    }
+}
@@ -50,6 +50,51 @@ namespace AZ
         bool Contains(const Frustum& frustum,  const Sphere& sphere);
         bool Contains(const Frustum& frustum,  const Vector3& point);
         //! @}
+
+        //! Structure of arrays views of many spheres or AABBs, used by the batch tests below.
+        //! Each array holds m_count values, the arrays don't need any particular alignment.
+        //! @{
+        struct SphereSoaView
+        {
+            const float* m_centerX = nullptr;
+            const float* m_centerY = nullptr;
+            const float* m_centerZ = nullptr;
+            const float* m_radius = nullptr;
+            size_t m_count = 0;
+        };
+
+        struct AabbSoaView
+        {
+            const float* m_minX = nullptr;
+            const float* m_minY = nullptr;
+            const float* m_minZ = nullptr;
+            const float* m_maxX = nullptr;
+            const float* m_maxY = nullptr;
+            const float* m_maxZ = nullptr;
+            size_t m_count = 0;
+        };
+        //! @}
+
+        //! Batch versions of Overlaps(Frustum, Sphere) and Overlaps(Frustum, Aabb), testing eight primitives per iteration.
+        //! Bit (i % 32) of overlapMask[i / 32] is set if primitive i overlaps the frustum, overlapMask must hold (count + 31) / 32 words.
+        //! @{
+        void OverlapsBatch(const Frustum& frustum, const SphereSoaView& spheres, uint32_t* overlapMask);
+        void OverlapsBatch(const Frustum& frustum, const AabbSoaView& aabbs, uint32_t* overlapMask);
+        //! @}
+
+        //! As OverlapsBatch, but writes the indices of the overlapping primitives in increasing order.
+        //! overlapIndices must have room for count indices, returns the number of indices written.
+        //! @{
+        size_t OverlapsBatchIndices(const Frustum& frustum, const SphereSoaView& spheres, uint32_t* overlapIndices);
+        size_t OverlapsBatchIndices(const Frustum& frustum, const AabbSoaView& aabbs, uint32_t* overlapIndices);
+        //! @}
+
+        //! Tests every primitive against up to 32 frusta at once, e.g. the views and shadow cascades of a frame.
+        //! Bit j of frustumMasks[i] is set if primitive i overlaps frusta[j], frustumMasks must hold count values.
+        //! @{
+        void OverlapsBatch(const Frustum* frusta, size_t frustumCount, const SphereSoaView& spheres, uint32_t* frustumMasks);
+        void OverlapsBatch(const Frustum* frusta, size_t frustumCount, const AabbSoaView& aabbs, uint32_t* frustumMasks);
+        //! @}
     }
 }
 
@@ -19,6 +19,11 @@
 #   endif
 #endif
 
+// The eight wide AVX2 and FMA backend is opt in, platforms enable it at build time when the compiler targets it
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2)
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -48,6 +53,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
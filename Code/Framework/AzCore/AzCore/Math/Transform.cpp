@@ -10,6 +10,7 @@
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Obb.h>
+#include <AzCore/Math/Vector3x8.h>
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/MathScriptHelpers.h>
 
@@ -298,7 +299,7 @@ namespace AZ
                 Method("GetBasisAndTranslation", &Transform::GetBasisAndTranslation)->
                     Attribute(Script::Attributes::MethodOverride, &Internal::TransformGetBasisAndTranslationMultipleReturn)->
                     Attribute(Script::Attributes::ExcludeFrom, Script::Attributes::ExcludeFlags::All)->
-                Method("TransformVector", &Transform::TransformVector)->
+                Method<Vector3(Transform::*)(const Vector3&) const>("TransformVector", &Transform::TransformVector)->
                     Attribute(Script::Attributes::ExcludeFrom, Script::Attributes::ExcludeFlags::All)->
                 Method<void (Transform::*)(const Vector3&)>("SetTranslation", &Transform::SetTranslation)->
                     Attribute(Script::Attributes::MethodOverride, &Internal::TransformSetTranslationGeneric)->
@@ -423,4 +424,28 @@ namespace AZ
 
         return result;
     }
+
+    void Transform::TransformPoints(const Vector3* points, Vector3* results, size_t count) const
+    {
+        // Expand the transform into splatted basis vectors once, then transform eight points per iteration
+        const Vector3x8 basisX(GetBasisX());
+        const Vector3x8 basisY(GetBasisY());
+        const Vector3x8 basisZ(GetBasisZ());
+        const Vector3x8 translation(m_translation);
+
+        size_t index = 0;
+        for (; index + Vector3x8::ElementCount <= count; index += Vector3x8::ElementCount)
+        {
+            const Vector3x8 batch = Vector3x8::CreateFromVector3s(points + index);
+            const Vector3x8 result = basisZ.GetMadd(Vector3x8(batch.GetZ(), batch.GetZ(), batch.GetZ()),
+                basisY.GetMadd(Vector3x8(batch.GetY(), batch.GetY(), batch.GetY()),
+                basisX.GetMadd(Vector3x8(batch.GetX(), batch.GetX(), batch.GetX()), translation)));
+            result.StoreToVector3s(results + index);
+        }
+
+        for (; index < count; ++index)
+        {
+            results[index] = TransformPoint(points[index]);
+        }
+    }
 }
@@ -16,6 +16,8 @@
 
 namespace AZ
 {
+    class Vector3x8;
+
     class TransformSerializer
         : public SerializeContext::IDataSerializer
     {
@@ -141,6 +143,18 @@ namespace AZ
         //! Applies rotation and scale, but not translation.
         Vector3 TransformVector(const Vector3& rhs) const;
 
+        //! Transforms eight points or vectors at once, defined in Vector3x8.h.
+        //! @{
+        Vector3x8 TransformPoint(const Vector3x8& rhs) const;
+        Vector3x8 TransformVector(const Vector3x8& rhs) const;
+        //! @}
+
+        //! Transforms an array of points, processing eight points at a time.
+        //! @param points The points to transform.
+        //! @param[out] results The transformed points, may be the same array as points.
+        //! @param count The number of points in both arrays.
+        void TransformPoints(const Vector3* points, Vector3* results, size_t count) const;
+
         Transform GetInverse() const;
         void Invert();
 
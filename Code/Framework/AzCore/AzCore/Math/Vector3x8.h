@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Transform.h>
+
+namespace AZ
+{
+    //! Eight 3d vectors stored as a structure of arrays, one Simd::Vec8 per component.
+    //! Operations apply to all eight vectors at once, scalar results such as Dot are returned as a Simd::Vec8 with one
+    //! element per vector. Use it to process large arrays of points, e.g. skinning, culling or transform hierarchies.
+    class Vector3x8
+    {
+    public:
+
+        static constexpr int32_t ElementCount = Simd::Vec8::ElementCount;
+
+        Vector3x8() = default;
+        Vector3x8(Simd::Vec8::FloatArgType x, Simd::Vec8::FloatArgType y, Simd::Vec8::FloatArgType z);
+
+        //! Sets all eight vectors to the same value.
+        explicit Vector3x8(const Vector3& value);
+
+        static Vector3x8 CreateZero();
+
+        //! Loads eight consecutive Vector3 values, transposing them into structure of arrays form.
+        static Vector3x8 CreateFromVector3s(const Vector3* values);
+
+        //! Loads eight values from each component array, arrays *must* be 32-byte aligned.
+        static Vector3x8 LoadAligned(const float* __restrict xs, const float* __restrict ys, const float* __restrict zs);
+        static Vector3x8 LoadUnaligned(const float* __restrict xs, const float* __restrict ys, const float* __restrict zs);
+
+        //! Stores the eight vectors to consecutive Vector3 values.
+        void StoreToVector3s(Vector3* values) const;
+
+        //! Stores eight values to each component array, arrays *must* be 32-byte aligned.
+        void StoreAligned(float* __restrict xs, float* __restrict ys, float* __restrict zs) const;
+        void StoreUnaligned(float* __restrict xs, float* __restrict ys, float* __restrict zs) const;
+
+        Simd::Vec8::FloatType GetX() const;
+        Simd::Vec8::FloatType GetY() const;
+        Simd::Vec8::FloatType GetZ() const;
+
+        void SetX(Simd::Vec8::FloatArgType x);
+        void SetY(Simd::Vec8::FloatArgType y);
+        void SetZ(Simd::Vec8::FloatArgType z);
+
+        //! Returns one of the eight vectors, this is slow and intended for debugging and tests.
+        Vector3 GetElement(int32_t index) const;
+
+        Simd::Vec8::FloatType Dot(const Vector3x8& rhs) const;
+        Simd::Vec8::FloatType Dot(const Vector3& rhs) const;
+
+        Vector3x8 Cross(const Vector3x8& rhs) const;
+
+        Simd::Vec8::FloatType GetLengthSq() const;
+        Simd::Vec8::FloatType GetLength() const;
+
+        //! Normalizes all eight vectors, the vectors *must* have non-zero length.
+        Vector3x8 GetNormalized() const;
+
+        Vector3x8 GetAbs() const;
+        Vector3x8 GetMin(const Vector3x8& rhs) const;
+        Vector3x8 GetMax(const Vector3x8& rhs) const;
+
+        //! Returns this * a + b for each vector, using fused multiply add where available.
+        Vector3x8 GetMadd(const Vector3x8& mul, const Vector3x8& add) const;
+
+        Vector3x8 operator-() const;
+        Vector3x8 operator+(const Vector3x8& rhs) const;
+        Vector3x8 operator-(const Vector3x8& rhs) const;
+        Vector3x8 operator*(const Vector3x8& rhs) const;
+        Vector3x8 operator*(float multiplier) const;
+        Vector3x8 operator*(Simd::Vec8::FloatArgType multiplier) const;
+
+        Vector3x8& operator+=(const Vector3x8& rhs);
+        Vector3x8& operator-=(const Vector3x8& rhs);
+        Vector3x8& operator*=(const Vector3x8& rhs);
+        Vector3x8& operator*=(float multiplier);
+
+    private:
+
+        Simd::Vec8::FloatType m_x;
+        Simd::Vec8::FloatType m_y;
+        Simd::Vec8::FloatType m_z;
+    };
+}
+
+#include <AzCore/Math/Vector3x8.inl>
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE Vector3x8::Vector3x8(Simd::Vec8::FloatArgType x, Simd::Vec8::FloatArgType y, Simd::Vec8::FloatArgType z)
+        : m_x(x)
+        , m_y(y)
+        , m_z(z)
+    {
+        ;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8::Vector3x8(const Vector3& value)
+        : m_x(Simd::Vec8::Splat(value.GetX()))
+        , m_y(Simd::Vec8::Splat(value.GetY()))
+        , m_z(Simd::Vec8::Splat(value.GetZ()))
+    {
+        ;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::CreateZero()
+    {
+        const Simd::Vec8::FloatType zero = Simd::Vec8::ZeroFloat();
+        return Vector3x8(zero, zero, zero);
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::CreateFromVector3s(const Vector3* values)
+    {
+        // Transpose each group of four xyz rows into x, y and z columns, the fourth column is discarded
+        Simd::Vec4::FloatType rows[4];
+        Simd::Vec4::FloatType low[4];
+        Simd::Vec4::FloatType high[4];
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            rows[i] = Simd::Vec4::FromVec3(values[i].GetSimdValue());
+        }
+        Simd::Vec4::Mat4x4Transpose(rows, low);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            rows[i] = Simd::Vec4::FromVec3(values[i + 4].GetSimdValue());
+        }
+        Simd::Vec4::Mat4x4Transpose(rows, high);
+        return Vector3x8(Simd::Vec8::FromVec4(low[0], high[0]), Simd::Vec8::FromVec4(low[1], high[1]), Simd::Vec8::FromVec4(low[2], high[2]));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::LoadAligned(const float* __restrict xs, const float* __restrict ys, const float* __restrict zs)
+    {
+        return Vector3x8(Simd::Vec8::LoadAligned(xs), Simd::Vec8::LoadAligned(ys), Simd::Vec8::LoadAligned(zs));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::LoadUnaligned(const float* __restrict xs, const float* __restrict ys, const float* __restrict zs)
+    {
+        return Vector3x8(Simd::Vec8::LoadUnaligned(xs), Simd::Vec8::LoadUnaligned(ys), Simd::Vec8::LoadUnaligned(zs));
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::StoreToVector3s(Vector3* values) const
+    {
+        const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+        Simd::Vec4::FloatType columns[4] = { Simd::Vec8::ToVec4Low(m_x), Simd::Vec8::ToVec4Low(m_y), Simd::Vec8::ToVec4Low(m_z), zero };
+        Simd::Vec4::FloatType rows[4];
+        Simd::Vec4::Mat4x4Transpose(columns, rows);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            values[i] = Vector3(Simd::Vec4::ToVec3(rows[i]));
+        }
+        columns[0] = Simd::Vec8::ToVec4High(m_x);
+        columns[1] = Simd::Vec8::ToVec4High(m_y);
+        columns[2] = Simd::Vec8::ToVec4High(m_z);
+        Simd::Vec4::Mat4x4Transpose(columns, rows);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            values[i + 4] = Vector3(Simd::Vec4::ToVec3(rows[i]));
+        }
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::StoreAligned(float* __restrict xs, float* __restrict ys, float* __restrict zs) const
+    {
+        Simd::Vec8::StoreAligned(xs, m_x);
+        Simd::Vec8::StoreAligned(ys, m_y);
+        Simd::Vec8::StoreAligned(zs, m_z);
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::StoreUnaligned(float* __restrict xs, float* __restrict ys, float* __restrict zs) const
+    {
+        Simd::Vec8::StoreUnaligned(xs, m_x);
+        Simd::Vec8::StoreUnaligned(ys, m_y);
+        Simd::Vec8::StoreUnaligned(zs, m_z);
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::GetX() const
+    {
+        return m_x;
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::GetY() const
+    {
+        return m_y;
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::SetX(Simd::Vec8::FloatArgType x)
+    {
+        m_x = x;
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::SetY(Simd::Vec8::FloatArgType y)
+    {
+        m_y = y;
+    }
+
+
+    AZ_MATH_INLINE void Vector3x8::SetZ(Simd::Vec8::FloatArgType z)
+    {
+        m_z = z;
+    }
+
+
+    AZ_MATH_INLINE Vector3 Vector3x8::GetElement(int32_t index) const
+    {
+        AZ_MATH_ASSERT((index >= 0) && (index < ElementCount), "Invalid index for element access.\n");
+        AZ_ALIGN(float xs[ElementCount], 32);
+        AZ_ALIGN(float ys[ElementCount], 32);
+        AZ_ALIGN(float zs[ElementCount], 32);
+        StoreAligned(xs, ys, zs);
+        return Vector3(xs[index], ys[index], zs[index]);
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::Dot(const Vector3x8& rhs) const
+    {
+        return Simd::Vec8::Madd(m_z, rhs.m_z, Simd::Vec8::Madd(m_y, rhs.m_y, Simd::Vec8::Mul(m_x, rhs.m_x)));
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::Dot(const Vector3& rhs) const
+    {
+        return Dot(Vector3x8(rhs));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::Cross(const Vector3x8& rhs) const
+    {
+        return Vector3x8
+        (
+            Simd::Vec8::Sub(Simd::Vec8::Mul(m_y, rhs.m_z), Simd::Vec8::Mul(m_z, rhs.m_y)),
+            Simd::Vec8::Sub(Simd::Vec8::Mul(m_z, rhs.m_x), Simd::Vec8::Mul(m_x, rhs.m_z)),
+            Simd::Vec8::Sub(Simd::Vec8::Mul(m_x, rhs.m_y), Simd::Vec8::Mul(m_y, rhs.m_x))
+        );
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::GetLengthSq() const
+    {
+        return Dot(*this);
+    }
+
+
+    AZ_MATH_INLINE Simd::Vec8::FloatType Vector3x8::GetLength() const
+    {
+        return Simd::Vec8::Sqrt(GetLengthSq());
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::GetNormalized() const
+    {
+        return *this * Simd::Vec8::SqrtInv(GetLengthSq());
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::GetAbs() const
+    {
+        return Vector3x8(Simd::Vec8::Abs(m_x), Simd::Vec8::Abs(m_y), Simd::Vec8::Abs(m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::GetMin(const Vector3x8& rhs) const
+    {
+        return Vector3x8(Simd::Vec8::Min(m_x, rhs.m_x), Simd::Vec8::Min(m_y, rhs.m_y), Simd::Vec8::Min(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::GetMax(const Vector3x8& rhs) const
+    {
+        return Vector3x8(Simd::Vec8::Max(m_x, rhs.m_x), Simd::Vec8::Max(m_y, rhs.m_y), Simd::Vec8::Max(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::GetMadd(const Vector3x8& mul, const Vector3x8& add) const
+    {
+        return Vector3x8(Simd::Vec8::Madd(m_x, mul.m_x, add.m_x), Simd::Vec8::Madd(m_y, mul.m_y, add.m_y), Simd::Vec8::Madd(m_z, mul.m_z, add.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator-() const
+    {
+        const Simd::Vec8::FloatType zero = Simd::Vec8::ZeroFloat();
+        return Vector3x8(Simd::Vec8::Sub(zero, m_x), Simd::Vec8::Sub(zero, m_y), Simd::Vec8::Sub(zero, m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator+(const Vector3x8& rhs) const
+    {
+        return Vector3x8(Simd::Vec8::Add(m_x, rhs.m_x), Simd::Vec8::Add(m_y, rhs.m_y), Simd::Vec8::Add(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator-(const Vector3x8& rhs) const
+    {
+        return Vector3x8(Simd::Vec8::Sub(m_x, rhs.m_x), Simd::Vec8::Sub(m_y, rhs.m_y), Simd::Vec8::Sub(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator*(const Vector3x8& rhs) const
+    {
+        return Vector3x8(Simd::Vec8::Mul(m_x, rhs.m_x), Simd::Vec8::Mul(m_y, rhs.m_y), Simd::Vec8::Mul(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator*(float multiplier) const
+    {
+        return *this * Simd::Vec8::Splat(multiplier);
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Vector3x8::operator*(Simd::Vec8::FloatArgType multiplier) const
+    {
+        return Vector3x8(Simd::Vec8::Mul(m_x, multiplier), Simd::Vec8::Mul(m_y, multiplier), Simd::Vec8::Mul(m_z, multiplier));
+    }
+
+
+    AZ_MATH_INLINE Vector3x8& Vector3x8::operator+=(const Vector3x8& rhs)
+    {
+        *this = *this + rhs;
+        return *this;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8& Vector3x8::operator-=(const Vector3x8& rhs)
+    {
+        *this = *this - rhs;
+        return *this;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8& Vector3x8::operator*=(const Vector3x8& rhs)
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8& Vector3x8::operator*=(float multiplier)
+    {
+        *this = *this * multiplier;
+        return *this;
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Transform::TransformVector(const Vector3x8& rhs) const
+    {
+        // Expand the rotation and scale into basis vectors once, so each batch costs nine multiply adds
+        const Vector3 basisX = GetBasisX();
+        const Vector3 basisY = GetBasisY();
+        const Vector3 basisZ = GetBasisZ();
+        return Vector3x8
+        (
+            Simd::Vec8::Madd(rhs.GetZ(), Simd::Vec8::Splat(basisZ.GetX()), Simd::Vec8::Madd(rhs.GetY(), Simd::Vec8::Splat(basisY.GetX()), Simd::Vec8::Mul(rhs.GetX(), Simd::Vec8::Splat(basisX.GetX())))),
+            Simd::Vec8::Madd(rhs.GetZ(), Simd::Vec8::Splat(basisZ.GetY()), Simd::Vec8::Madd(rhs.GetY(), Simd::Vec8::Splat(basisY.GetY()), Simd::Vec8::Mul(rhs.GetX(), Simd::Vec8::Splat(basisX.GetY())))),
+            Simd::Vec8::Madd(rhs.GetZ(), Simd::Vec8::Splat(basisZ.GetZ()), Simd::Vec8::Madd(rhs.GetY(), Simd::Vec8::Splat(basisY.GetZ()), Simd::Vec8::Mul(rhs.GetX(), Simd::Vec8::Splat(basisX.GetZ()))))
+        );
+    }
+
+
+    AZ_MATH_INLINE Vector3x8 Transform::TransformPoint(const Vector3x8& rhs) const
+    {
+        return TransformVector(rhs) + Vector3x8(m_translation);
+    }
+}
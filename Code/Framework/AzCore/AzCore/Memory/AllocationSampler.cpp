@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/IAllocator.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        namespace
+        {
+            // Per thread sampling state, plain values so they can be used with any AZ_THREAD_LOCAL implementation.
+            static AZ_THREAD_LOCAL AZ::u32 s_threadGeneration = 0;
+            static AZ_THREAD_LOCAL AZ::s64 s_threadBytesUntilSample = 0;
+            static AZ_THREAD_LOCAL AZ::u64 s_threadRandom = 0;
+            static AZ_THREAD_LOCAL bool s_threadIsSampling = false;
+
+            /// Returns the distance in bytes to the next sample, exponentially distributed with the given mean.
+            AZ::s64 NextSampleDistance(size_t meanBytes)
+            {
+                if (s_threadRandom == 0)
+                {
+                    s_threadRandom = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(&s_threadRandom)) ^ static_cast<AZ::u64>(AZStd::GetTimeNowTicks())) | 1;
+                }
+                // xorshift64*
+                s_threadRandom ^= s_threadRandom >> 12;
+                s_threadRandom ^= s_threadRandom << 25;
+                s_threadRandom ^= s_threadRandom >> 27;
+                const AZ::u64 random = s_threadRandom * 0x2545F4914F6CDD1Dull;
+                const double uniform = (static_cast<double>(random >> 11) + 1.0) * (1.0 / 9007199254740992.0); // (0, 1]
+                return static_cast<AZ::s64>(-log(uniform) * static_cast<double>(meanBytes)) + 1;
+            }
+
+            AZ::u64 HashFrames(const StackFrame* frames, unsigned int numFrames)
+            {
+                // FNV-1a over the program counters
+                AZ::u64 hash = 0xcbf29ce484222325ull;
+                for (unsigned int i = 0; i < numFrames; ++i)
+                {
+                    hash ^= static_cast<AZ::u64>(frames[i].m_programCounter);
+                    hash *= 0x100000001b3ull;
+                }
+                return hash;
+            }
+
+            /// Returns a function name for the program counter, from the decoded stack line (without the address/offset decorations).
+            AZStd::string DecodeFunctionName(const StackFrame& frame)
+            {
+                SymbolStorage::StackLine line;
+                line[0] = 0;
+                SymbolStorage::DecodeFrames(&frame, 1, &line);
+                AZStd::string name(line);
+                const size_t decoration = name.find(" (+0x");
+                if (decoration != AZStd::string::npos)
+                {
+                    name.resize(decoration);
+                }
+                if (name.empty())
+                {
+                    char address[32];
+                    azsnprintf(address, AZ_ARRAY_SIZE(address), "0x%llx", static_cast<unsigned long long>(frame.m_programCounter));
+                    name = address;
+                }
+                return name;
+            }
+
+            /// Minimal protobuf wire format writer, enough for the pprof profile.proto messages.
+            class ProtobufWriter
+            {
+            public:
+                void Varint(AZ::u64 value)
+                {
+                    while (value >= 0x80)
+                    {
+                        m_data.push_back(static_cast<AZ::u8>(value | 0x80));
+                        value >>= 7;
+                    }
+                    m_data.push_back(static_cast<AZ::u8>(value));
+                }
+                void Int(AZ::u32 field, AZ::u64 value)
+                {
+                    if (value != 0) // default values are omitted
+                    {
+                        Varint(field << 3); // wire type 0, varint
+                        Varint(value);
+                    }
+                }
+                void Bytes(AZ::u32 field, const void* data, size_t size)
+                {
+                    Varint((field << 3) | 2); // wire type 2, length delimited
+                    Varint(size);
+                    m_data.insert(m_data.end(), reinterpret_cast<const AZ::u8*>(data), reinterpret_cast<const AZ::u8*>(data) + size);
+                }
+                void Message(AZ::u32 field, const ProtobufWriter& message)
+                {
+                    Bytes(field, message.m_data.data(), message.m_data.size());
+                }
+                void PackedInts(AZ::u32 field, const AZ::u64* values, size_t numValues)
+                {
+                    ProtobufWriter packed;
+                    for (size_t i = 0; i < numValues; ++i)
+                    {
+                        packed.Varint(values[i]);
+                    }
+                    Message(field, packed);
+                }
+                void Clear()
+                {
+                    m_data.clear();
+                }
+
+                AZStd::vector<AZ::u8> m_data;
+            };
+
+            class StringTable
+            {
+            public:
+                StringTable(AZ::u64 firstIndex)
+                    : m_nextIndex(firstIndex)
+                {}
+
+                /// Returns the index of the string and true if it was just added.
+                AZStd::pair<AZ::u64, bool> Insert(const AZStd::string& value)
+                {
+                    auto result = m_indices.emplace(value, m_nextIndex);
+                    if (result.second)
+                    {
+                        ++m_nextIndex;
+                    }
+                    return AZStd::make_pair(result.first->second, result.second);
+                }
+
+            private:
+                AZStd::unordered_map<AZStd::string, AZ::u64> m_indices;
+                AZ::u64 m_nextIndex;
+            };
+
+            bool WriteString(IO::GenericStream& stream, const char* format, ...)
+            {
+                char buffer[1024];
+                va_list args;
+                va_start(args, format);
+                const int length = azvsnprintf(buffer, AZ_ARRAY_SIZE(buffer), format, args);
+                va_end(args);
+                if (length < 0)
+                {
+                    return false;
+                }
+                const size_t size = AZStd::GetMin(static_cast<size_t>(length), AZ_ARRAY_SIZE(buffer) - 1);
+                return stream.Write(size, buffer) == size;
+            }
+        }
+
+        //=========================================================================
+        // AllocationSampler
+        //=========================================================================
+        AllocationSampler::AllocationSampler(IAllocatorAllocate* dataAllocator)
+            : m_callsites(AZStdIAllocator(dataAllocator))
+            , m_liveSamples(AZStdIAllocator(dataAllocator))
+        {
+            for (AZStd::atomic<AZ::u8>& counter : m_addressFilter)
+            {
+                counter.store(0, AZStd::memory_order_relaxed);
+            }
+        }
+
+        AllocationSampler::~AllocationSampler() = default;
+
+        //=========================================================================
+        // Start
+        //=========================================================================
+        void AllocationSampler::Start(const Descriptor& desc)
+        {
+            AZ_Assert(desc.m_sampleIntervalBytes > 0, "Sample interval must be at least one byte");
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_desc = desc;
+            m_desc.m_stackRecordLevels = static_cast<unsigned char>(AZStd::GetMin<unsigned int>(desc.m_stackRecordLevels, MaxStackRecordLevels));
+            m_callsites.clear();
+            m_liveSamples.clear();
+            for (AZStd::atomic<AZ::u8>& counter : m_addressFilter)
+            {
+                counter.store(0, AZStd::memory_order_relaxed);
+            }
+            m_sampleIntervalBytes.store(AZStd::GetMax<size_t>(desc.m_sampleIntervalBytes, 1), AZStd::memory_order_relaxed);
+            m_generation.fetch_add(1, AZStd::memory_order_release);
+            m_isActive.store(true, AZStd::memory_order_release);
+        }
+
+        //=========================================================================
+        // Stop
+        //=========================================================================
+        void AllocationSampler::Stop()
+        {
+            m_isActive.store(false, AZStd::memory_order_release);
+        }
+
+        //=========================================================================
+        // RecordAllocation
+        //=========================================================================
+        void AllocationSampler::RecordAllocation(IAllocator* allocator, void* address, size_t byteSize, unsigned int suppressStackRecord)
+        {
+            if (!address || !m_isActive.load(AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            const size_t sampleIntervalBytes = m_sampleIntervalBytes.load(AZStd::memory_order_relaxed);
+            const AZ::u32 generation = m_generation.load(AZStd::memory_order_acquire);
+            if (s_threadGeneration != generation)
+            {
+                s_threadGeneration = generation;
+                s_threadBytesUntilSample = NextSampleDistance(sampleIntervalBytes);
+            }
+
+            s_threadBytesUntilSample -= static_cast<AZ::s64>(byteSize);
+            if (s_threadBytesUntilSample > 0 || s_threadIsSampling)
+            {
+                return;
+            }
+            // the process is memoryless, the next sample point is independent from how far we went past this one
+            s_threadBytesUntilSample = NextSampleDistance(sampleIntervalBytes);
+
+            s_threadIsSampling = true;
+            AddSample(allocator, address, byteSize, sampleIntervalBytes, suppressStackRecord + 1);
+            s_threadIsSampling = false;
+        }
+
+        //=========================================================================
+        // AddSample
+        //=========================================================================
+        void AllocationSampler::AddSample(IAllocator* allocator, void* address, size_t byteSize, size_t sampleIntervalBytes, unsigned int suppressStackRecord)
+        {
+            StackFrame frames[MaxStackRecordLevels];
+            const unsigned int numFrames = StackRecorder::Record(frames, m_desc.m_stackRecordLevels, suppressStackRecord + 1);
+            const AZ::u64 callsiteKey = HashFrames(frames, numFrames);
+
+            // An allocation of byteSize bytes is sampled with probability 1 - e^(-byteSize/interval),
+            // so every sample stands for 1/probability allocations of that size.
+            const double probability = 1.0 - exp(-static_cast<double>(byteSize) / static_cast<double>(sampleIntervalBytes));
+            const double weight = probability > 0.0 ? 1.0 / probability : 1.0;
+            LiveSample sample;
+            sample.m_callsiteKey = callsiteKey;
+            sample.m_count = static_cast<AZ::u64>(weight + 0.5);
+            sample.m_bytes = static_cast<AZ::u64>(weight * static_cast<double>(byteSize) + 0.5);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            // an address can be reused without us seeing the free (sampling restarted, allocator without deallocation profiling)
+            LiveSampleMap::iterator previous = m_liveSamples.find(address);
+            if (previous != m_liveSamples.end())
+            {
+                RemoveLiveSample(previous);
+            }
+
+            Callsite& callsite = m_callsites[callsiteKey];
+            if (callsite.m_numSamples == 0)
+            {
+                memcpy(callsite.m_frames, frames, sizeof(StackFrame) * numFrames);
+                callsite.m_numFrames = numFrames;
+                callsite.m_allocatorName = allocator ? allocator->GetName() : nullptr;
+            }
+            callsite.m_numSamples++;
+            callsite.m_numLiveSamples++;
+            callsite.m_allocatedCount += sample.m_count;
+            callsite.m_allocatedBytes += sample.m_bytes;
+            callsite.m_inUseCount += sample.m_count;
+            callsite.m_inUseBytes += sample.m_bytes;
+
+            m_liveSamples.emplace(address, sample);
+            AZStd::atomic<AZ::u8>& filterCounter = m_addressFilter[AddressFilterIndex(address)];
+            const AZ::u8 count = filterCounter.load(AZStd::memory_order_relaxed);
+            if (count != AddressFilterSaturated)
+            {
+                filterCounter.store(count + 1, AZStd::memory_order_relaxed);
+            }
+        }
+
+        //=========================================================================
+        // RemoveSample
+        //=========================================================================
+        void AllocationSampler::RemoveSample(void* address)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            LiveSampleMap::iterator sampleIt = m_liveSamples.find(address);
+            if (sampleIt != m_liveSamples.end())
+            {
+                RemoveLiveSample(sampleIt);
+            }
+        }
+
+        //=========================================================================
+        // RemoveLiveSample
+        //=========================================================================
+        void AllocationSampler::RemoveLiveSample(LiveSampleMap::iterator sampleIt)
+        {
+            CallsiteMap::iterator callsiteIt = m_callsites.find(sampleIt->second.m_callsiteKey);
+            if (callsiteIt != m_callsites.end())
+            {
+                Callsite& callsite = callsiteIt->second;
+                callsite.m_numLiveSamples--;
+                callsite.m_inUseCount -= sampleIt->second.m_count;
+                callsite.m_inUseBytes -= sampleIt->second.m_bytes;
+            }
+
+            AZStd::atomic<AZ::u8>& filterCounter = m_addressFilter[AddressFilterIndex(sampleIt->first)];
+            const AZ::u8 count = filterCounter.load(AZStd::memory_order_relaxed);
+            if (count != AddressFilterSaturated)
+            {
+                filterCounter.store(count - 1, AZStd::memory_order_relaxed);
+            }
+            m_liveSamples.erase(sampleIt);
+        }
+
+        //=========================================================================
+        // GetCallsites
+        //=========================================================================
+        void AllocationSampler::GetCallsites(CallsiteList& callsites) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            callsites.reserve(callsites.size() + m_callsites.size());
+            for (const auto& callsite : m_callsites)
+            {
+                callsites.push_back(callsite.second);
+            }
+        }
+
+        //=========================================================================
+        // GetNumLiveSamples
+        //=========================================================================
+        size_t AllocationSampler::GetNumLiveSamples() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_liveSamples.size();
+        }
+
+        //=========================================================================
+        // ExportPprof
+        //=========================================================================
+        bool AllocationSampler::ExportPprof(IO::GenericStream& stream, bool symbolize) const
+        {
+            // see https://github.com/google/pprof/blob/main/proto/profile.proto
+            enum ProfileField : AZ::u32
+            {
+                Profile_SampleType = 1,
+                Profile_Sample = 2,
+                Profile_Location = 4,
+                Profile_Function = 5,
+                Profile_StringTable = 6,
+                Profile_PeriodType = 11,
+                Profile_Period = 12,
+                Profile_DefaultSampleType = 14,
+
+                ValueType_Type = 1,
+                ValueType_Unit = 2,
+
+                Sample_LocationId = 1,
+                Sample_Value = 2,
+                Sample_Label = 3,
+
+                Label_Key = 1,
+                Label_Str = 2,
+
+                Location_Id = 1,
+                Location_Address = 3,
+                Location_Line = 4,
+
+                Line_FunctionId = 1,
+
+                Function_Id = 1,
+                Function_Name = 2,
+                Function_SystemName = 3,
+            };
+
+            // the callsites are copied first, no allocation can happen while the sampler is locked
+            CallsiteList callsites;
+            GetCallsites(callsites);
+
+            AZStd::vector<AZStd::string> strings = { "", "alloc_objects", "count", "alloc_space", "bytes", "inuse_objects", "inuse_space", "space", "allocator" };
+            StringTable stringTable(strings.size());
+            enum : AZ::u64 { AllocObjects = 1, Count, AllocSpace, Bytes, InUseObjects, InUseSpace, Space, Allocator };
+            auto stringIndex = [&strings, &stringTable](const AZStd::string& value)
+            {
+                auto result = stringTable.Insert(value);
+                if (result.second)
+                {
+                    strings.push_back(value);
+                }
+                return result.first;
+            };
+
+            ProtobufWriter profile;
+            ProtobufWriter message;
+            ProtobufWriter subMessage;
+            const AZ::u64 sampleTypes[][2] = { { AllocObjects, Count }, { AllocSpace, Bytes }, { InUseObjects, Count }, { InUseSpace, Bytes } };
+            for (const auto& sampleType : sampleTypes)
+            {
+                message.Clear();
+                message.Int(ValueType_Type, sampleType[0]);
+                message.Int(ValueType_Unit, sampleType[1]);
+                profile.Message(Profile_SampleType, message);
+            }
+
+            AZStd::unordered_map<uintptr_t, AZ::u64> locationIds;
+            AZStd::unordered_map<AZStd::string, AZ::u64> functionIds;
+            AZStd::vector<AZ::u64> sampleLocations;
+            for (const Callsite& callsite : callsites)
+            {
+                sampleLocations.clear();
+                for (unsigned int i = 0; i < callsite.m_numFrames; ++i)
+                {
+                    const StackFrame& frame = callsite.m_frames[i];
+                    auto location = locationIds.emplace(frame.m_programCounter, locationIds.size() + 1);
+                    if (location.second)
+                    {
+                        message.Clear();
+                        message.Int(Location_Id, location.first->second);
+                        message.Int(Location_Address, frame.m_programCounter);
+                        if (symbolize)
+                        {
+                            const AZStd::string name = DecodeFunctionName(frame);
+                            auto function = functionIds.emplace(name, functionIds.size() + 1);
+                            if (function.second)
+                            {
+                                subMessage.Clear();
+                                subMessage.Int(Function_Id, function.first->second);
+                                subMessage.Int(Function_Name, stringIndex(name));
+                                subMessage.Int(Function_SystemName, stringIndex(name));
+                                profile.Message(Profile_Function, subMessage);
+                            }
+                            subMessage.Clear();
+                            subMessage.Int(Line_FunctionId, function.first->second);
+                            message.Message(Location_Line, subMessage);
+                        }
+                        profile.Message(Profile_Location, message);
+                    }
+                    sampleLocations.push_back(location.first->second);
+                }
+
+                const AZ::u64 values[] = { callsite.m_allocatedCount, callsite.m_allocatedBytes, callsite.m_inUseCount, callsite.m_inUseBytes };
+                message.Clear();
+                message.PackedInts(Sample_LocationId, sampleLocations.data(), sampleLocations.size());
+                message.PackedInts(Sample_Value, values, AZ_ARRAY_SIZE(values));
+                if (callsite.m_allocatorName)
+                {
+                    subMessage.Clear();
+                    subMessage.Int(Label_Key, Allocator);
+                    subMessage.Int(Label_Str, stringIndex(callsite.m_allocatorName));
+                    message.Message(Sample_Label, subMessage);
+                }
+                profile.Message(Profile_Sample, message);
+            }
+
+            for (const AZStd::string& value : strings)
+            {
+                profile.Bytes(Profile_StringTable, value.data(), value.size());
+            }
+            message.Clear();
+            message.Int(ValueType_Type, Space);
+            message.Int(ValueType_Unit, Bytes);
+            profile.Message(Profile_PeriodType, message);
+            profile.Int(Profile_Period, m_sampleIntervalBytes.load(AZStd::memory_order_relaxed));
+            profile.Int(Profile_DefaultSampleType, InUseSpace);
+
+            return stream.Write(profile.m_data.size(), profile.m_data.data()) == profile.m_data.size();
+        }
+
+        //=========================================================================
+        // ExportHeaptrack
+        //=========================================================================
+        bool AllocationSampler::ExportHeaptrack(IO::GenericStream& stream, bool symbolize) const
+        {
+            // Heaptrack data file (as written by heaptrack_interpret), all numbers are hexadecimal and strings,
+            // instruction pointers and traces are referenced by their 1 based index of appearance.
+            CallsiteList callsites;
+            GetCallsites(callsites);
+
+            bool result = WriteString(stream, "v 10200 2\n");
+            result = result && WriteString(stream, "# AZ::Debug::AllocationSampler profile, sample interval %zu bytes, one allocation per sample\n",
+                m_sampleIntervalBytes.load(AZStd::memory_order_relaxed));
+
+            StringTable stringTable(1);
+            auto stringIndex = [&stream, &stringTable, &result](const AZStd::string& value)
+            {
+                auto index = stringTable.Insert(value);
+                if (index.second)
+                {
+                    result = result && WriteString(stream, "s %s\n", value.c_str());
+                }
+                return index.first;
+            };
+            const AZ::u64 moduleIndex = stringIndex("<sampled>");
+
+            AZStd::unordered_map<uintptr_t, AZ::u64> ipIndices;
+            AZStd::unordered_map<AZStd::pair<AZ::u64, AZ::u64>, AZ::u64> traceIndices; // (ip, parent trace) -> trace
+            AZ::u64 allocationInfoIndex = 0;
+            for (const Callsite& callsite : callsites)
+            {
+                // the trace tree goes from the root (outermost frame) to the allocation
+                AZ::u64 traceIndex = 0;
+                for (unsigned int i = callsite.m_numFrames; i-- > 0;)
+                {
+                    const StackFrame& frame = callsite.m_frames[i];
+                    auto ip = ipIndices.emplace(frame.m_programCounter, ipIndices.size() + 1);
+                    if (ip.second)
+                    {
+                        if (symbolize)
+                        {
+                            const AZ::u64 functionIndex = stringIndex(DecodeFunctionName(frame));
+                            result = result && WriteString(stream, "i %llx %llx %llx 0 0\n", static_cast<unsigned long long>(frame.m_programCounter),
+                                static_cast<unsigned long long>(moduleIndex), static_cast<unsigned long long>(functionIndex));
+                        }
+                        else
+                        {
+                            result = result && WriteString(stream, "i %llx %llx\n", static_cast<unsigned long long>(frame.m_programCounter),
+                                static_cast<unsigned long long>(moduleIndex));
+                        }
+                    }
+                    auto trace = traceIndices.emplace(AZStd::make_pair(ip.first->second, traceIndex), traceIndices.size() + 1);
+                    if (trace.second)
+                    {
+                        result = result && WriteString(stream, "t %llx %llx\n", static_cast<unsigned long long>(ip.first->second),
+                            static_cast<unsigned long long>(traceIndex));
+                    }
+                    traceIndex = trace.first->second;
+                }
+
+                if (callsite.m_numSamples == 0)
+                {
+                    continue;
+                }
+                const AZ::u64 sampleBytes = AZStd::GetMax<AZ::u64>(callsite.m_allocatedBytes / callsite.m_numSamples, 1);
+                result = result && WriteString(stream, "a %llx %llx\n", static_cast<unsigned long long>(sampleBytes), static_cast<unsigned long long>(traceIndex));
+                // freed samples right away, so the peak is close to the memory in use
+                for (AZ::u64 i = 0; i < callsite.m_numSamples && result; ++i)
+                {
+                    const bool isLive = i < callsite.m_numLiveSamples;
+                    result = WriteString(stream, isLive ? "+ %llx\n" : "+ %llx\n- %llx\n",
+                        static_cast<unsigned long long>(allocationInfoIndex), static_cast<unsigned long long>(allocationInfoIndex));
+                }
+                ++allocationInfoIndex;
+            }
+            return result;
+        }
+    } // namespace Debug
+} // namespace AZ
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    class IAllocator;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    namespace Debug
+    {
+        /**
+         * Sampling heap profiler, a low overhead alternative to the AllocationRecords which can be left enabled
+         * on long running (soak test, server) processes.
+         * Instead of recording every allocation, allocations are sampled with a Poisson process: on average one
+         * sample is taken every \ref Descriptor::m_sampleIntervalBytes allocated bytes, so big allocations are much
+         * more likely to be sampled than small ones. The callstack of each sample is recorded and samples are
+         * aggregated by callsite (callstack). Each sample is weighted with the number of bytes and allocations it
+         * statistically represents, so the totals are unbiased estimates of the real ones.
+         *
+         * Sampled allocations are tracked until they are freed, which gives the estimated memory in use per callsite.
+         * The collected profile can be exported to pprof (go tool pprof, speedscope...) or heaptrack (heaptrack_gui,
+         * heaptrack_print) files.
+         *
+         * The sampler is owned by the AllocatorManager, see \ref AllocatorManager::StartAllocationSampling.
+         * All the functions are thread safe.
+         */
+        class AllocationSampler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(AllocationSampler, OSAllocator, 0);
+
+            struct Descriptor
+            {
+                size_t          m_sampleIntervalBytes = 512 * 1024; ///< Mean number of bytes allocated between two samples.
+                unsigned char   m_stackRecordLevels = 32;           ///< Max number of callstack levels recorded for each sample.
+            };
+
+            static const unsigned int MaxStackRecordLevels = 64;
+
+            /// Allocations aggregated by callsite.
+            struct Callsite
+            {
+                StackFrame      m_frames[MaxStackRecordLevels]; ///< Callstack of the allocations, innermost frame first.
+                unsigned int    m_numFrames = 0;
+                const char*     m_allocatorName = nullptr;      ///< Allocator of the first sampled allocation.
+                AZ::u64         m_numSamples = 0;
+                AZ::u64         m_numLiveSamples = 0;           ///< Samples not freed yet.
+                AZ::u64         m_allocatedCount = 0;           ///< Estimated number of allocations.
+                AZ::u64         m_allocatedBytes = 0;           ///< Estimated allocated bytes.
+                AZ::u64         m_inUseCount = 0;               ///< Estimated number of allocations not freed yet.
+                AZ::u64         m_inUseBytes = 0;               ///< Estimated bytes not freed yet.
+            };
+            using CallsiteList = AZStd::vector<Callsite, OSStdAllocator>;
+
+            /// \param dataAllocator Allocator for the sampler data, must not be reporting to the sampler.
+            explicit AllocationSampler(IAllocatorAllocate* dataAllocator);
+            ~AllocationSampler();
+
+            /// Starts sampling, discards the previous profile.
+            void Start(const Descriptor& desc);
+            /// Stops sampling, the collected profile can still be retrieved and exported.
+            void Stop();
+            bool IsActive() const { return m_isActive.load(AZStd::memory_order_relaxed); }
+            const Descriptor& GetDescriptor() const { return m_desc; }
+
+            //////////////////////////////////////////////////////////////////////////
+            // Called by the allocators (AllocatorBase) for every allocation.
+            void RecordAllocation(IAllocator* allocator, void* address, size_t byteSize, unsigned int suppressStackRecord);
+            void RecordDeallocation(void* address)
+            {
+                // cheap filter, only (possibly) sampled addresses take the lock
+                if (address && m_addressFilter[AddressFilterIndex(address)].load(AZStd::memory_order_relaxed) != 0)
+                {
+                    RemoveSample(address);
+                }
+            }
+            //////////////////////////////////////////////////////////////////////////
+
+            /// Returns the callsites of all the samples collected since Start.
+            void GetCallsites(CallsiteList& callsites) const;
+            /// Returns the number of samples currently tracked as in use.
+            size_t GetNumLiveSamples() const;
+
+            /**
+             * Writes the profile in the pprof protobuf format (uncompressed, which pprof accepts), with the alloc_objects,
+             * alloc_space, inuse_objects and inuse_space sample types.
+             * \param symbolize Store the decoded function names, otherwise only the addresses are stored (faster, but
+             * the addresses can't be resolved on a different process run).
+             */
+            bool ExportPprof(IO::GenericStream& stream, bool symbolize = true) const;
+            /**
+             * Writes the profile in the heaptrack (file format version 2) text format, each sample is reported as one
+             * allocation of the bytes it represents. There is no timeline as samples are aggregated.
+             */
+            bool ExportHeaptrack(IO::GenericStream& stream, bool symbolize = true) const;
+
+        private:
+            AllocationSampler(const AllocationSampler&) = delete;
+            AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+            static const size_t AddressFilterSize = 64 * 1024; // power of 2
+            static const AZ::u8 AddressFilterSaturated = 0xff; // saturated counters are never decremented
+
+            struct LiveSample
+            {
+                AZ::u64 m_callsiteKey;
+                AZ::u64 m_count;
+                AZ::u64 m_bytes;
+            };
+
+            using CallsiteMap = AZStd::unordered_map<AZ::u64, Callsite, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, AZStdIAllocator>;
+            using LiveSampleMap = AZStd::unordered_map<void*, LiveSample, AZStd::hash<void*>, AZStd::equal_to<void*>, AZStdIAllocator>;
+
+            static AZ_FORCE_INLINE size_t AddressFilterIndex(void* address)
+            {
+                // allocations are at least 8 bytes aligned, drop the low bits and mix the rest
+                AZ::u64 value = static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address) >> 3);
+                value *= 0x9E3779B97F4A7C15ull;
+                return static_cast<size_t>(value >> 48) & (AddressFilterSize - 1);
+            }
+
+            void AddSample(IAllocator* allocator, void* address, size_t byteSize, size_t sampleIntervalBytes, unsigned int suppressStackRecord);
+            void RemoveLiveSample(LiveSampleMap::iterator sampleIt);
+            void RemoveSample(void* address);
+
+            Descriptor m_desc;
+            AZStd::atomic_bool m_isActive{ false };
+            AZStd::atomic_size_t m_sampleIntervalBytes{ 0 };
+            AZStd::atomic<AZ::u32> m_generation{ 0 }; ///< incremented on Start, makes threads reset their sampling state
+            AZStd::atomic<AZ::u8> m_addressFilter[AddressFilterSize]; ///< number of live samples per address hash
+
+            mutable AZStd::mutex m_mutex;
+            CallsiteMap m_callsites;
+            LiveSampleMap m_liveSamples;
+        };
+    } // namespace Debug
+} // namespace AZ
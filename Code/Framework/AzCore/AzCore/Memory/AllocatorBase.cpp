@@ -7,6 +7,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
 
 using namespace AZ;
@@ -49,6 +50,16 @@ void AllocatorBase::SetRecords(Debug::AllocationRecords* records)
     m_memoryGuardSize = records ? records->MemoryGuardSize() : 0;
 }
 
+Debug::AllocationSampler* AllocatorBase::GetAllocationSampler() const
+{
+    return m_sampler;
+}
+
+void AllocatorBase::SetAllocationSampler(Debug::AllocationSampler* sampler)
+{
+    m_sampler = sampler;
+}
+
 bool AllocatorBase::IsReady() const
 {
     return m_isReady;
@@ -127,6 +138,11 @@ void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignme
     ++suppressStackRecord; // one more for the fact the ebus is a function
 #endif // AZ_HAS_VARIADIC_TEMPLATES
 
+    if (m_sampler)
+    {
+        m_sampler->RecordAllocation(this, ptr, byteSize, suppressStackRecord + 1);
+    }
+
     if (m_isProfilingActive)
     {
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
@@ -139,6 +155,11 @@ void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignme
 
 void AllocatorBase::ProfileDeallocation(void* ptr, size_t byteSize, size_t alignment, Debug::AllocationInfo* info)
 {
+    if (m_sampler)
+    {
+        m_sampler->RecordDeallocation(ptr);
+    }
+
     if (m_isProfilingActive)
     {
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
@@ -165,6 +186,12 @@ void AllocatorBase::ProfileReallocationBegin(void* ptr, size_t newSize)
 
 void AllocatorBase::ProfileReallocationEnd(void* ptr, void* newPtr, size_t newSize, size_t newAlignment)
 {
+    if (m_sampler)
+    {
+        m_sampler->RecordDeallocation(ptr);
+        m_sampler->RecordAllocation(this, newPtr, newSize, 1);
+    }
+
     if (m_isProfilingActive)
     {
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
@@ -35,6 +35,8 @@ namespace AZ
         IAllocatorAllocate* GetSchema() override;
         Debug::AllocationRecords* GetRecords() final;
         void SetRecords(Debug::AllocationRecords* records) final;
+        Debug::AllocationSampler* GetAllocationSampler() const final;
+        void SetAllocationSampler(Debug::AllocationSampler* sampler) final;
         bool IsReady() const final;
         bool CanBeOverridden() const final;
         void PostCreate() override;
@@ -103,6 +105,7 @@ namespace AZ
         const char* m_name = nullptr;
         const char* m_desc = nullptr;
         Debug::AllocationRecords* m_records = nullptr;  // Cached pointer to allocation records. Works together with the MemoryDriller.
+        Debug::AllocationSampler* m_sampler = nullptr;  // Set by the AllocatorManager while allocation sampling is active.
         size_t m_memoryGuardSize = 0;
         bool m_isLazilyCreated = false;
         bool m_isProfilingActive = false;
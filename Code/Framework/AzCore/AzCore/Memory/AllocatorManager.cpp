@@ -210,6 +210,10 @@ AllocatorManager::RegisterAllocator(class IAllocator* alloc)
     }
 
     alloc->SetProfilingActive(m_profilingRefcount.load() > 0);
+    if (m_allocationSampler && m_allocationSampler->IsActive())
+    {
+        alloc->SetAllocationSampler(m_allocationSampler);
+    }
 
     m_allocators[m_numAllocators++] = alloc;
 
@@ -236,6 +240,13 @@ AllocatorManager::InternalDestroy()
         // Do not actually destroy the lazy allocator as it may have work to do during non-deterministic shutdown
     }
 
+    if (m_allocationSampler)
+    {
+        m_allocationSampler->~AllocationSampler();
+        m_mallocSchema->DeAllocate(m_allocationSampler);
+        m_allocationSampler = nullptr;
+    }
+
     if (m_data)
     {
         m_data->~InternalData();
@@ -543,6 +554,37 @@ AllocatorManager::ExitProfilingMode()
     AZ_Assert(m_profilingRefcount.load() >= 0, "ExitProfilingMode called without matching EnterProfilingMode");
 }
 
+void
+AllocatorManager::StartAllocationSampling(const Debug::AllocationSampler::Descriptor& desc)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    if (!m_allocationSampler)
+    {
+        // the sampler data comes from the malloc schema, which is never sampled and outlives all the allocators
+        m_allocationSampler = new (m_mallocSchema->Allocate(sizeof(Debug::AllocationSampler), alignof(Debug::AllocationSampler), 0)) Debug::AllocationSampler(m_mallocSchema.get());
+    }
+    m_allocationSampler->Start(desc);
+
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        m_allocators[i]->SetAllocationSampler(m_allocationSampler);
+    }
+}
+
+void
+AllocatorManager::StopAllocationSampling()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    if (m_allocationSampler)
+    {
+        for (int i = 0; i < m_numAllocators; ++i)
+        {
+            m_allocators[i]->SetAllocationSampler(nullptr);
+        }
+        m_allocationSampler->Stop();
+    }
+}
+
 void
 AllocatorManager::DumpAllocators()
 {
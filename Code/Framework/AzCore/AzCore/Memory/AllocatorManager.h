@@ -8,6 +8,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -96,6 +97,14 @@ namespace AZ
         void EnterProfilingMode();
         void ExitProfilingMode();
 
+        /// Starts sampling the allocations of all registered allocators (including the ones registered later) with
+        /// the \ref Debug::AllocationSampler, discarding the previous samples. Sampling is not available in release builds.
+        void StartAllocationSampling(const Debug::AllocationSampler::Descriptor& desc);
+        /// Stops sampling, the collected samples are kept until sampling is started again.
+        void StopAllocationSampling();
+        /// Returns the allocation sampler, nullptr if sampling was never started.
+        Debug::AllocationSampler* GetAllocationSampler() const { return m_allocationSampler; }
+
         /// Outputs allocator useage to the console, and also stores the values in m_dumpInfo for viewing in the crash dump
         void DumpAllocators();
 
@@ -178,6 +187,7 @@ namespace AZ
         InternalData*       m_data;
         bool                m_configurationFinalized;
         AZStd::atomic<int>  m_profilingRefcount;
+        Debug::AllocationSampler* m_allocationSampler = nullptr; ///< Created on the first StartAllocationSampling, with the malloc schema.
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
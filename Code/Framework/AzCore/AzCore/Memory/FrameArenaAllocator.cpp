@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace
+    {
+        struct FrameArenaBlock
+        {
+            FrameArenaBlock* m_next;
+            size_t m_size; ///< usable bytes after the header
+        };
+        static const size_t FrameArenaBlockHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(FrameArenaBlock), 16);
+
+        AZ_FORCE_INLINE char* GetBlockData(FrameArenaBlock* block)
+        {
+            return reinterpret_cast<char*>(block) + FrameArenaBlockHeaderSize;
+        }
+    }
+
+    /**
+     * Linear arena of a single thread. The arena state is only accessed by the owning thread, except when ResetFrame
+     * resets all arenas, m_mutex guards against that. The atomics can be read by any thread for the statistics.
+     */
+    struct FrameArena
+    {
+        FrameArena* m_nextArena = nullptr;
+        AZStd::thread_id m_threadId;
+        AZStd::spin_mutex m_mutex;                  ///< only contended while ResetFrame runs
+
+        FrameArenaBlock* m_firstBlock = nullptr;    ///< blocks retained from frame to frame
+        FrameArenaBlock* m_currentBlock = nullptr;
+        FrameArenaBlock* m_largeBlocks = nullptr;   ///< dedicated blocks for big allocations, freed on reset
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;           ///< can be rolled back or resized
+
+        AZStd::atomic_size_t m_allocatedBytes{ 0 };
+        AZStd::atomic_size_t m_peakBytes{ 0 };      ///< max bytes allocated by the thread in a frame
+        AZStd::atomic_size_t m_capacityBytes{ 0 };
+        AZStd::atomic_bool m_isTrimRequested{ false };
+    };
+
+    namespace
+    {
+        // Last arena used by the thread. The schema id makes sure we never use an arena of a destroyed schema and
+        // it's good enough for multiple schemas, the (locked) lookup only happens when switching between them.
+        static AZ_THREAD_LOCAL FrameArena* s_threadArena = nullptr;
+        static AZ_THREAD_LOCAL AZ::u32 s_threadArenaSchemaId = 0;
+
+        AZ_FORCE_INLINE void AddBytes(AZStd::atomic_size_t& counter, ptrdiff_t bytes)
+        {
+            // the counters are only written with the arena lock held
+            counter.store(counter.load(AZStd::memory_order_relaxed) + bytes, AZStd::memory_order_relaxed);
+        }
+    }
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(const Descriptor& desc)
+        : m_desc(desc)
+    {
+        static AZStd::atomic<AZ::u32> s_nextId{ 1 };
+        m_id = s_nextId.fetch_add(1, AZStd::memory_order_relaxed);
+
+        if (m_desc.m_blockAllocator == nullptr)
+        {
+            m_desc.m_blockAllocator = &AllocatorInstance<SystemAllocator>::Get(); // use the SystemAllocator if no block allocator is provided
+        }
+        AZ_Assert(m_desc.m_blockSize > FrameArenaBlockHeaderSize, "Frame arena block size %zu is too small", m_desc.m_blockSize);
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        // all threads are expected to be done with the arena memory
+        FrameArena* arena = m_arenas;
+        while (arena)
+        {
+            FrameArena* next = arena->m_nextArena;
+            FreeLargeBlocks(arena);
+            FreeBlocks(arena, false);
+            arena->~FrameArena();
+            m_desc.m_blockAllocator->DeAllocate(arena, sizeof(FrameArena), AZStd::alignment_of<FrameArena>::value);
+            arena = next;
+        }
+        m_arenas = nullptr;
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaSchema::ResetFrame()
+    {
+        size_t frameBytes = 0;
+        {
+            // all arenas are reset here, so threads which stopped allocating don't keep (unpoisoned) memory of old frames
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            for (FrameArena* arena = m_arenas; arena; arena = arena->m_nextArena)
+            {
+                AZStd::lock_guard<AZStd::spin_mutex> arenaLock(arena->m_mutex);
+                const size_t arenaBytes = arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+                if (arenaBytes > arena->m_peakBytes.load(AZStd::memory_order_relaxed))
+                {
+                    arena->m_peakBytes.store(arenaBytes, AZStd::memory_order_relaxed);
+                }
+                frameBytes += arenaBytes;
+                ResetArena(arena);
+            }
+        }
+        m_lastFrameBytes.store(frameBytes, AZStd::memory_order_relaxed);
+        if (frameBytes > m_peakBytes.load(AZStd::memory_order_relaxed))
+        {
+            m_peakBytes.store(frameBytes, AZStd::memory_order_relaxed);
+        }
+        m_frame.fetch_add(1, AZStd::memory_order_acq_rel);
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        FrameArena* arena = GetThreadArena();
+        if (!arena)
+        {
+            return nullptr;
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> lock(arena->m_mutex);
+
+        alignment = AZStd::GetMax(alignment, size_type(1));
+        char* address = reinterpret_cast<char*>(AZ_SIZE_ALIGN_UP(reinterpret_cast<size_t>(arena->m_current), alignment));
+        if (arena->m_current && address + byteSize <= arena->m_end)
+        {
+            AddBytes(arena->m_allocatedBytes, (address + byteSize) - arena->m_current);
+            arena->m_current = address + byteSize;
+            arena->m_lastAllocation = address;
+            return address;
+        }
+        return AllocateBlock(arena, byteSize, alignment);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        // memory is released in bulk, only the most recent allocation of the thread is rolled back
+        FrameArena* arena = s_threadArenaSchemaId == m_id ? s_threadArena : nullptr;
+        if (!ptr || !arena)
+        {
+            return;
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> lock(arena->m_mutex);
+        if (ptr == arena->m_lastAllocation)
+        {
+            AddBytes(arena->m_allocatedBytes, -(arena->m_current - arena->m_lastAllocation));
+            if (m_desc.m_poisonMemory)
+            {
+                memset(arena->m_lastAllocation, PoisonPattern, arena->m_current - arena->m_lastAllocation);
+            }
+            arena->m_current = arena->m_lastAllocation;
+            arena->m_lastAllocation = nullptr;
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        FrameArena* arena = s_threadArenaSchemaId == m_id ? s_threadArena : nullptr;
+        if (!ptr || !arena)
+        {
+            return 0;
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> lock(arena->m_mutex);
+        if (ptr == arena->m_lastAllocation)
+        {
+            char* newEnd = arena->m_lastAllocation + newSize;
+            if (newEnd <= arena->m_end)
+            {
+                AddBytes(arena->m_allocatedBytes, newEnd - arena->m_current);
+                arena->m_current = newEnd;
+                return newSize;
+            }
+            return arena->m_current - arena->m_lastAllocation;
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            DeAllocate(ptr);
+            return nullptr;
+        }
+        const size_type oldSize = AllocationSize(ptr);
+        AZ_Assert(oldSize != 0, "FrameArenaSchema can only reallocate the most recent allocation of a thread, in the current frame");
+        if (oldSize == 0)
+        {
+            return nullptr;
+        }
+        if ((reinterpret_cast<size_t>(ptr) & (AZStd::GetMax(newAlignment, size_type(1)) - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::GetMin(oldSize, newSize));
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        // we don't store sizes, the only known one is the size of the most recent allocation
+        FrameArena* arena = s_threadArenaSchemaId == m_id ? s_threadArena : nullptr;
+        if (!ptr || !arena)
+        {
+            return 0;
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> lock(arena->m_mutex);
+        if (ptr == arena->m_lastAllocation)
+        {
+            return arena->m_current - arena->m_lastAllocation;
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void FrameArenaSchema::GarbageCollect()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (FrameArena* arena = m_arenas; arena; arena = arena->m_nextArena)
+        {
+            // the blocks may still be in use this frame, they are released when the arenas are reset
+            arena->m_isTrimRequested.store(true, AZStd::memory_order_relaxed);
+        }
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_type allocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (const FrameArena* arena = m_arenas; arena; arena = arena->m_nextArena)
+        {
+            allocatedBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
+    //=========================================================================
+    // GetPeakAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetPeakAllocatedBytes() const
+    {
+        return AZStd::GetMax(m_peakBytes.load(AZStd::memory_order_relaxed), NumAllocatedBytes());
+    }
+
+    //=========================================================================
+    // GetPeakThreadAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetPeakThreadAllocatedBytes() const
+    {
+        size_type peakBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (const FrameArena* arena = m_arenas; arena; arena = arena->m_nextArena)
+        {
+            peakBytes = AZStd::GetMax(peakBytes, AZStd::GetMax(arena->m_peakBytes.load(AZStd::memory_order_relaxed),
+                arena->m_allocatedBytes.load(AZStd::memory_order_relaxed)));
+        }
+        return peakBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        size_type capacityBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (const FrameArena* arena = m_arenas; arena; arena = arena->m_nextArena)
+        {
+            capacityBytes += arena->m_capacityBytes.load(AZStd::memory_order_relaxed);
+        }
+        return capacityBytes;
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        const size_type maxBlockSize = m_desc.m_blockAllocator->GetMaxAllocationSize();
+        return maxBlockSize > FrameArenaBlockHeaderSize ? maxBlockSize - FrameArenaBlockHeaderSize : AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    //=========================================================================
+    // GetThreadArena
+    //=========================================================================
+    FrameArena* FrameArenaSchema::GetThreadArena()
+    {
+        if (s_threadArenaSchemaId == m_id)
+        {
+            return s_threadArena;
+        }
+
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        FrameArena* arena = m_arenas;
+        while (arena && arena->m_threadId != threadId)
+        {
+            arena = arena->m_nextArena;
+        }
+        if (!arena)
+        {
+            void* mem = m_desc.m_blockAllocator->Allocate(sizeof(FrameArena), AZStd::alignment_of<FrameArena>::value, 0, "AZSystem::FrameArenaSchema::FrameArena", __FILE__, __LINE__);
+            if (!mem)
+            {
+                return nullptr;
+            }
+            arena = new (mem) FrameArena();
+            arena->m_threadId = threadId;
+            arena->m_nextArena = m_arenas;
+            m_arenas = arena;
+        }
+        s_threadArena = arena;
+        s_threadArenaSchemaId = m_id;
+        return arena;
+    }
+
+    //=========================================================================
+    // ResetArena
+    //=========================================================================
+    void FrameArenaSchema::ResetArena(FrameArena* arena)
+    {
+        if (m_desc.m_poisonMemory)
+        {
+            for (FrameArenaBlock* block = arena->m_firstBlock; block; block = block->m_next)
+            {
+                char* data = GetBlockData(block);
+                memset(data, PoisonPattern, block == arena->m_currentBlock ? arena->m_current - data : block->m_size);
+                if (block == arena->m_currentBlock)
+                {
+                    break;
+                }
+            }
+        }
+
+        FreeLargeBlocks(arena);
+        if (arena->m_isTrimRequested.exchange(false, AZStd::memory_order_relaxed))
+        {
+            FreeBlocks(arena, true);
+        }
+
+        arena->m_currentBlock = arena->m_firstBlock;
+        arena->m_current = arena->m_firstBlock ? GetBlockData(arena->m_firstBlock) : nullptr;
+        arena->m_end = arena->m_firstBlock ? arena->m_current + arena->m_firstBlock->m_size : nullptr;
+        arena->m_lastAllocation = nullptr;
+        arena->m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // AllocateBlock
+    //=========================================================================
+    void* FrameArenaSchema::AllocateBlock(FrameArena* arena, size_t byteSize, size_t alignment)
+    {
+        const size_t dataAlignment = AZStd::GetMax(alignment, size_t(16));
+        const size_t blockDataSize = m_desc.m_blockSize - FrameArenaBlockHeaderSize;
+        if (byteSize + alignment > blockDataSize)
+        {
+            // too big for the arena blocks, use a dedicated block for this frame only
+            const size_t size = FrameArenaBlockHeaderSize + byteSize + dataAlignment;
+            FrameArenaBlock* block = reinterpret_cast<FrameArenaBlock*>(m_desc.m_blockAllocator->Allocate(size, 16, 0, "AZSystem::FrameArenaSchema::LargeBlock", __FILE__, __LINE__));
+            if (!block)
+            {
+                return nullptr;
+            }
+            block->m_next = arena->m_largeBlocks;
+            block->m_size = size - FrameArenaBlockHeaderSize;
+            arena->m_largeBlocks = block;
+            AddBytes(arena->m_capacityBytes, size);
+            AddBytes(arena->m_allocatedBytes, byteSize);
+            return reinterpret_cast<void*>(AZ_SIZE_ALIGN_UP(reinterpret_cast<size_t>(GetBlockData(block)), dataAlignment));
+        }
+
+        // move to the next retained block or grow the arena
+        FrameArenaBlock* block = arena->m_currentBlock ? arena->m_currentBlock->m_next : nullptr;
+        if (!block)
+        {
+            block = reinterpret_cast<FrameArenaBlock*>(m_desc.m_blockAllocator->Allocate(m_desc.m_blockSize, 16, 0, "AZSystem::FrameArenaSchema::Block", __FILE__, __LINE__));
+            if (!block)
+            {
+                return nullptr;
+            }
+            block->m_next = nullptr;
+            block->m_size = blockDataSize;
+            if (arena->m_currentBlock)
+            {
+                arena->m_currentBlock->m_next = block;
+            }
+            else
+            {
+                arena->m_firstBlock = block;
+            }
+            AddBytes(arena->m_capacityBytes, m_desc.m_blockSize);
+        }
+        arena->m_currentBlock = block;
+        arena->m_current = GetBlockData(block);
+        arena->m_end = arena->m_current + block->m_size;
+
+        char* address = reinterpret_cast<char*>(AZ_SIZE_ALIGN_UP(reinterpret_cast<size_t>(arena->m_current), alignment));
+        AddBytes(arena->m_allocatedBytes, (address + byteSize) - arena->m_current);
+        arena->m_current = address + byteSize;
+        arena->m_lastAllocation = address;
+        return address;
+    }
+
+    //=========================================================================
+    // FreeLargeBlocks
+    //=========================================================================
+    void FrameArenaSchema::FreeLargeBlocks(FrameArena* arena)
+    {
+        while (arena->m_largeBlocks)
+        {
+            FrameArenaBlock* next = arena->m_largeBlocks->m_next;
+            AddBytes(arena->m_capacityBytes, -static_cast<ptrdiff_t>(FrameArenaBlockHeaderSize + arena->m_largeBlocks->m_size));
+            m_desc.m_blockAllocator->DeAllocate(arena->m_largeBlocks);
+            arena->m_largeBlocks = next;
+        }
+    }
+
+    //=========================================================================
+    // FreeBlocks
+    //=========================================================================
+    void FrameArenaSchema::FreeBlocks(FrameArena* arena, bool keepFirst)
+    {
+        FrameArenaBlock* block = arena->m_firstBlock;
+        if (keepFirst && block)
+        {
+            // the next frame will most likely need it again
+            block = block->m_next;
+            arena->m_firstBlock->m_next = nullptr;
+        }
+        else
+        {
+            arena->m_firstBlock = nullptr;
+        }
+        while (block)
+        {
+            FrameArenaBlock* next = block->m_next;
+            AddBytes(arena->m_capacityBytes, -static_cast<ptrdiff_t>(m_desc.m_blockSize));
+            m_desc.m_blockAllocator->DeAllocate(block, m_desc.m_blockSize);
+            block = next;
+        }
+        arena->m_currentBlock = arena->m_firstBlock;
+    }
+}
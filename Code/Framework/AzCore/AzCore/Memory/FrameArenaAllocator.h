@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct FrameArena;
+
+    /**
+     * Frame arena schema, linear (bump pointer) allocations from per thread arenas that are released in bulk once
+     * per frame. Each thread allocates from its own arena, its lock is only contended while the arenas are reset.
+     * DeAllocate is a no-op (except for the most recent allocation of the thread which is rolled back, so a growing
+     * scratch vector doesn't waste its arena). All the memory allocated in a frame becomes invalid when the next
+     * frame starts, see \ref ResetFrame.
+     *
+     * ResetFrame resets the arenas of all threads. In debug builds the released memory is poisoned so uses of memory
+     * from a previous frame are easy to spot.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        struct Descriptor
+        {
+            Descriptor()
+                : m_blockSize(256 * 1024)
+#if defined(AZ_DEBUG_BUILD)
+                , m_poisonMemory(true)
+#else
+                , m_poisonMemory(false)
+#endif
+                , m_blockAllocator(nullptr)
+            {}
+
+            size_t              m_blockSize;        ///< Size of the memory blocks the arenas grow by. Bigger allocations get a block of their own.
+            bool                m_poisonMemory;     ///< Fill released memory with PoisonPattern when the arenas are reset (default: true in debug builds).
+            IAllocatorAllocate* m_blockAllocator;   ///< Allocator used for the arena blocks, if null the SystemAllocator is used.
+        };
+
+        static const unsigned char PoisonPattern = 0xfa;
+
+        FrameArenaSchema(const Descriptor& desc = Descriptor());
+        ~FrameArenaSchema() override;
+
+        /// Starts a new frame, all memory allocated from the arenas in the previous frames is released.
+        /// Allocations made by other threads while the arenas are reset end up in either frame.
+        void ResetFrame();
+        /// Returns the number of ResetFrame calls.
+        AZ::u64 GetFrame() const { return m_frame.load(AZStd::memory_order_acquire); }
+        /// Returns the number of bytes allocated in the previous frame by all threads.
+        size_type GetLastFrameAllocatedBytes() const { return m_lastFrameBytes.load(AZStd::memory_order_relaxed); }
+        /// Returns the max bytes allocated in a frame by a single thread, a good hint for the block size.
+        size_type GetPeakThreadAllocatedBytes() const;
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation of the calling thread can be resized.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        /// Only the most recent allocation of the calling thread can be reallocated.
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Frees the arena blocks which are not needed to start a frame, on the next ResetFrame.
+        void GarbageCollect() override;
+
+        /// Bytes allocated in the current frame by all threads.
+        size_type NumAllocatedBytes() const override;
+        /// Max bytes allocated in a frame by all threads.
+        size_type GetPeakAllocatedBytes() const;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override { return m_desc.m_blockAllocator; }
+
+    private:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        FrameArena* GetThreadArena();
+        void ResetArena(FrameArena* arena);
+        void* AllocateBlock(FrameArena* arena, size_t byteSize, size_t alignment);
+        void FreeLargeBlocks(FrameArena* arena);
+        void FreeBlocks(FrameArena* arena, bool keepFirst);
+
+        Descriptor m_desc;
+        AZ::u32 m_id; ///< unique id, used to detect thread local arenas of a previous schema
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+        AZStd::atomic_size_t m_lastFrameBytes{ 0 };
+        AZStd::atomic_size_t m_peakBytes{ 0 };
+        mutable AZStd::mutex m_arenasMutex;
+        FrameArena* m_arenas = nullptr; ///< all arenas, linked with FrameArena::m_nextArena
+    };
+
+    /**
+     * Allocator for per frame scratch memory (culling lists, draw items, sample buffers...), see \ref FrameArenaSchema.
+     * The frame is advanced by ComponentApplication::Tick, before the queued tick events and OnTick are dispatched,
+     * so allocations made during a tick stay valid until the start of the next one. Any thread can allocate.
+     * Allocations are not tracked by the allocation records, as they are released in bulk.
+     * The MemoryComponent only creates the allocator when isFrameArenaAllocator is enabled.
+     */
+    class FrameArenaAllocator
+        : public SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{6C1E2B0A-7D54-4F3E-9A8B-3F0D9C2E5A17}");
+
+        using Base = SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, false, true>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Linear per thread allocator for memory released every frame")
+        {
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        void ResetFrame()
+        {
+            static_cast<FrameArenaSchema*>(m_schema)->ResetFrame();
+        }
+
+        AZ::u64 GetFrame() const
+        {
+            return static_cast<const FrameArenaSchema*>(m_schema)->GetFrame();
+        }
+
+        size_type GetPeakAllocatedBytes() const
+        {
+            return static_cast<const FrameArenaSchema*>(m_schema)->GetPeakAllocatedBytes();
+        }
+    };
+
+    /**
+     * AZStd allocator for containers living in frame arena memory. Containers are allowed to skip deallocations,
+     * everything is released when the frame ends. Containers must not be used after the frame they allocated in.
+     *
+     *     AZStd::vector<DrawItem, AZ::FrameArenaStdAllocator> drawItems;
+     */
+    class FrameArenaStdAllocator
+    {
+    public:
+        typedef void*               pointer_type;
+        typedef AZStd::size_t       size_type;
+        typedef AZStd::ptrdiff_t    difference_type;
+        typedef AZStd::true_type    allow_memory_leaks;
+
+        FrameArenaStdAllocator(const char* name = "AZ::FrameArenaStdAllocator")
+            : m_name(name) {}
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs) = default;
+        FrameArenaStdAllocator(const FrameArenaStdAllocator& rhs, const char* name)
+            : m_name(name) { (void)rhs; }
+        FrameArenaStdAllocator& operator=(const FrameArenaStdAllocator& rhs) = default;
+
+        pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+        {
+            return AllocatorInstance<FrameArenaAllocator>::Get().Allocate(byteSize, alignment, flags, m_name, __FILE__, __LINE__, 1);
+        }
+        size_type resize(pointer_type ptr, size_type newSize)
+        {
+            return AllocatorInstance<FrameArenaAllocator>::Get().Resize(ptr, newSize);
+        }
+        void deallocate(pointer_type ptr, size_type byteSize, size_type alignment)
+        {
+            AllocatorInstance<FrameArenaAllocator>::Get().DeAllocate(ptr, byteSize, alignment);
+        }
+
+        const char* get_name() const            { return m_name; }
+        void        set_name(const char* name)  { m_name = name; }
+        size_type   get_max_size() const        { return AllocatorInstance<FrameArenaAllocator>::Get().GetMaxAllocationSize(); }
+        size_type   get_allocated_size() const  { return AllocatorInstance<FrameArenaAllocator>::Get().NumAllocatedBytes(); }
+
+    private:
+        const char* m_name;
+    };
+
+    AZ_FORCE_INLINE bool operator==(const FrameArenaStdAllocator&, const FrameArenaStdAllocator&) { return true; }
+    AZ_FORCE_INLINE bool operator!=(const FrameArenaStdAllocator&, const FrameArenaStdAllocator&) { return false; }
+}
@@ -10,8 +10,10 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
 #ifdef _DEBUG
@@ -466,6 +468,52 @@ namespace AZ {
         size_t bucket_get_max_allocation() const;
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
+        // moves up to count elements from the bucket into a free list, returns the number of elements moved
+        unsigned bucket_alloc_batch(unsigned bi, unsigned count, free_link*& list);
+        // returns all the elements of a free list to the bucket
+        void bucket_free_batch(unsigned bi, free_link* list);
+
+        // Optional caches of small free elements in front of the buckets (enabled with a non zero
+        // HphaSchema::Descriptor::m_threadCacheByteSize). These are not true per thread caches: they are
+        // THREAD_CACHE_COUNT shared caches (stripes), each guarded by a spin lock. A thread is assigned a stripe round
+        // robin the first time it uses any HpAllocator and always uses it, so the lock is uncontended as long as there
+        // are no more active threads than stripes. The bucket lock is only taken to move a batch of elements in or out
+        // of a cache. Cached elements count as free memory, they are returned to the buckets when a bucket cache or
+        // the whole cache grows over its limit, periodically and on purge.
+        static const unsigned THREAD_CACHE_COUNT = 32;
+        // a cache returns half of its elements every THREAD_CACHE_SCAVENGE_INTERVAL frees, so idle caches don't hold memory forever
+        static const unsigned THREAD_CACHE_SCAVENGE_INTERVAL = 16 * 1024;
+        static const unsigned THREAD_CACHE_MIN_BUCKET_ELEMENTS = 4;
+        static const unsigned THREAD_CACHE_MAX_BUCKET_ELEMENTS = 512;
+
+        struct thread_cache
+        {
+            void lock()
+            {
+                while (mLocked.exchange(true, AZStd::memory_order_acquire))
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+            void unlock() { mLocked.store(false, AZStd::memory_order_release); }
+
+            // detaches the elements after the first keepCount of the bucket cache, call with the lock held
+            free_link* split(unsigned bi, unsigned keepCount);
+
+            AZStd::atomic_bool mLocked{ false };
+            AZStd::atomic_size_t mCachedBytes{ 0 }; // read without the lock by allocated()
+            size_t mTreeBlockSize = 0; // size of the tree block holding the cache
+            unsigned mFreeCount = 0;
+            free_link* mFreeLists[NUM_BUCKETS] = {};
+            unsigned short mCounts[NUM_BUCKETS] = {};
+        };
+
+        thread_cache* get_thread_cache();
+        void* thread_cache_alloc(thread_cache* cache, unsigned bi);
+        void thread_cache_free(thread_cache* cache, void* ptr, unsigned bi);
+        // returns half (or all) of the cached elements of every bucket to the buckets
+        void thread_cache_scavenge(thread_cache* cache, bool releaseAll);
+        size_t thread_cache_bytes() const;
 
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
@@ -1046,6 +1094,14 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Return the cached elements first, they keep bucket pages alive
+            for (unsigned i = 0; i < THREAD_CACHE_COUNT; i++)
+            {
+                if (thread_cache* cache = m_threadCaches[i].load(AZStd::memory_order_acquire))
+                {
+                    thread_cache_scavenge(cache, true);
+                }
+            }
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1062,7 +1118,7 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_bytes();
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1081,6 +1137,10 @@ namespace AZ {
         bool         m_isPoolAllocations;
         IAllocatorAllocate* m_subAllocator;
 
+        const size_t m_threadCacheByteSize;
+        unsigned short m_threadCacheBucketLimits[NUM_BUCKETS];
+        AZStd::atomic<thread_cache*> m_threadCaches[THREAD_CACHE_COUNT];
+
 #if !defined (USE_MUTEX_PER_BUCKET)
         mutable AZStd::mutex m_mutex;
 #endif
@@ -1138,7 +1198,19 @@ namespace AZ {
         , m_treePageAlignment(desc.m_pageSize)
         , m_poolPageSize(desc.m_fixedMemoryBlock != NULL ? desc.m_poolPageSize : OS_VIRTUAL_PAGE_SIZE)
         , m_subAllocator(desc.m_subAllocator)
+        , m_threadCacheByteSize(desc.m_isPoolAllocations ? desc.m_threadCacheByteSize : 0)
     {
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            // each bucket can use a quarter of the cache, the total is enforced separately
+            size_t limit = m_threadCacheByteSize / 4 / bucket_spacing_function_inverse(i);
+            m_threadCacheBucketLimits[i] = (unsigned short)AZStd::GetMin<size_t>(AZStd::GetMax<size_t>(limit, THREAD_CACHE_MIN_BUCKET_ELEMENTS), THREAD_CACHE_MAX_BUCKET_ELEMENTS);
+        }
+        for (unsigned i = 0; i < THREAD_CACHE_COUNT; i++)
+        {
+            m_threadCaches[i].store(nullptr, AZStd::memory_order_relaxed);
+        }
+
 #ifdef DEBUG_ALLOCATOR
         mTotalDebugRequestedSize[DEBUG_SOURCE_BUCKETS] = 0;
         mTotalDebugRequestedSize[DEBUG_SOURCE_TREE] = 0;
@@ -1174,6 +1246,17 @@ namespace AZ {
 
     HpAllocator::~HpAllocator()
     {
+        // return the cached elements before checking for leaks
+        for (unsigned i = 0; i < THREAD_CACHE_COUNT; i++)
+        {
+            if (thread_cache* cache = m_threadCaches[i].exchange(nullptr, AZStd::memory_order_acq_rel))
+            {
+                thread_cache_scavenge(cache, true);
+                cache->~thread_cache();
+                tree_free(cache);
+            }
+        }
+
 #ifdef DEBUG_ALLOCATOR
         // Check if there are not-freed allocations
         report();
@@ -1342,6 +1425,10 @@ namespace AZ {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1370,6 +1457,10 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1437,6 +1528,10 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1455,6 +1550,10 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1569,6 +1668,235 @@ namespace AZ {
         }
     }
 
+    unsigned HpAllocator::bucket_alloc_batch(unsigned bi, unsigned count, free_link*& list)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        unsigned numAllocated = 0;
+        for (; numAllocated < count; numAllocated++)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            mTotalAllocatedSizeBuckets += p->elem_size();
+            free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+            lnk->mNext = list;
+            list = lnk;
+        }
+        return numAllocated;
+    }
+
+    void HpAllocator::bucket_free_batch(unsigned bi, free_link* list)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        while (list)
+        {
+            free_link* next = list->mNext;
+            page* p = ptr_get_page(list);
+            HPPA_ASSERT(bi == p->bucket_index());
+            mTotalAllocatedSizeBuckets -= p->elem_size();
+            mBuckets[bi].free(p, list);
+            list = next;
+        }
+    }
+
+    HpAllocator::free_link* HpAllocator::thread_cache::split(unsigned bi, unsigned keepCount)
+    {
+        HPPA_ASSERT(keepCount <= mCounts[bi]);
+        free_link* released;
+        if (keepCount == 0)
+        {
+            released = mFreeLists[bi];
+            mFreeLists[bi] = nullptr;
+        }
+        else
+        {
+            free_link* last = mFreeLists[bi];
+            for (unsigned i = 1; i < keepCount; i++)
+            {
+                last = last->mNext;
+            }
+            released = last->mNext;
+            last->mNext = nullptr;
+        }
+        mCounts[bi] = (unsigned short)keepCount;
+        return released;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::get_thread_cache()
+    {
+        if (m_threadCacheByteSize == 0)
+        {
+            return nullptr;
+        }
+
+        // threads get a cache index round robin the first time they use any HpAllocator
+        static AZStd::atomic_uint s_nextThreadCacheIndex{ 0 };
+        static AZ_THREAD_LOCAL unsigned s_threadCacheIndex = 0; // index + 1, 0 until assigned
+        if (s_threadCacheIndex == 0)
+        {
+            s_threadCacheIndex = (s_nextThreadCacheIndex.fetch_add(1, AZStd::memory_order_relaxed) % THREAD_CACHE_COUNT) + 1;
+        }
+
+        AZStd::atomic<thread_cache*>& slot = m_threadCaches[s_threadCacheIndex - 1];
+        thread_cache* cache = slot.load(AZStd::memory_order_acquire);
+        if (!cache)
+        {
+            void* mem = tree_alloc(sizeof(thread_cache));
+            if (!mem)
+            {
+                return nullptr; // use the buckets directly
+            }
+            thread_cache* newCache = new (mem) thread_cache();
+            newCache->mTreeBlockSize = tree_ptr_size(mem);
+            if (slot.compare_exchange_strong(cache, newCache, AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+            {
+                cache = newCache;
+            }
+            else
+            {
+                // another thread with the same index created it first
+                newCache->~thread_cache();
+                tree_free(newCache);
+            }
+        }
+        return cache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache* cache, unsigned bi)
+    {
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache->lock();
+        free_link* lnk = cache->mFreeLists[bi];
+        if (lnk)
+        {
+            cache->mFreeLists[bi] = lnk->mNext;
+            cache->mCounts[bi]--;
+            cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) - elemSize, AZStd::memory_order_relaxed);
+            cache->unlock();
+            return lnk;
+        }
+        cache->unlock();
+
+        // refill half of the bucket cache under a single bucket lock, the first element is returned
+        free_link* list = nullptr;
+        const unsigned count = bucket_alloc_batch(bi, AZStd::GetMax(m_threadCacheBucketLimits[bi] / 2u, 1u), list);
+        if (count == 0)
+        {
+            return nullptr;
+        }
+        lnk = list;
+        list = list->mNext;
+        if (list)
+        {
+            free_link* last = list;
+            while (last->mNext)
+            {
+                last = last->mNext;
+            }
+            cache->lock();
+            last->mNext = cache->mFreeLists[bi];
+            cache->mFreeLists[bi] = list;
+            cache->mCounts[bi] = (unsigned short)(cache->mCounts[bi] + count - 1);
+            cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) + (count - 1) * elemSize, AZStd::memory_order_relaxed);
+            cache->unlock();
+        }
+        return lnk;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache* cache, void* ptr, unsigned bi)
+    {
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache->lock();
+        free_link* lnk = (free_link*)ptr;
+        lnk->mNext = cache->mFreeLists[bi];
+        cache->mFreeLists[bi] = lnk;
+        cache->mCounts[bi]++;
+        size_t cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed) + elemSize;
+        const bool scavenge = (++cache->mFreeCount % THREAD_CACHE_SCAVENGE_INTERVAL) == 0 || cachedBytes > m_threadCacheByteSize;
+        free_link* released = nullptr;
+        if (!scavenge && cache->mCounts[bi] > m_threadCacheBucketLimits[bi])
+        {
+            // the bucket cache is full, return half of it
+            const unsigned keepCount = m_threadCacheBucketLimits[bi] / 2u;
+            cachedBytes -= (cache->mCounts[bi] - keepCount) * elemSize;
+            released = cache->split(bi, keepCount);
+        }
+        cache->mCachedBytes.store(cachedBytes, AZStd::memory_order_relaxed);
+        cache->unlock();
+
+        if (scavenge)
+        {
+            thread_cache_scavenge(cache, false);
+        }
+        else if (released)
+        {
+            bucket_free_batch(bi, released);
+        }
+    }
+
+    void HpAllocator::thread_cache_scavenge(thread_cache* cache, bool releaseAll)
+    {
+        free_link* released[NUM_BUCKETS];
+        cache->lock();
+        size_t cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            const unsigned count = cache->mCounts[i];
+            const unsigned keepCount = releaseAll ? 0 : count / 2;
+            cachedBytes -= (count - keepCount) * bucket_spacing_function_inverse(i);
+            released[i] = cache->split(i, keepCount);
+        }
+        cache->mCachedBytes.store(cachedBytes, AZStd::memory_order_relaxed);
+        cache->unlock();
+
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            if (released[i])
+            {
+                bucket_free_batch(i, released[i]);
+            }
+        }
+    }
+
+    size_t HpAllocator::thread_cache_bytes() const
+    {
+        size_t cachedBytes = 0;
+        if (m_threadCacheByteSize != 0)
+        {
+            for (unsigned i = 0; i < THREAD_CACHE_COUNT; i++)
+            {
+                if (const thread_cache* cache = m_threadCaches[i].load(AZStd::memory_order_acquire))
+                {
+                    // the cache itself is allocator overhead, not a user allocation
+                    cachedBytes += cache->mCachedBytes.load(AZStd::memory_order_relaxed) + cache->mTreeBlockSize;
+                }
+            }
+        }
+        return cachedBytes;
+    }
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
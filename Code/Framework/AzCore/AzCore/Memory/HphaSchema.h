@@ -38,6 +38,7 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_threadCacheByteSize(0)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -49,6 +50,7 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            size_t                  m_threadCacheByteSize;                  ///< Max bytes of freed small blocks held by each thread cache in front of the pools, 0 (default) disables the thread caches. The caches are a fixed set of 32 striped caches guarded by spin locks, each thread is assigned one of them, so threads can share a cache.
         };
 
 
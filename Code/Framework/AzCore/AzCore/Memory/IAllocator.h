@@ -13,6 +13,7 @@ namespace AZ
     namespace Debug
     {
         class AllocationRecords;
+        class AllocationSampler;
         class MemoryDriller;
     }
 
@@ -158,6 +159,12 @@ namespace AZ
         /// Sets the allocation records.
         virtual void SetRecords(Debug::AllocationRecords* records) = 0;
 
+        /// Returns the allocation sampler this allocator reports to, if sampling is active. \ref Debug::AllocationSampler
+        virtual Debug::AllocationSampler* GetAllocationSampler() const = 0;
+
+        /// Sets the allocation sampler, managed by the AllocatorManager.
+        virtual void SetAllocationSampler(Debug::AllocationSampler* sampler) = 0;
+
         /// Returns true if this allocator is ready to use.
         virtual bool IsReady() const = 0;
 
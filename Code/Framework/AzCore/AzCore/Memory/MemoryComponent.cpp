@@ -9,6 +9,7 @@
 #include <AzCore/Math/Crc.h>
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -23,9 +24,42 @@ namespace AZ
     {
         m_isPoolAllocator = true;
         m_isThreadPoolAllocator = true;
+        m_isFrameArenaAllocator = false;
+        m_poolReservedAddressSpaceMB = 0;
+        m_threadPoolReservedAddressSpaceMB = 0;
+        m_hugePages = ReservedAddressSpaceSchema::HugePages::Transparent;
 
         m_createdPoolAllocator = false;
         m_createdThreadPoolAllocator = false;
+        m_createdFrameArenaAllocator = false;
+        m_poolPageAllocator = nullptr;
+        m_threadPoolPageAllocator = nullptr;
+    }
+
+    namespace
+    {
+        ReservedAddressSpaceSchema* CreatePageAllocator(AZ::u32 reservedMB, ReservedAddressSpaceSchema::HugePages hugePages)
+        {
+            if (reservedMB == 0)
+            {
+                return nullptr;
+            }
+
+            ReservedAddressSpaceSchema::Descriptor desc;
+            desc.m_reservedBytes = static_cast<size_t>(reservedMB) * 1024 * 1024;
+            desc.m_hugePages = hugePages;
+            desc.m_fallbackAllocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            return azcreate(ReservedAddressSpaceSchema, (desc), AZ::SystemAllocator);
+        }
+
+        void DestroyPageAllocator(ReservedAddressSpaceSchema*& pageAllocator)
+        {
+            if (pageAllocator)
+            {
+                azdestroy(pageAllocator, AZ::SystemAllocator);
+                pageAllocator = nullptr;
+            }
+        }
     }
 
     //=========================================================================
@@ -38,6 +72,10 @@ namespace AZ
         // and create in activate. But memory component is special that
         // it must be operational after Init so all parts of the engine can be operational.
         // This is why we must check the destructor (which is symmetrical to Init() anyway)
+        if (m_createdFrameArenaAllocator && AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+        }
         if (m_createdThreadPoolAllocator && AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
         {
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
@@ -46,6 +84,9 @@ namespace AZ
         {
             AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
         }
+        // the page allocators must outlive the pools using them
+        DestroyPageAllocator(m_threadPoolPageAllocator);
+        DestroyPageAllocator(m_poolPageAllocator);
     }
 
     //=========================================================================
@@ -59,14 +100,27 @@ namespace AZ
         // TODO: add the setting to the serialization layer
         if (m_isPoolAllocator)
         {
-            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            // pool pages from a reserved (huge page backed) range are contiguous, which reduces the TLB misses of pool heavy code
+            AZ::PoolAllocator::Descriptor desc;
+            m_poolPageAllocator = CreatePageAllocator(m_poolReservedAddressSpaceMB, m_hugePages);
+            desc.m_pageAllocator = m_poolPageAllocator;
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create(desc);
             m_createdPoolAllocator = true;
         }
         if (m_isThreadPoolAllocator)
         {
-            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::ThreadPoolAllocator::Descriptor desc;
+            m_threadPoolPageAllocator = CreatePageAllocator(m_threadPoolReservedAddressSpaceMB, m_hugePages);
+            desc.m_pageAllocator = m_threadPoolPageAllocator;
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create(desc);
             m_createdThreadPoolAllocator = true;
         }
+        if (m_isFrameArenaAllocator && !AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            // reset every frame by ComponentApplication::Tick
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_createdFrameArenaAllocator = true;
+        }
     }
 
     //=========================================================================
@@ -109,9 +163,13 @@ namespace AZ
         if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
         {
             serializeContext->Class<MemoryComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("isPoolAllocator", &MemoryComponent::m_isPoolAllocator)
                 ->Field("isThreadPoolAllocator", &MemoryComponent::m_isThreadPoolAllocator)
+                ->Field("isFrameArenaAllocator", &MemoryComponent::m_isFrameArenaAllocator)
+                ->Field("poolReservedAddressSpaceMB", &MemoryComponent::m_poolReservedAddressSpaceMB)
+                ->Field("threadPoolReservedAddressSpaceMB", &MemoryComponent::m_threadPoolReservedAddressSpaceMB)
+                ->Field("hugePages", &MemoryComponent::m_hugePages)
                 ;
 
             ;
@@ -123,6 +181,13 @@ namespace AZ
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isPoolAllocator, "Pool allocator", "Fast allocation pooling for small allocations < 256 bytes, use from main thread only!")
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isThreadPoolAllocator, "Thread pool allocator", "Fast allocation pool that can be used from any thread, if uses more memory! (as it keeps the pools per thread)")
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isFrameArenaAllocator, "Frame arena allocator", "Linear per thread allocator for scratch memory which is released in bulk every frame (tick)")
+                    ->DataElement(AZ::Edit::UIHandlers::SpinBox, &MemoryComponent::m_poolReservedAddressSpaceMB, "Pool address space (MB)", "When not 0, reserves an address range of this size for the pool allocator pages, committed on demand. Keeps the pools contiguous to reduce TLB misses.")
+                    ->DataElement(AZ::Edit::UIHandlers::SpinBox, &MemoryComponent::m_threadPoolReservedAddressSpaceMB, "Thread pool address space (MB)", "When not 0, reserves an address range of this size for the thread pool allocator pages, committed on demand.")
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox, &MemoryComponent::m_hugePages, "Huge pages", "Page type used to commit the reserved address ranges (Linux only, other platforms use the system allocator)")
+                        ->EnumAttribute(ReservedAddressSpaceSchema::HugePages::None, "None")
+                        ->EnumAttribute(ReservedAddressSpaceSchema::HugePages::Transparent, "Transparent")
+                        ->EnumAttribute(ReservedAddressSpaceSchema::HugePages::Explicit, "Explicit (hugetlbfs pool)")
                     ;
             }
         }
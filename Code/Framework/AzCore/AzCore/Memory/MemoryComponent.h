@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
 
 namespace AZ
 {
@@ -46,10 +47,17 @@ namespace AZ
         // serialized data
         bool m_isPoolAllocator;
         bool m_isThreadPoolAllocator;
+        bool m_isFrameArenaAllocator;
+        AZ::u32 m_poolReservedAddressSpaceMB;          ///< When not 0, the pool allocator pages come from a reserved address range of this size.
+        AZ::u32 m_threadPoolReservedAddressSpaceMB;    ///< When not 0, the thread pool allocator pages come from a reserved address range of this size.
+        ReservedAddressSpaceSchema::HugePages m_hugePages; ///< Huge pages used for the reserved address ranges.
 
         // non-serialized data
         bool m_createdPoolAllocator;
         bool m_createdThreadPoolAllocator;
+        bool m_createdFrameArenaAllocator;
+        ReservedAddressSpaceSchema* m_poolPageAllocator;
+        ReservedAddressSpaceSchema* m_threadPoolPageAllocator;
     };
 }
 
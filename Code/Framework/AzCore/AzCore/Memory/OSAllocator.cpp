@@ -16,6 +16,7 @@ namespace AZ
     OSAllocator::OSAllocator()
         : AllocatorBase(this, "OSAllocator", "OS allocator, allocating memory directly from the OS (C heap)!")
         , m_custom(nullptr)
+        , m_reservedAddressSpace(nullptr)
         , m_numAllocatedBytes(0)
     {
         DisableOverriding();
@@ -37,6 +38,14 @@ namespace AZ
     {
         m_custom = desc.m_custom;
         m_numAllocatedBytes = 0;
+        if (!m_custom && desc.m_reservedAddressSpace.m_reservedBytes > 0)
+        {
+            // the OS allocator is created before any other allocator, the scheme is allocated directly from the OS
+            ReservedAddressSpaceSchema::Descriptor reservedDesc = desc.m_reservedAddressSpace;
+            reservedDesc.m_fallbackAllocator = nullptr;
+            m_reservedAddressSpace = new (AZ_OS_MALLOC(sizeof(ReservedAddressSpaceSchema), alignof(ReservedAddressSpaceSchema))) ReservedAddressSpaceSchema(reservedDesc);
+            m_custom = m_reservedAddressSpace;
+        }
         return true;
     }
 
@@ -46,6 +55,13 @@ namespace AZ
     //=========================================================================
     void OSAllocator::Destroy()
     {
+        if (m_reservedAddressSpace)
+        {
+            m_reservedAddressSpace->~ReservedAddressSpaceSchema();
+            AZ_OS_FREE(m_reservedAddressSpace);
+            m_reservedAddressSpace = nullptr;
+            m_custom = nullptr;
+        }
     }
 
     //=========================================================================
@@ -92,10 +108,9 @@ namespace AZ
     //=========================================================================
     void OSAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
     {
-        (void)alignment;
         if (m_custom)
         {
-            m_custom->DeAllocate(ptr);
+            m_custom->DeAllocate(ptr, byteSize, alignment);
         }
         else
         {
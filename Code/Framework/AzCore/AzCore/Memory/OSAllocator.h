@@ -8,6 +8,7 @@
 #define AZCORE_OS_ALLOCATOR_H
 
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
 #include <AzCore/std/allocator.h>
 
 // OS Allocations macros AZ_OS_MALLOC/AZ_OS_FREE
@@ -37,8 +38,14 @@ namespace AZ
         struct Descriptor
         {
             Descriptor()
-                : m_custom(0) {}
+                : m_custom(0)
+            {
+                m_reservedAddressSpace.m_reservedBytes = 0;
+            }
             IAllocatorAllocate*         m_custom;   ///< You can provide our own allocation scheme. If NULL a HeapScheme will be used with the provided Descriptor.
+            /// When m_reservedBytes is not 0 (and there is no custom scheme), page sized and bigger allocations are served from a reserved
+            /// address range committed incrementally (optionally with huge pages), the rest goes to the C heap. Off by default.
+            ReservedAddressSpaceSchema::Descriptor m_reservedAddressSpace;
         };
 
         bool Create(const Descriptor& desc);
@@ -67,6 +74,7 @@ namespace AZ
         OSAllocator& operator=(const OSAllocator&);
 
         IAllocatorAllocate*     m_custom;
+        ReservedAddressSpaceSchema* m_reservedAddressSpace;    ///< Owned scheme when Descriptor::m_reservedAddressSpace is used, also set as m_custom.
         size_type               m_numAllocatedBytes;
     };
 
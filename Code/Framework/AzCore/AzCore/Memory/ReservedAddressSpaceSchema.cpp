@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Math/MathIntrinsics.h>
+
+namespace AZ
+{
+    namespace
+    {
+        //! Rounds up to a multiple of alignment, which doesn't need to be a power of 2.
+        size_t RoundUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        //! Stored in front of the blocks allocated from the OS heap, as the OS heap can't report the size of a block.
+        struct OSBlockHeader
+        {
+            size_t m_size;
+            size_t m_offset;    //!< Offset from the start of the block to the returned address.
+        };
+    }
+
+    //=========================================================================
+    // ReservedAddressSpaceSchema
+    //=========================================================================
+    ReservedAddressSpaceSchema::ReservedAddressSpaceSchema(const Descriptor& desc)
+        : m_desc(desc)
+    {
+        m_pageSize = Platform::GetVirtualMemoryPageSize();
+        if (m_desc.m_reservedBytes == 0 || m_pageSize == 0)
+        {
+            return;
+        }
+
+        const size_t hugePageSize = m_desc.m_hugePages != HugePages::None ? Platform::GetHugePageSize() : 0;
+        m_commitGranularity = RoundUp(AZStd::GetMax(m_desc.m_commitGranularity, m_pageSize), hugePageSize ? hugePageSize : m_pageSize);
+
+        // The page bitmaps are stored at the start of the range, the allocatable range starts on the next commit chunk.
+        m_dataBytes = RoundUp(m_desc.m_reservedBytes, m_commitGranularity);
+        m_numPages = m_dataBytes / m_pageSize;
+        const size_t bitmapWords = (m_numPages + 63) / 64;
+        const size_t metadataBytes = RoundUp(2 * bitmapWords * sizeof(AZ::u64), m_commitGranularity);
+        m_reservedBytes = metadataBytes + m_dataBytes;
+
+        m_reservedBase = reinterpret_cast<char*>(Platform::ReserveAddressSpace(m_reservedBytes, m_commitGranularity));
+        if (!m_reservedBase)
+        {
+            AZ_Warning("Memory", false, "Failed to reserve %zu bytes of address space, allocations will use the fallback allocator.", m_reservedBytes);
+            return;
+        }
+        if (!Platform::CommitAddressSpace(m_reservedBase, metadataBytes, HugePages::None))
+        {
+            AZ_Warning("Memory", false, "Failed to commit %zu bytes for the address space bookkeeping, allocations will use the fallback allocator.", metadataBytes);
+            Platform::ReleaseAddressSpace(m_reservedBase, m_reservedBytes);
+            m_reservedBase = nullptr;
+            return;
+        }
+
+        // freshly committed memory is zeroed, all pages are free
+        m_usedPages = reinterpret_cast<AZ::u64*>(m_reservedBase);
+        m_runEndPages = m_usedPages + bitmapWords;
+        m_dataBase = m_reservedBase + metadataBytes;
+    }
+
+    //=========================================================================
+    // ~ReservedAddressSpaceSchema
+    //=========================================================================
+    ReservedAddressSpaceSchema::~ReservedAddressSpaceSchema()
+    {
+        if (m_reservedBase)
+        {
+            // Memory still in use (leaked at shutdown) stays mapped, releasing it could crash code still referencing it.
+            AZ_Warning("Memory", m_allocatedBytes == 0, "ReservedAddressSpaceSchema destroyed with %zu bytes still allocated, the address space is not released.", m_allocatedBytes);
+            if (m_allocatedBytes == 0)
+            {
+                Platform::ReleaseAddressSpace(m_reservedBase, m_reservedBytes);
+            }
+        }
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    ReservedAddressSpaceSchema::pointer_type
+    ReservedAddressSpaceSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        // small allocations would waste most of their page, alignments above the commit granularity can't be guaranteed by page index
+        if (!m_dataBase || byteSize < m_pageSize || alignment > m_commitGranularity)
+        {
+            return FallbackAllocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord);
+        }
+
+        const size_t numPages = (byteSize + m_pageSize - 1) / m_pageSize;
+        const size_t alignmentPages = alignment > m_pageSize ? alignment / m_pageSize : 1;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            const size_t page = FindFreePages(numPages, alignmentPages);
+            if (page != InvalidPage && CommitPages(page + numPages))
+            {
+                MarkPages(page, numPages, true);
+                const size_t lastPage = page + numPages - 1;
+                m_runEndPages[lastPage >> 6] |= 1ull << (lastPage & 63);
+                m_searchStart = page + numPages;
+                m_allocatedBytes += numPages * m_pageSize;
+                return m_dataBase + page * m_pageSize;
+            }
+        }
+
+        return FallbackAllocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void ReservedAddressSpaceSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+        if (!IsInRange(ptr))
+        {
+            FallbackDeAllocate(ptr, byteSize, alignment);
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const size_t page = PageIndex(ptr);
+        AZ_Assert(IsPageUsed(page) && m_dataBase + page * m_pageSize == ptr, "Address %p was not allocated by this ReservedAddressSpaceSchema!", ptr);
+        const size_t numPages = GetRunPages(page);
+        MarkPages(page, numPages, false);
+        const size_t lastPage = page + numPages - 1;
+        m_runEndPages[lastPage >> 6] &= ~(1ull << (lastPage & 63));
+        m_allocatedBytes -= numPages * m_pageSize;
+        // reuse the lowest free pages first, it keeps the used part of the range compact
+        m_searchStart = AZStd::GetMin(m_searchStart, page);
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        if (!IsInRange(ptr))
+        {
+            if (!m_desc.m_fallbackAllocator)
+            {
+                // OS heap blocks can't be resized in place
+                return 0;
+            }
+            const size_t oldAllocationSize = FallbackAllocationSize(ptr, 0);
+            const size_type resizedSize = m_desc.m_fallbackAllocator->Resize(ptr, newSize);
+            if (resizedSize && oldAllocationSize)
+            {
+                m_fallbackAllocatedBytes.fetch_add(resizedSize, AZStd::memory_order_relaxed);
+                m_fallbackAllocatedBytes.fetch_sub(oldAllocationSize, AZStd::memory_order_relaxed);
+            }
+            return resizedSize;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const size_t page = PageIndex(ptr);
+        const size_t numPages = GetRunPages(page);
+        const size_t newNumPages = AZStd::GetMax<size_t>((newSize + m_pageSize - 1) / m_pageSize, 1);
+        if (newNumPages == numPages)
+        {
+            return numPages * m_pageSize;
+        }
+
+        if (newNumPages > numPages)
+        {
+            // grow in place if the following pages are free
+            if (page + newNumPages > m_numPages)
+            {
+                return numPages * m_pageSize;
+            }
+            for (size_t nextPage = page + numPages; nextPage < page + newNumPages; ++nextPage)
+            {
+                if (IsPageUsed(nextPage))
+                {
+                    return numPages * m_pageSize;
+                }
+            }
+            if (!CommitPages(page + newNumPages))
+            {
+                return numPages * m_pageSize;
+            }
+            MarkPages(page + numPages, newNumPages - numPages, true);
+            m_allocatedBytes += (newNumPages - numPages) * m_pageSize;
+        }
+        else
+        {
+            MarkPages(page + newNumPages, numPages - newNumPages, false);
+            m_allocatedBytes -= (numPages - newNumPages) * m_pageSize;
+            m_searchStart = AZStd::GetMin(m_searchStart, page + newNumPages);
+        }
+
+        const size_t lastPage = page + numPages - 1;
+        const size_t newLastPage = page + newNumPages - 1;
+        m_runEndPages[lastPage >> 6] &= ~(1ull << (lastPage & 63));
+        m_runEndPages[newLastPage >> 6] |= 1ull << (newLastPage & 63);
+        return newNumPages * m_pageSize;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    ReservedAddressSpaceSchema::pointer_type ReservedAddressSpaceSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            DeAllocate(ptr);
+            return nullptr;
+        }
+        if (!IsInRange(ptr) && m_desc.m_fallbackAllocator)
+        {
+            const size_t oldAllocationSize = FallbackAllocationSize(ptr, 0);
+            pointer_type newPtr = m_desc.m_fallbackAllocator->ReAllocate(ptr, newSize, newAlignment);
+            if (newPtr)
+            {
+                m_fallbackAllocatedBytes.fetch_add(FallbackAllocationSize(newPtr, newSize), AZStd::memory_order_relaxed);
+                m_fallbackAllocatedBytes.fetch_sub(oldAllocationSize, AZStd::memory_order_relaxed);
+            }
+            return newPtr;
+        }
+
+        if ((reinterpret_cast<size_t>(ptr) & (newAlignment - 1)) == 0 && Resize(ptr, newSize) >= newSize)
+        {
+            return ptr;
+        }
+
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::GetMin(AllocationSize(ptr), newSize));
+            DeAllocate(ptr);
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::AllocationSize(pointer_type ptr)
+    {
+        if (!IsInRange(ptr))
+        {
+            return FallbackAllocationSize(ptr, 0);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return GetRunPages(PageIndex(ptr)) * m_pageSize;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void ReservedAddressSpaceSchema::GarbageCollect()
+    {
+        if (m_dataBase)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            const size_t pagesPerChunk = m_commitGranularity / m_pageSize;
+            for (size_t firstPage = 0; firstPage * m_pageSize < m_committedBytes; firstPage += pagesPerChunk)
+            {
+                bool isFree = true;
+                for (size_t page = firstPage; page < firstPage + pagesPerChunk && isFree;)
+                {
+                    if ((page & 63) == 0 && page + 64 <= firstPage + pagesPerChunk)
+                    {
+                        isFree = m_usedPages[page >> 6] == 0;
+                        page += 64;
+                    }
+                    else
+                    {
+                        isFree = !IsPageUsed(page);
+                        ++page;
+                    }
+                }
+                if (isFree)
+                {
+                    Platform::DecommitAddressSpace(m_dataBase + firstPage * m_pageSize, m_commitGranularity);
+                }
+            }
+        }
+
+        if (m_desc.m_fallbackAllocator)
+        {
+            m_desc.m_fallbackAllocator->GarbageCollect();
+        }
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::NumAllocatedBytes() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_allocatedBytes + m_fallbackAllocatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::Capacity() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_committedBytes + m_fallbackAllocatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::GetMaxAllocationSize() const
+    {
+        const size_type fallbackMaxSize = m_desc.m_fallbackAllocator ? m_desc.m_fallbackAllocator->GetMaxAllocationSize() : AZ_CORE_MAX_ALLOCATOR_SIZE;
+        return AZStd::GetMax(fallbackMaxSize, m_dataBytes);
+    }
+
+    //=========================================================================
+    // FindFreePages
+    //=========================================================================
+    size_t ReservedAddressSpaceSchema::FindFreePages(size_t numPages, size_t alignmentPages) const
+    {
+        auto alignPage = [alignmentPages](size_t page)
+        {
+            return (page + alignmentPages - 1) & ~(alignmentPages - 1);
+        };
+
+        // next fit from the search start, then from the beginning of the range
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            size_t page = alignPage(pass == 0 ? m_searchStart : 0);
+            const size_t endPage = pass == 0 ? m_numPages : AZStd::GetMin(m_numPages, m_searchStart + numPages);
+            while (page + numPages <= endPage)
+            {
+                if ((page & 63) == 0 && m_usedPages[page >> 6] == ~0ull)
+                {
+                    page = alignPage(page + 64);
+                    continue;
+                }
+
+                size_t numFreePages = 0;
+                while (numFreePages < numPages && !IsPageUsed(page + numFreePages))
+                {
+                    ++numFreePages;
+                }
+                if (numFreePages == numPages)
+                {
+                    return page;
+                }
+                page = alignPage(page + numFreePages + 1);
+            }
+        }
+        return InvalidPage;
+    }
+
+    //=========================================================================
+    // MarkPages
+    //=========================================================================
+    void ReservedAddressSpaceSchema::MarkPages(size_t firstPage, size_t numPages, bool isUsed)
+    {
+        const size_t endPage = firstPage + numPages;
+        for (size_t page = firstPage; page < endPage;)
+        {
+            if ((page & 63) == 0 && page + 64 <= endPage)
+            {
+                m_usedPages[page >> 6] = isUsed ? ~0ull : 0;
+                page += 64;
+            }
+            else
+            {
+                const AZ::u64 mask = 1ull << (page & 63);
+                m_usedPages[page >> 6] = isUsed ? (m_usedPages[page >> 6] | mask) : (m_usedPages[page >> 6] & ~mask);
+                ++page;
+            }
+        }
+    }
+
+    //=========================================================================
+    // GetRunPages
+    //=========================================================================
+    size_t ReservedAddressSpaceSchema::GetRunPages(size_t firstPage) const
+    {
+        for (size_t page = firstPage; page < m_numPages; page = (page | 63) + 1)
+        {
+            const AZ::u64 runEnds = m_runEndPages[page >> 6] >> (page & 63);
+            if (runEnds)
+            {
+                return page + az_ctz_u64(runEnds) - firstPage + 1;
+            }
+        }
+        AZ_Assert(false, "Allocation at page %zu has no end!", firstPage);
+        return 1;
+    }
+
+    //=========================================================================
+    // CommitPages
+    //=========================================================================
+    bool ReservedAddressSpaceSchema::CommitPages(size_t endPage)
+    {
+        const size_t endBytes = endPage * m_pageSize;
+        if (endBytes <= m_committedBytes)
+        {
+            return true;
+        }
+
+        const size_t newCommittedBytes = AZStd::GetMin(RoundUp(endBytes, m_commitGranularity), m_dataBytes);
+        if (!Platform::CommitAddressSpace(m_dataBase + m_committedBytes, newCommittedBytes - m_committedBytes, m_desc.m_hugePages))
+        {
+            return false;
+        }
+        m_committedBytes = newCommittedBytes;
+        return true;
+    }
+
+    //=========================================================================
+    // FallbackAllocate
+    //=========================================================================
+    ReservedAddressSpaceSchema::pointer_type
+    ReservedAddressSpaceSchema::FallbackAllocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        pointer_type address = nullptr;
+        if (m_desc.m_fallbackAllocator)
+        {
+            address = m_desc.m_fallbackAllocator->Allocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord + 1);
+        }
+        else
+        {
+            const size_t blockAlignment = AZStd::GetMax<size_t>(alignment, alignof(OSBlockHeader));
+            const size_t headerBytes = RoundUp(sizeof(OSBlockHeader), blockAlignment);
+            char* block = reinterpret_cast<char*>(AZ_OS_MALLOC(byteSize + headerBytes, blockAlignment));
+            if (block)
+            {
+                address = block + headerBytes;
+                OSBlockHeader* header = reinterpret_cast<OSBlockHeader*>(address) - 1;
+                header->m_size = byteSize;
+                header->m_offset = headerBytes;
+            }
+        }
+        if (address)
+        {
+            m_fallbackAllocatedBytes.fetch_add(FallbackAllocationSize(address, byteSize), AZStd::memory_order_relaxed);
+        }
+        return address;
+    }
+
+    //=========================================================================
+    // FallbackDeAllocate
+    //=========================================================================
+    void ReservedAddressSpaceSchema::FallbackDeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        // the size passed in by the caller is often 0, use the size of the allocation
+        const size_t allocationSize = FallbackAllocationSize(ptr, byteSize);
+        if (m_desc.m_fallbackAllocator)
+        {
+            m_desc.m_fallbackAllocator->DeAllocate(ptr, byteSize, alignment);
+        }
+        else
+        {
+            AZ_OS_FREE(reinterpret_cast<char*>(ptr) - (reinterpret_cast<OSBlockHeader*>(ptr) - 1)->m_offset);
+        }
+        m_fallbackAllocatedBytes.fetch_sub(allocationSize, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // FallbackAllocationSize
+    //=========================================================================
+    ReservedAddressSpaceSchema::size_type ReservedAddressSpaceSchema::FallbackAllocationSize(pointer_type ptr, size_type byteSize)
+    {
+        if (m_desc.m_fallbackAllocator)
+        {
+            // not every allocator tracks the size of its allocations, then the size the caller provided is used
+            const size_type allocationSize = m_desc.m_fallbackAllocator->AllocationSize(ptr);
+            return allocationSize ? allocationSize : byteSize;
+        }
+        return (reinterpret_cast<const OSBlockHeader*>(ptr) - 1)->m_size;
+    }
+} // namespace AZ
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/IAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Page allocator which reserves one large virtual address range up front and commits it incrementally,
+     * optionally backed with huge pages. Keeping the (page granular) allocations of an allocator in one
+     * contiguous range, committed in huge page sized chunks, reduces TLB misses and address space fragmentation
+     * compared to mapping many small chunks from the OS heap.
+     *
+     * Allocations smaller than a page, allocations that don't fit in the reserved range and all allocations
+     * on platforms without virtual memory support are forwarded to the fallback allocator (the OS heap by default).
+     * The schema is thread safe.
+     */
+    class ReservedAddressSpaceSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        enum class HugePages : AZ::u8
+        {
+            None,           ///< Regular OS pages.
+            Transparent,    ///< Transparent huge pages, the OS promotes the committed chunks to huge pages when it can (Linux madvise(MADV_HUGEPAGE)).
+            Explicit,       ///< Huge pages from the OS huge page pool (Linux MAP_HUGETLB), falls back to Transparent when the pool is empty.
+        };
+
+        struct Descriptor
+        {
+            size_t              m_reservedBytes = 4ull * 1024 * 1024 * 1024;   ///< Size of the reserved virtual address range, no memory is committed for it.
+            size_t              m_commitGranularity = 2 * 1024 * 1024;         ///< Memory is committed in chunks of this size, rounded up to the huge page size.
+            HugePages           m_hugePages = HugePages::Transparent;
+            IAllocatorAllocate* m_fallbackAllocator = nullptr;                 ///< Allocator for the allocations we can't serve, nullptr to use the OS heap.
+        };
+
+        ReservedAddressSpaceSchema(const Descriptor& desc);
+        ~ReservedAddressSpaceSchema() override;
+
+        /// Returns false if the address range couldn't be reserved, all allocations are then forwarded to the fallback allocator.
+        bool IsReserved() const { return m_dataBase != nullptr; }
+        /// Returns true if the address is in the reserved range.
+        bool IsInRange(const void* address) const
+        {
+            return address >= m_dataBase && address < m_dataBase + m_dataBytes;
+        }
+        /// Returns the size of the chunks memory is committed in, a multiple of the huge page size if huge pages are used.
+        size_t GetCommitGranularity() const { return m_commitGranularity; }
+        /// Returns the number of committed bytes in the reserved range (including the ones returned by \ref GarbageCollect).
+        size_t GetCommittedBytes() const { return m_committedBytes; }
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorAllocate
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Returns the fully free committed chunks to the OS, they stay mapped and are faulted back in on the next use.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override { return m_desc.m_fallbackAllocator; }
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        ReservedAddressSpaceSchema(const ReservedAddressSpaceSchema&) = delete;
+        ReservedAddressSpaceSchema& operator=(const ReservedAddressSpaceSchema&) = delete;
+
+        static const size_t InvalidPage = static_cast<size_t>(-1);
+
+        bool IsPageUsed(size_t page) const { return (m_usedPages[page >> 6] & (1ull << (page & 63))) != 0; }
+        bool IsRunEnd(size_t page) const { return (m_runEndPages[page >> 6] & (1ull << (page & 63))) != 0; }
+        size_t PageIndex(const void* address) const { return static_cast<size_t>(reinterpret_cast<const char*>(address) - m_dataBase) / m_pageSize; }
+
+        size_t FindFreePages(size_t numPages, size_t alignmentPages) const;
+        void MarkPages(size_t firstPage, size_t numPages, bool isUsed);
+        size_t GetRunPages(size_t firstPage) const;
+        bool CommitPages(size_t endPage);
+
+        pointer_type FallbackAllocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord);
+        void FallbackDeAllocate(pointer_type ptr, size_type byteSize, size_type alignment);
+        //! Returns the size of an allocation from the fallback allocator, byteSize if the allocator doesn't track sizes.
+        size_type FallbackAllocationSize(pointer_type ptr, size_type byteSize);
+
+        Descriptor m_desc;
+        char* m_reservedBase = nullptr;    ///< Start of the reserved range, the page bitmaps are stored at the start.
+        size_t m_reservedBytes = 0;
+        char* m_dataBase = nullptr;        ///< Start of the allocatable range, aligned on the commit granularity.
+        size_t m_dataBytes = 0;
+        size_t m_pageSize = 0;
+        size_t m_commitGranularity = 0;
+        size_t m_numPages = 0;
+        AZ::u64* m_usedPages = nullptr;    ///< Bit per page, set if allocated.
+        AZ::u64* m_runEndPages = nullptr;  ///< Bit per page, set on the last page of each allocation.
+
+        mutable AZStd::mutex m_mutex;
+        size_t m_searchStart = 0;          ///< First page checked by the next allocation (next fit).
+        size_t m_committedBytes = 0;       ///< Committed bytes from m_dataBase.
+        size_t m_allocatedBytes = 0;
+        AZStd::atomic_size_t m_fallbackAllocatedBytes{ 0 };
+    };
+
+    AZ_TYPE_INFO_SPECIALIZE(ReservedAddressSpaceSchema::HugePages, "{3C0F8E2A-6B1D-4E57-9A0C-5D7F2B8E41A6}");
+
+    namespace Platform
+    {
+        //! Returns the virtual memory page size.
+        size_t GetVirtualMemoryPageSize();
+        //! Returns the huge page size, 0 if huge pages are not supported.
+        size_t GetHugePageSize();
+        //! Reserves a range of virtual address space, without committing memory for it. Returns nullptr on failure or if the platform doesn't support it.
+        void* ReserveAddressSpace(size_t byteSize, size_t alignment);
+        //! Releases a range returned by ReserveAddressSpace.
+        void ReleaseAddressSpace(void* address, size_t byteSize);
+        //! Commits a page aligned part of a reserved range, huge pages require address and size to be huge page aligned.
+        bool CommitAddressSpace(void* address, size_t byteSize, ReservedAddressSpaceSchema::HugePages hugePages);
+        //! Returns the memory of a committed range to the OS, the range stays usable and reads back as zeros.
+        void DecommitAddressSpace(void* address, size_t byteSize);
+    }
+}
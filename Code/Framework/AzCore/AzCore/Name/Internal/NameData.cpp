@@ -36,10 +36,16 @@ namespace AZ
         void NameData::release()
         {
             AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
-            if (m_useCount.fetch_sub(1) == 1)
+            // Only the last reference needs the dictionary, which protects the data from being deleted by another thread meanwhile
+            int32_t useCount = m_useCount.load(AZStd::memory_order_relaxed);
+            while (useCount > 1)
             {
-                AZ::NameDictionary::Instance().TryReleaseName(this);
+                if (m_useCount.compare_exchange_weak(useCount, useCount - 1, AZStd::memory_order_acq_rel))
+                {
+                    return;
+                }
             }
+            AZ::NameDictionary::Instance().ReleaseName(this);
         }
     }
 }
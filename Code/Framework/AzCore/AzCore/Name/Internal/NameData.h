@@ -33,6 +33,14 @@ namespace AZ
             //! Returns the hash part of the name data.
             Hash GetHash() const;
 
+            //! Calculates the hash of a name string, before any collision resolution.
+            //! AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            //! of network synchronization. So just take the low 32 bits.
+            static constexpr Hash CalcHash(AZStd::string_view name)
+            {
+                return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+            }
+
         private:
             NameData(AZStd::string&& name, Hash hash);
 
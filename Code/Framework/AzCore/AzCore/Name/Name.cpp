@@ -38,6 +38,12 @@ namespace AZ
         , m_hash{data->GetHash()}
     {}
 
+    Name::Name(Internal::NameData* data, AdoptReference)
+        : m_data{data, false}
+        , m_view{data->GetName()}
+        , m_hash{data->GetHash()}
+    {}
+
     Name::Name(const Name& rhs)
     {
         *this = rhs;
@@ -197,5 +203,19 @@ namespace AZ
         }
     }
     
+    NameLiteral::~NameLiteral()
+    {
+        if (m_name.load(AZStd::memory_order_acquire) != nullptr && NameDictionary::IsReady())
+        {
+            NameDictionary::Instance().ReleaseLiteral(*this);
+        }
+    }
+
+    const Name& NameLiteral::Resolve() const
+    {
+        AZ_Assert(NameDictionary::IsReady(), "Attempted to use NameLiteral '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(m_view));
+        return NameDictionary::Instance().ResolveLiteral(*this);
+    }
+
 } // namespace AZ
 
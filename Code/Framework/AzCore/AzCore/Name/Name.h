@@ -12,6 +12,7 @@
 namespace AZ
 {
     class NameDictionary;
+    class NameLiteral;
     class ScriptDataContext;
     class ReflectContext;
 
@@ -24,10 +25,11 @@ namespace AZ
     //! Equality-comparison of two Name objects is very fast.
     //!
     //! The dictionary must be initialized before Name objects are created.
-    //! A Name instance must not be statically declared.
+    //! A Name instance must not be statically declared, use NameLiteral (AZ_NAME_LITERAL) for names known at compile time.
     class Name
     {
         friend NameDictionary;
+        friend NameLiteral;
     public:
         using Hash = Internal::NameData::Hash;
 
@@ -101,6 +103,10 @@ namespace AZ
         // This constructor is used by NameDictionary to construct from a dictionary-held NameData instance.
         Name(Internal::NameData* nameData);
 
+        // Takes over a reference already added to nameData by the NameDictionary.
+        struct AdoptReference {};
+        Name(Internal::NameData* nameData, AdoptReference);
+
         static void ScriptConstructor(Name* thisPtr, ScriptDataContext& dc);
 
         // Points to the string that represents the value of this name.
@@ -115,8 +121,73 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+
+    //! A name known at compile time, safe to declare statically.
+    //! The string is hashed at compile time and the dictionary entry is only looked up on first use, after which
+    //! GetName() is a pointer load. The entry is released when the literal or the NameDictionary is destroyed,
+    //! and is looked up again if the literal is used with a new NameDictionary.
+    //! AZ_NAME_LITERAL("MyName") wraps a function local NameLiteral and returns its Name.
+    class NameLiteral
+    {
+        friend NameDictionary;
+    public:
+        constexpr explicit NameLiteral(AZStd::string_view name)
+            : m_view(name)
+            , m_hash(Internal::NameData::CalcHash(name))
+        {
+        }
+
+        ~NameLiteral();
+
+        //! Returns the name, adding it to the dictionary on first use.
+        const Name& GetName() const
+        {
+            if (const Name* name = m_name.load(AZStd::memory_order_acquire))
+            {
+                return *name;
+            }
+            return Resolve();
+        }
+
+        operator const Name&() const
+        {
+            return GetName();
+        }
+
+        AZStd::string_view GetStringView() const
+        {
+            return m_view;
+        }
+
+    private:
+        NameLiteral(const NameLiteral&) = delete;
+        NameLiteral& operator=(const NameLiteral&) = delete;
+
+        const Name& Resolve() const;
+
+        // Storage for the name, only constructed once the literal is resolved
+        union NameStorage
+        {
+            constexpr NameStorage() : m_unused(0) {}
+            ~NameStorage() {}
+
+            char m_unused;
+            Name m_name;
+        };
+
+        AZStd::string_view m_view;
+        Name::Hash m_hash;
+        mutable AZStd::atomic<const Name*> m_name{ nullptr }; //!< Points to m_storage once resolved
+        mutable NameStorage m_storage;
+        mutable const NameLiteral* m_next = nullptr;          //!< Next resolved literal in the NameDictionary
+    };
+
 } // namespace AZ
 
+//! Returns a const AZ::Name& for a string literal, looking it up in the NameDictionary only on first use.
+#define AZ_NAME_LITERAL(str) \
+    ([]() -> const AZ::Name& { static const AZ::NameLiteral s_azNameLiteral{ str }; return s_azNameLiteral.GetName(); }())
+
 namespace AZStd
 {
     template <typename T>
@@ -75,44 +75,223 @@ namespace AZ
         return *(*s_instance);
     }
     
+    //! Open addressing table of the entries of a shard, probed linearly from the low bits of the hash.
+    //! Slots only go from empty to an entry, and from an entry to the removed marker, so readers can probe it
+    //! while the shard owner changes it. It is replaced by a bigger one when it runs out of empty slots.
+    struct NameDictionary::Table
+    {
+        AZ_CLASS_ALLOCATOR(NameDictionary::Table, AZ::OSAllocator, 0);
+
+        explicit Table(size_t capacity)
+            : m_capacity(capacity)
+            , m_slots(reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(
+                AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(capacity * sizeof(AZStd::atomic<Internal::NameData*>), alignof(AZStd::atomic<Internal::NameData*>), 0, "NameDictionary::Table", __FILE__, __LINE__)))
+        {
+            for (size_t i = 0; i < m_capacity; ++i)
+            {
+                new (&m_slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+            }
+        }
+
+        ~Table()
+        {
+            AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_slots, m_capacity * sizeof(AZStd::atomic<Internal::NameData*>), alignof(AZStd::atomic<Internal::NameData*>));
+        }
+
+        static bool IsEntry(const Internal::NameData* data)
+        {
+            return data != nullptr && data != Removed();
+        }
+
+        //! Marks the slot of a removed entry, readers keep probing past it.
+        static Internal::NameData* Removed()
+        {
+            return reinterpret_cast<Internal::NameData*>(alignof(Internal::NameData));
+        }
+
+        //! Returns the entry for the hash, nullptr if there is none.
+        Internal::NameData* Find(Name::Hash hash) const
+        {
+            const size_t mask = m_capacity - 1;
+            for (size_t index = hash & mask; ; index = (index + 1) & mask)
+            {
+                Internal::NameData* data = m_slots[index].load(AZStd::memory_order_acquire);
+                if (data == nullptr)
+                {
+                    return nullptr;
+                }
+                if (data != Removed() && data->GetHash() == hash)
+                {
+                    return data;
+                }
+            }
+        }
+
+        const size_t m_capacity;
+        AZStd::atomic<Internal::NameData*>* const m_slots;
+    };
+
+    //! Read side critical section, entries and tables seen inside of it are not deleted until it ends.
+    //! Readers count themselves in one of two sets of counters, selected by the parity of the reader epoch.
+    //! Retired objects are deleted once the epoch has changed and the counters of the previous parity drained.
+    class NameDictionary::ReadScope
+    {
+    public:
+        explicit ReadScope(const NameDictionary& dictionary)
+        {
+            // Spread the threads over the counter stripes so that readers rarely share a cache line
+            static AZStd::atomic<uint32_t> s_nextStripe{ 0 };
+            static thread_local uint32_t s_stripe = s_nextStripe.fetch_add(1, AZStd::memory_order_relaxed) % ReaderStripeCount;
+
+            ReaderCounters& counters = const_cast<ReaderCounters&>(dictionary.m_readers[s_stripe]);
+            const AZStd::atomic<uint32_t>& readerEpoch = dictionary.m_readerEpoch;
+            for (;;)
+            {
+                const uint32_t epoch = readerEpoch.load();
+                m_counter = &counters.m_counts[epoch & 1];
+                m_counter->fetch_add(1);
+                // If the epoch changed meanwhile the reclaiming thread may have missed this reader, count again
+                if (readerEpoch.load() == epoch)
+                {
+                    break;
+                }
+                m_counter->fetch_sub(1, AZStd::memory_order_release);
+            }
+        }
+
+        ~ReadScope()
+        {
+            m_counter->fetch_sub(1, AZStd::memory_order_release);
+        }
+
+    private:
+        AZStd::atomic<int32_t>* m_counter = nullptr;
+    };
+
+    namespace NameDictionaryInternal
+    {
+        //! Takes a reference to data unless it is being deleted.
+        static bool TryAddReference(AZStd::atomic_int& useCount)
+        {
+            int32_t count = useCount.load(AZStd::memory_order_relaxed);
+            while (count >= 0)
+            {
+                if (useCount.compare_exchange_weak(count, count + 1, AZStd::memory_order_acq_rel))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
     NameDictionary::NameDictionary()
     {}
 
     NameDictionary::~NameDictionary()
     {
+        // Literals hold on to their names until the dictionary goes away
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+            while (const NameLiteral* literal = m_literals)
+            {
+                m_literals = literal->m_next;
+                literal->m_next = nullptr;
+                literal->m_name.store(nullptr, AZStd::memory_order_relaxed);
+                literal->m_storage.m_name.~Name();
+            }
+        }
+
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+            if (table == nullptr)
+            {
+                continue;
+            }
 
-            if (useCount == 0)
+            for (size_t i = 0; i < table->m_capacity; ++i)
+            {
+                Internal::NameData* nameData = table->m_slots[i].load(AZStd::memory_order_relaxed);
+                if (!Table::IsEntry(nameData))
+                {
+                    continue;
+                }
+
+                const int useCount = nameData->m_useCount;
+                const bool hadCollision = nameData->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
+                }
+            }
+            delete table;
+        }
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (Internal::NameData* nameData : m_retiredNames[i])
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
                 delete nameData;
             }
-            else
+            for (Table* table : m_retiredTables[i])
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                delete table;
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        // The top bits select the shard, so that the consecutive hashes used to resolve collisions stay in it
+        return m_shards[hash >> (32 - ShardBits)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> (32 - ShardBits)];
+    }
+
+    Name::Hash NameDictionary::NextHash(Name::Hash hash)
+    {
+        constexpr Name::Hash ShardMask = ~Name::Hash{ 0 } << (32 - ShardBits);
+        return (hash & ShardMask) | ((hash + 1) & ~ShardMask);
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
         {
-            return Name(iter->second);
+            ReadScope readScope(*this);
+            const Table* table = shard.m_table.load(AZStd::memory_order_acquire);
+            Internal::NameData* nameData = table ? table->Find(hash) : nullptr;
+            if (nameData == nullptr)
+            {
+                return Name();
+            }
+            if (NameDictionaryInternal::TryAddReference(nameData->m_useCount))
+            {
+                return Name(nameData, Name::AdoptReference{});
+            }
         }
-        return Name();
+
+        // The entry is being removed, check again once that's done
+        AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+        const Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        Internal::NameData* nameData = table ? table->Find(hash) : nullptr;
+        return nameData ? Name(nameData) : Name();
     }
 
     Name NameDictionary::MakeName(AZStd::string_view nameString)
@@ -123,46 +302,156 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        if (nameString.empty())
         {
-            return AZStd::move(name);
+            return Name();
+        }
+
+        Shard& shard = GetShard(hash);
+
+        // If we find the same name, just take a reference to it. 
+        // This path is faster than the loop below because it doesn't lock, whereas the
+        // loop requires the shard lock to modify the dictionary.
+        {
+            ReadScope readScope(*this);
+            const Table* table = shard.m_table.load(AZStd::memory_order_acquire);
+            for (Name::Hash probeHash = hash; table != nullptr; probeHash = NextHash(probeHash))
+            {
+                Internal::NameData* nameData = table->Find(probeHash);
+                if (nameData == nullptr)
+                {
+                    break;
+                }
+                if (nameData->GetName() == nameString)
+                {
+                    if (NameDictionaryInternal::TryAddReference(nameData->m_useCount))
+                    {
+                        return Name(nameData, Name::AdoptReference{});
+                    }
+                    break;
+                }
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
 
-        auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
+            const Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+            Internal::NameData* nameData = table ? table->Find(hash) : nullptr;
+
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (nameData == nullptr)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                nameData = aznew Internal::NameData(AZStd::string(nameString), hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                InsertEntry(shard, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            else if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                hash = NextHash(hash);
+            }
+        }
+    }
+
+    void NameDictionary::InsertEntry(Shard& shard, Internal::NameData* nameData)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+
+        // Keep at least a quarter of the slots empty so that probes stay short and always end
+        if (table == nullptr || (shard.m_usedSlotCount + 1) * 4 > table->m_capacity * 3)
+        {
+            size_t capacity = 16;
+            while ((shard.m_entryCount + 1) * 2 > capacity)
+            {
+                capacity *= 2;
+            }
+
+            Table* newTable = aznew Table(capacity);
+            if (table != nullptr)
+            {
+                for (size_t i = 0; i < table->m_capacity; ++i)
+                {
+                    Internal::NameData* entry = table->m_slots[i].load(AZStd::memory_order_relaxed);
+                    if (Table::IsEntry(entry))
+                    {
+                        size_t index = entry->GetHash() & (capacity - 1);
+                        while (newTable->m_slots[index].load(AZStd::memory_order_relaxed) != nullptr)
+                        {
+                            index = (index + 1) & (capacity - 1);
+                        }
+                        newTable->m_slots[index].store(entry, AZStd::memory_order_relaxed);
+                    }
+                }
+            }
+            shard.m_table.store(newTable, AZStd::memory_order_release);
+            shard.m_usedSlotCount = shard.m_entryCount;
+            if (table != nullptr)
+            {
+                Retire(nullptr, table);
+            }
+            table = newTable;
+        }
+
+        const size_t mask = table->m_capacity - 1;
+        size_t index = nameData->GetHash() & mask;
+        for (;; index = (index + 1) & mask)
+        {
+            Internal::NameData* entry = table->m_slots[index].load(AZStd::memory_order_relaxed);
+            if (entry == nullptr)
+            {
+                ++shard.m_usedSlotCount;
+                break;
+            }
+            if (entry == Table::Removed())
+            {
+                break;
             }
         }
+        table->m_slots[index].store(nameData, AZStd::memory_order_release);
+        ++shard.m_entryCount;
+    }
+
+    void NameDictionary::RemoveEntry(Shard& shard, Internal::NameData* nameData)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        const size_t mask = table->m_capacity - 1;
+        for (size_t index = nameData->GetHash() & mask; ; index = (index + 1) & mask)
+        {
+            if (table->m_slots[index].load(AZStd::memory_order_relaxed) == nameData)
+            {
+                table->m_slots[index].store(Table::Removed(), AZStd::memory_order_release);
+                --shard.m_entryCount;
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::ReleaseName(Internal::NameData* nameData)
+    {
+        // Another thread can take and drop a reference and remove the entry as soon as the count hits zero,
+        // so the data is only safe to access within the read scope from here on.
+        ReadScope readScope(*this);
+        if (nameData->m_useCount.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+        {
+            TryReleaseName(nameData);
+        }
     }
 
     void NameDictionary::TryReleaseName(Internal::NameData* nameData)
@@ -184,27 +473,148 @@ namespace AZ
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        {
+            Shard& shard = GetShard(nameData->GetHash());
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+            // Check m_hashCollision again inside the shard lock because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name.
+            int32_t expectedRefCount = 0;
+            if (!nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                return;
+            }
+
+            RemoveEntry(shard, nameData);
+            // Lock free readers may still be looking at the data, it is deleted once they are done
+            Retire(nameData, nullptr);
+        }
+
+        ReportStats();
+    }
+
+    void NameDictionary::Retire(Internal::NameData* nameData, Table* table)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_reclaimMutex);
+        if (nameData != nullptr)
+        {
+            m_retiredNames[0].push_back(nameData);
+        }
+        if (table != nullptr)
+        {
+            m_retiredTables[0].push_back(table);
+        }
+        Reclaim();
+    }
+
+    void NameDictionary::Reclaim()
+    {
+        for (;;)
+        {
+            // Readers counted with the previous epoch parity may still see the objects retired before the epoch changed
+            const uint32_t previousParity = (m_readerEpoch.load() & 1) ^ 1;
+            for (const ReaderCounters& counters : m_readers)
+            {
+                if (counters.m_counts[previousParity].load() != 0)
+                {
+                    return;
+                }
+            }
+
+            for (Internal::NameData* nameData : m_retiredNames[1])
+            {
+                delete nameData;
+            }
+            for (Table* table : m_retiredTables[1])
+            {
+                delete table;
+            }
+            m_retiredNames[1].clear();
+            m_retiredTables[1].clear();
+
+            if (m_retiredNames[0].empty() && m_retiredTables[0].empty())
+            {
+                return;
+            }
+
+            // Readers entering from now on can't see the retired objects, wait for the ones counted before to leave
+            m_retiredNames[0].swap(m_retiredNames[1]);
+            m_retiredTables[0].swap(m_retiredTables[1]);
+            m_readerEpoch.fetch_add(1);
+        }
+    }
+
+    const Name& NameDictionary::ResolveLiteral(const NameLiteral& literal)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+        if (const Name* name = literal.m_name.load(AZStd::memory_order_acquire))
+        {
+            return *name;
+        }
+
+        const Name* name = new (&literal.m_storage.m_name) Name(MakeName(literal.m_view, literal.m_hash));
+        literal.m_next = m_literals;
+        m_literals = &literal;
+        literal.m_name.store(name, AZStd::memory_order_release);
+        return *name;
+    }
+
+    void NameDictionary::ReleaseLiteral(const NameLiteral& literal)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_literalMutex);
+        if (literal.m_name.load(AZStd::memory_order_relaxed) == nullptr)
         {
             return;
         }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+        for (const NameLiteral** link = &m_literals; *link != nullptr; link = &(*link)->m_next)
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            if (*link == &literal)
+            {
+                *link = literal.m_next;
+                break;
+            }
         }
+        literal.m_next = nullptr;
+        literal.m_name.store(nullptr, AZStd::memory_order_relaxed);
+        literal.m_storage.m_name.~Name();
+    }
 
-        ReportStats();
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+            entryCount += shard.m_entryCount;
+        }
+        return entryCount;
+    }
+
+    void NameDictionary::VisitEntries(const AZStd::function<void(Internal::NameData*)>& visitor) const
+    {
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+            const Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+            for (size_t i = 0; table != nullptr && i < table->m_capacity; ++i)
+            {
+                Internal::NameData* nameData = table->m_slots[i].load(AZStd::memory_order_relaxed);
+                if (Table::IsEntry(nameData))
+                {
+                    visitor(nameData);
+                }
+            }
+        }
     }
 
     void NameDictionary::ReportStats() const
@@ -222,34 +632,36 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            VisitEntries([&](Internal::NameData* nameData)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                ++nameCount;
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
-            }
+            });
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %zu\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -274,9 +686,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Internal::NameData::CalcHash(name);
     }
 }
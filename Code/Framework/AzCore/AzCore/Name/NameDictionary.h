@@ -7,10 +7,12 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -42,16 +44,24 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split in shards selected by the top bits of the hash, each with its own lock for
+    //! adding and removing names. Looking up names that already exist doesn't lock: the entries of a shard
+    //! are kept in an open addressing table that is read lock free, and removed entries are only deleted
+    //! once no thread can still be reading them.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
 
         friend Module;
         friend Name;
+        friend NameLiteral;
         friend Internal::NameData;
         friend UnitTest::NameDictionaryTester;
         
     public:
+        static constexpr uint32_t ShardBits = 4;
+        static constexpr uint32_t ShardCount = 1 << ShardBits;
 
         static void Create();
 
@@ -75,22 +85,86 @@ namespace AZ
         NameDictionary();
         ~NameDictionary();
 
+        struct Table;
+        class ReadScope;
+
+        struct Shard
+        {
+            mutable AZStd::mutex m_mutex;            //!< Serializes changes to the shard.
+            AZStd::atomic<Table*> m_table{ nullptr }; //!< Read without locking, replaced when it has to grow.
+            size_t m_entryCount = 0;
+            size_t m_usedSlotCount = 0;              //!< Entries and removed entry markers in m_table.
+        };
+
+        //! Read side counters of the threads mapped to the same stripe, one per reader epoch parity.
+        struct alignas(64) ReaderCounters
+        {
+            AZStd::atomic<int32_t> m_counts[2] = { {0}, {0} };
+        };
+        static constexpr uint32_t ReaderStripeCount = 32;
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        //! Makes a Name with a precomputed hash for the string.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
         void ReportStats() const;
 
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
+        //! Drops a reference to the name data, releasing it from the dictionary if it was the last one.
+        void ReleaseName(Internal::NameData* data);
+
         // Attempts to release the name from the dictionary, but checks to make sure
         // a reference wasn't taken by another thread.
         void TryReleaseName(Internal::NameData* data);
         
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        //! Makes the name of a literal the first time it is used and keeps it until the literal or the dictionary is destroyed.
+        const Name& ResolveLiteral(const NameLiteral& literal);
+        void ReleaseLiteral(const NameLiteral& literal);
+
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Adds a new entry to a shard, the shard must be locked.
+        void InsertEntry(Shard& shard, Internal::NameData* data);
+        //! Removes an entry from a shard, the shard must be locked.
+        void RemoveEntry(Shard& shard, Internal::NameData* data);
+
+        //! Defers deleting a name or a table until no thread can be reading it.
+        void Retire(Internal::NameData* data, Table* table);
+        //! Deletes the retired objects no reader can still see, m_reclaimMutex must be locked.
+        void Reclaim();
+
+        //! Returns the number of names in the dictionary.
+        size_t GetEntryCount() const;
+
+        //! Calls visitor for every name in the dictionary, for tests and stats.
+        void VisitEntries(const AZStd::function<void(Internal::NameData*)>& visitor) const;
+
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        //! Returns the hash to try after a collision on hash, it stays in the same shard.
+        static Name::Hash NextHash(Name::Hash hash);
+
+        Shard m_shards[ShardCount];
+
+        ReaderCounters m_readers[ReaderStripeCount];
+        AZStd::atomic<uint32_t> m_readerEpoch{ 0 }; //!< Readers count themselves in the counters of the epoch parity.
+
+        AZStd::mutex m_reclaimMutex;
+        AZStd::vector<Internal::NameData*> m_retiredNames[2]; //!< [0] retired since the last epoch change, [1] retired before it
+        AZStd::vector<Table*> m_retiredTables[2];
+
+        AZStd::mutex m_literalMutex;
+        const NameLiteral* m_literals = nullptr; //!< Resolved literals
     };
 }
@@ -19,6 +19,7 @@ namespace AZ
     class JsonDeserializer final
     {
         friend class JsonSerialization;
+        friend class JsonStreamingDeserializer;
         friend class BaseJsonSerializer;
 
     private:
@@ -16,6 +16,11 @@
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     class BaseJsonSerializer;
     
     enum class JsonMergeApproach
@@ -152,6 +157,42 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the json document in the stream into the supplied object while it's being parsed, without first building the
+        //! document in memory. Classes are loaded member by member and only the values that are handled by a json serializer,
+        //! such as containers or pointers, are briefly held as json values. The result is the same as parsing the document and
+        //! calling Load, so use the Load that takes a rapidjson::Value if the document needs to be merged or patched first.
+        //! Note: A syntax error will only be found when it's reached, so the object may be partially loaded when the document is invalid.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json document in the stream into the supplied object while it's being parsed.
+        //! See the other LoadFromStream functions for details.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the json document in the stream into the supplied object while it's being parsed.
+        //! See the other LoadFromStream functions for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json document in the stream into the supplied object while it's being parsed.
+        //! See the other LoadFromStream functions for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -311,6 +352,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
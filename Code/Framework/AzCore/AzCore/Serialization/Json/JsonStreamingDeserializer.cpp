@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+
+namespace AZ
+{
+    namespace JsonStreamingDeserializerInternal
+    {
+        //! Input stream for the rapidjson reader that reads the GenericStream in blocks, so the document doesn't need to be
+        //! loaded into memory before parsing.
+        class GenericStreamReadWrapper
+        {
+        public:
+            using Ch = char;
+
+            explicit GenericStreamReadWrapper(IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+                Fill();
+            }
+
+            Ch Peek() const
+            {
+                return m_current < m_end ? *m_current : '\0';
+            }
+
+            Ch Take()
+            {
+                if (m_current == m_end)
+                {
+                    return '\0';
+                }
+                Ch result = *m_current++;
+                if (m_current == m_end)
+                {
+                    Fill();
+                }
+                return result;
+            }
+
+            size_t Tell() const
+            {
+                return m_consumed + (m_current - m_buffer);
+            }
+
+            // Writing is only needed for in-situ parsing, which isn't supported for streams.
+            Ch* PutBegin()
+            {
+                AZ_Assert(false, "GenericStreamReadWrapper PutBegin not supported.");
+                return nullptr;
+            }
+            void Put(Ch)
+            {
+                AZ_Assert(false, "GenericStreamReadWrapper Put not supported.");
+            }
+            void Flush()
+            {
+            }
+            size_t PutEnd(Ch*)
+            {
+                AZ_Assert(false, "GenericStreamReadWrapper PutEnd not supported.");
+                return 0;
+            }
+
+        private:
+            void Fill()
+            {
+                m_consumed += m_end - m_buffer;
+                IO::SizeType bytesRead = m_stream.Read(BufferSize, m_buffer);
+                m_current = m_buffer;
+                m_end = m_buffer + bytesRead;
+            }
+
+            static constexpr size_t BufferSize = 16 * 1024;
+
+            IO::GenericStream& m_stream;
+            size_t m_consumed{ 0 };
+            Ch* m_current{ m_buffer };
+            Ch* m_end{ m_buffer };
+            Ch m_buffer[BufferSize];
+        };
+    } // namespace JsonStreamingDeserializerInternal
+
+    JsonStreamingDeserializer::ClassFrame::ClassFrame(void* object, const SerializeContext::ClassData& classData)
+        : m_object(object)
+        , m_classData(&classData)
+        , m_result(JsonSerializationResult::Tasks::ReadField)
+    {
+    }
+
+    JsonStreamingDeserializer::JsonStreamingDeserializer(void* object, const Uuid& objectType, JsonDeserializerContext& context)
+        : m_context(context)
+        , m_result(JsonSerializationResult::Tasks::ReadField)
+        , m_pendingObject(object)
+        , m_rootType(objectType)
+    {
+        m_capture.SetArray();
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        JsonStreamingDeserializerInternal::GenericStreamReadWrapper inputStream(stream);
+        JsonStreamingDeserializer deserializer(object, objectType, context);
+        rapidjson::Reader reader;
+        constexpr int flags = rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+        rapidjson::ParseResult parseResult = reader.Parse<flags>(inputStream, deserializer);
+        if (parseResult.IsError() && parseResult.Code() != rapidjson::kParseErrorTermination)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format(R"(Unable to parse json document due to error "%s" at offset %zu.)",
+                    rapidjson::GetParseError_En(parseResult.Code()), parseResult.Offset()));
+        }
+        return deserializer.m_result;
+    }
+
+    const SerializeContext::ClassData* JsonStreamingDeserializer::FindStreamableClass(const Uuid& typeId) const
+    {
+        // Mirrors the checks in JsonDeserializer::Load that lead to LoadClass.
+        if (m_context.GetRegistrationContext()->GetSerializerForType(typeId))
+        {
+            return nullptr;
+        }
+        const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+        if (!classData || classData->m_container)
+        {
+            return nullptr;
+        }
+        if (classData->m_azRtti)
+        {
+            if (classData->m_azRtti->GetGenericTypeId() != typeId ||
+                (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+            {
+                return nullptr;
+            }
+        }
+        return classData;
+    }
+
+    bool JsonStreamingDeserializer::Null()
+    {
+        return AddScalar(rapidjson::Value());
+    }
+
+    bool JsonStreamingDeserializer::Bool(bool value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int(int value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint(unsigned value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int64(int64_t value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint64(uint64_t value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Double(double value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::RawNumber(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        return String(value, length, copy);
+    }
+
+    bool JsonStreamingDeserializer::String(const char* value, rapidjson::SizeType length, bool /*copy*/)
+    {
+        if (IsSkippingValue())
+        {
+            return AddScalar(rapidjson::Value());
+        }
+        return AddScalar(rapidjson::Value(value, length, m_capture.GetAllocator()));
+    }
+
+    bool JsonStreamingDeserializer::StartObject()
+    {
+        return BeginContainer(true);
+    }
+
+    bool JsonStreamingDeserializer::Key(const char* value, rapidjson::SizeType length, bool /*copy*/)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (m_captureDepth > 0)
+        {
+            m_capture.PushBack(rapidjson::Value(value, length, m_capture.GetAllocator()), m_capture.GetAllocator());
+            return true;
+        }
+
+        AZ_Assert(m_pendingValue == PendingValue::None && !m_classStack.empty(), "Json key found outside of a class that's being loaded.");
+        ClassFrame& frame = m_classStack.back();
+        frame.m_memberCount++;
+
+        AZStd::string_view name(value, length);
+        if (name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            m_pendingValue = PendingValue::Skip;
+            return true;
+        }
+
+        JsonDeserializer::ElementDataResult foundElementData =
+            JsonDeserializer::FindElementByNameCrc(*m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(name));
+        m_context.PushPath(name);
+        if (foundElementData.m_found)
+        {
+            m_pendingObject = foundElementData.m_data;
+            m_pendingElement = foundElementData.m_info;
+            m_pendingValue = PendingValue::Load;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_context.PopPath();
+            m_pendingValue = PendingValue::Skip;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndObject(rapidjson::SizeType memberCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            return EndSkippedContainer();
+        }
+        if (m_captureDepth > 0)
+        {
+            rapidjson::Document::AllocatorType& allocator = m_capture.GetAllocator();
+            rapidjson::Value object(rapidjson::kObjectType);
+            rapidjson::SizeType first = m_capture.Size() - memberCount * 2;
+            for (rapidjson::SizeType i = first; i < m_capture.Size(); i += 2)
+            {
+                object.AddMember(m_capture[i], m_capture[i + 1], allocator);
+            }
+            m_capture.Erase(m_capture.Begin() + first, m_capture.End());
+            return EndCapturedContainer(object);
+        }
+        return EndClass();
+    }
+
+    bool JsonStreamingDeserializer::StartArray()
+    {
+        return BeginContainer(false);
+    }
+
+    bool JsonStreamingDeserializer::EndArray(rapidjson::SizeType elementCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            return EndSkippedContainer();
+        }
+
+        AZ_Assert(m_captureDepth > 0, "Json array ended that wasn't started.");
+        rapidjson::Document::AllocatorType& allocator = m_capture.GetAllocator();
+        rapidjson::Value array(rapidjson::kArrayType);
+        array.Reserve(elementCount, allocator);
+        rapidjson::SizeType first = m_capture.Size() - elementCount;
+        for (rapidjson::SizeType i = first; i < m_capture.Size(); ++i)
+        {
+            array.PushBack(m_capture[i], allocator);
+        }
+        m_capture.Erase(m_capture.Begin() + first, m_capture.End());
+        return EndCapturedContainer(array);
+    }
+
+    bool JsonStreamingDeserializer::IsSkippingValue() const
+    {
+        return m_skipDepth > 0 || (m_captureDepth == 0 && m_pendingValue == PendingValue::Skip);
+    }
+
+    bool JsonStreamingDeserializer::AddScalar(rapidjson::Value&& value)
+    {
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (m_captureDepth == 0)
+        {
+            AZ_Assert(m_pendingValue != PendingValue::None, "Json value found where a key was expected.");
+            if (m_pendingValue == PendingValue::Skip)
+            {
+                m_pendingValue = PendingValue::None;
+                return true;
+            }
+        }
+
+        m_capture.PushBack(value, m_capture.GetAllocator());
+        return m_captureDepth == 0 ? LoadCapturedValue() : true;
+    }
+
+    bool JsonStreamingDeserializer::BeginContainer(bool isObject)
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return true;
+        }
+        if (m_captureDepth > 0)
+        {
+            ++m_captureDepth;
+            return true;
+        }
+
+        AZ_Assert(m_pendingValue != PendingValue::None, "Json value found where a key was expected.");
+        if (m_pendingValue == PendingValue::Skip)
+        {
+            m_skipDepth = 1;
+            return true;
+        }
+
+        // Pointers are always captured as they may need to create an instance of a different type first.
+        bool isRoot = m_classStack.empty();
+        bool isPointer = !isRoot && (m_pendingElement->m_flags & SerializeContext::ClassElement::FLG_POINTER);
+        if (isObject && !isPointer)
+        {
+            const SerializeContext::ClassData* classData = FindStreamableClass(isRoot ? m_rootType : m_pendingElement->m_typeId);
+            if (classData)
+            {
+                m_classStack.emplace_back(m_pendingObject, *classData);
+                m_pendingValue = PendingValue::None;
+                return true;
+            }
+        }
+
+        m_captureDepth = 1;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndSkippedContainer()
+    {
+        if (--m_skipDepth == 0)
+        {
+            m_pendingValue = PendingValue::None;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndCapturedContainer(rapidjson::Value& value)
+    {
+        m_capture.PushBack(value, m_capture.GetAllocator());
+        return --m_captureDepth == 0 ? LoadCapturedValue() : true;
+    }
+
+    bool JsonStreamingDeserializer::LoadCapturedValue()
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(m_capture.Size() == 1, "Expected exactly one captured json value.");
+        m_pendingValue = PendingValue::None;
+
+        bool isRoot = m_classStack.empty();
+        ResultCode result = isRoot
+            ? JsonDeserializer::Load(m_pendingObject, m_rootType, m_capture[0], false, m_context)
+            : JsonDeserializer::LoadWithClassElement(m_pendingObject, m_capture[0], *m_pendingElement, m_context);
+
+        // Release the memory of the captured value, the memory pool allocator only frees when cleared.
+        m_capture.SetArray();
+        m_capture.GetAllocator().Clear();
+
+        if (isRoot)
+        {
+            m_result = result;
+            return true;
+        }
+        return CompleteMember(result);
+    }
+
+    bool JsonStreamingDeserializer::CompleteMember(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        ClassFrame& frame = m_classStack.back();
+        frame.m_result.Combine(result);
+
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            // Report the failure for every class that's still being loaded, as the recursive calls to
+            // JsonDeserializer::LoadClass would.
+            result = m_context.Report(result, "Loading of element has failed.");
+            m_context.PopPath();
+            m_classStack.pop_back();
+            while (!m_classStack.empty())
+            {
+                // The class that failed was itself a member of the next class on the stack.
+                result = m_context.Report(result, "Loading of element has failed.");
+                m_context.PopPath();
+                m_classStack.pop_back();
+            }
+            m_result = result;
+            return false;
+        }
+
+        if (result.GetProcessing() != Processing::Altered)
+        {
+            frame.m_numLoads++;
+        }
+        m_context.PopPath();
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndClass()
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(m_pendingValue == PendingValue::None && !m_classStack.empty(), "Json object ended outside of a class that's being loaded.");
+        ClassFrame& frame = m_classStack.back();
+
+        ResultCode result = frame.m_result;
+        if (frame.m_memberCount == 0)
+        {
+            result = m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+        }
+        else
+        {
+            size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+            if (elementCount > frame.m_numLoads)
+            {
+                result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+            }
+        }
+
+        m_classStack.pop_back();
+        if (m_classStack.empty())
+        {
+            m_result = result;
+            return true;
+        }
+        return CompleteMember(result);
+    }
+} // namespace AZ
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    class JsonDeserializerContext;
+
+    //! Loads an object from a json document while the document is being parsed, driven by the events of a rapidjson SAX reader.
+    //! Classes without a registered serializer are loaded member by member, so the document is never fully materialized. The
+    //! values of members that are handled by a BaseJsonSerializer or need additional processing such as pointers, enums and
+    //! containers are briefly built as a json value and handed to the regular JsonDeserializer, which guarantees both load
+    //! paths produce the same results.
+    class JsonStreamingDeserializer final
+    {
+        friend class JsonSerialization;
+
+    public:
+        // rapidjson Handler interface.
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const char* value, rapidjson::SizeType length, bool copy);
+        bool String(const char* value, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const char* value, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+    private:
+        //! A class that's loaded member by member from the events.
+        struct ClassFrame
+        {
+            ClassFrame(void* object, const SerializeContext::ClassData& classData);
+
+            void* m_object;
+            const SerializeContext::ClassData* m_classData;
+            JsonSerializationResult::ResultCode m_result;
+            size_t m_memberCount{ 0 };
+            size_t m_numLoads{ 0 };
+        };
+
+        //! What to do with the next value that starts.
+        enum class PendingValue : u8
+        {
+            Load,   //!< Load the value into m_pendingObject.
+            Skip,   //!< Ignore the value.
+            None    //!< No value is expected, only keys or the end of the current class.
+        };
+
+        JsonStreamingDeserializer(void* object, const Uuid& objectType, JsonDeserializerContext& context);
+        JsonStreamingDeserializer(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&& rhs) = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&& rhs) = delete;
+        ~JsonStreamingDeserializer() = default;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerContext& context);
+
+        //! Returns the class data if values of the type can be loaded member by member, which is the case for classes that
+        //! the JsonDeserializer would load with LoadClass.
+        const SerializeContext::ClassData* FindStreamableClass(const Uuid& typeId) const;
+
+        bool IsSkippingValue() const;
+        bool AddScalar(rapidjson::Value&& value);
+        //! Starts loading a class member by member if possible, otherwise starts capturing or skipping the object or array.
+        bool BeginContainer(bool isObject);
+        bool EndSkippedContainer();
+        bool EndCapturedContainer(rapidjson::Value& value);
+        //! Loads the fully captured value into the pending object.
+        bool LoadCapturedValue();
+        //! Combines the result of loading a member into the class that's currently being loaded.
+        bool CompleteMember(JsonSerializationResult::ResultCode result);
+        bool EndClass();
+
+        JsonDeserializerContext& m_context;
+        JsonSerializationResult::ResultCode m_result;
+
+        AZStd::vector<ClassFrame> m_classStack;
+
+        void* m_pendingObject;
+        const SerializeContext::ClassElement* m_pendingElement{ nullptr }; //!< Element being loaded, not used for the root.
+        Uuid m_rootType;
+        PendingValue m_pendingValue{ PendingValue::Load };
+
+        //! Values that need to be loaded by the JsonDeserializer are captured here. The document is used as a stack of values
+        //! that are combined into objects and arrays as they're completed.
+        rapidjson::Document m_capture;
+        size_t m_captureDepth{ 0 };
+        size_t m_skipDepth{ 0 };
+    };
+} // namespace AZ
@@ -118,6 +118,8 @@ namespace AZ
 
             // returns true if an element was found at the requested level
             bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
+            // finds the class data of an element read from the stream, replacing its type id with the specialized one for generic types
+            const SerializeContext::ClassData* FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
@@ -596,65 +598,81 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        const SerializeContext::ClassElement* childElement = nullptr;
+                        const SerializeContext::ClassData* childElementClassData = nullptr;
+                        if (const SerializeContext::ClassPlan* parentClassPlan = m_sc->GetClassPlan(parentClassInfo))
                         {
-                            const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
-                            if (childElement->m_nameCrc == element.m_nameCrc)
+                            if (const SerializeContext::ClassPlan::ElementPlan* elementPlan = parentClassPlan->FindElement(element.m_nameCrc))
                             {
-                                // if the member is a pointer type, then the pointer could be a derived type,
-                                // otherwise we need the uuids to be exactly the same.
-                                if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                                childElement = elementPlan->m_classElement;
+                                childElementClassData = elementPlan->m_classData;
+                            }
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                            {
+                                if (parentClassInfo->m_elements[i].m_nameCrc == element.m_nameCrc)
+                                {
+                                    childElement = &parentClassInfo->m_elements[i];
+                                    childElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (childElement)
+                        {
+                            // if the member is a pointer type, then the pointer could be a derived type,
+                            // otherwise we need the uuids to be exactly the same.
+                            if (childElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                            {
+                                bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
+                                bool isConvertableToClassElement = false;
+                                if(!isCastableToClassElement)
+                                {
+                                    isConvertableToClassElement = childElementClassData && childElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+                                if (isCastableToClassElement || isConvertableToClassElement)
                                 {
-                                    bool isCastableToClassElement = m_sc->CanDowncast(element.m_id, childElement->m_typeId, classData->m_azRtti, childElement->m_azRtti);
-                                    bool isConvertableToClassElement = false;
-                                    if(!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-                                    if (isCastableToClassElement || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    classElement = childElement;
                                 }
                                 else
                                 {
-                                    bool isCastableToClassElement = element.m_id == childElement->m_typeId;
-                                    bool isConvertableToClassElement = false;
-                                    if (!isCastableToClassElement)
-                                    {
-                                        const SerializeContext::ClassData* classElementClassData = m_sc->FindClassData(childElement->m_typeId, parentClassInfo, childElement->m_nameCrc);
-                                        isConvertableToClassElement = classElementClassData && classElementClassData->CanConvertFromType(element.m_id, *m_sc);
-                                    }
-
-                                    if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
-                                    {
-                                        classElement = childElement;
-                                    }
-                                    else
-                                    {
-                                        // Name matched but wrong type, this is an error when conversion function is not supplied.
-                                        AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
-                                            element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
-                                            element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
-                                            GetStreamFilename());
-
-                                        result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
-                                        m_errorLogger.ReportError(error.c_str());
-                                    }
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s and cannot be downcasted to type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
+                                }
+                            }
+                            else
+                            {
+                                bool isCastableToClassElement = element.m_id == childElement->m_typeId;
+                                bool isConvertableToClassElement = false;
+                                if (!isCastableToClassElement)
+                                {
+                                    isConvertableToClassElement = childElementClassData && childElementClassData->CanConvertFromType(element.m_id, *m_sc);
+                                }
+
+                                if (element.m_id == childElement->m_typeId || isConvertableToClassElement)
+                                {
+                                    classElement = childElement;
+                                }
+                                else
+                                {
+                                    // Name matched but wrong type, this is an error when conversion function is not supplied.
+                                    AZStd::string error = AZStd::string::format("Element '%s'(0x%x) in class '%s' is of type %s but needs to be type %s.  File %s",
+                                        element.m_name ? element.m_name : "NULL", element.m_nameCrc, parentClassInfo->m_name,
+                                        element.m_id.ToString<AZStd::string>().c_str(), childElement->m_typeId.ToString<AZStd::string>().c_str(),
+                                        GetStreamFilename());
+
+                                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                                    m_errorLogger.ReportError(error.c_str());
                                 }
-                                break;
                             }
                         }
 
@@ -1105,16 +1123,7 @@ namespace AZ
                 }
  
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -1233,15 +1242,7 @@ namespace AZ
                 }
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
                 {
@@ -1341,15 +1342,7 @@ namespace AZ
 
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -1413,6 +1406,34 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // FindElementClassData
+        //=========================================================================
+        const SerializeContext::ClassData* ObjectStreamImpl::FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent)
+        {
+            // Most elements hold the type they were reflected with, which the parent's class plan has already resolved
+            if (const SerializeContext::ClassPlan* parentClassPlan = sc.GetClassPlan(parent))
+            {
+                const SerializeContext::ClassPlan::ElementPlan* elementPlan = parentClassPlan->FindElement(element.m_nameCrc);
+                if (elementPlan && elementPlan->m_streamClassData && elementPlan->m_streamTypeId == element.m_id)
+                {
+                    element.m_id = elementPlan->m_loadedTypeId;
+                    return elementPlan->m_streamClassData;
+                }
+            }
+
+            const SerializeContext::ClassData* classData = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+            if (classData)
+            {
+                // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(classData->m_typeId))
+                {
+                    element.m_id = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+            return classData;
+        }
+
         //=========================================================================
         // SkipElement
         // [1/19/2013]
@@ -1561,7 +1582,10 @@ namespace AZ
             {
                 // Data overlays are only supported for non-root elements, which means we should have a valid class element.
                 DataOverlayInfo overlay;
-                EBUS_EVENT_ID_RESULT(overlay, DataOverlayInstanceId(objectPtr, classElement->m_typeId), DataOverlayInstanceBus, GetOverlayInfo);
+                if (DataOverlayInstanceBus::HasHandlers())
+                {
+                    EBUS_EVENT_ID_RESULT(overlay, DataOverlayInstanceId(objectPtr, classElement->m_typeId), DataOverlayInstanceBus, GetOverlayInfo);
+                }
                 if (overlay.m_providerId)
                 {
                     const SerializeContext::ClassData* overlayClassMetadata = m_sc->FindClassData(SerializeTypeInfo<DataOverlayInfo>::GetUuid());
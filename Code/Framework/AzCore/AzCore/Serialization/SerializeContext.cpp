@@ -523,6 +523,7 @@ namespace AZ
 
     auto SerializeContext::RegisterType(const AZ::TypeId& typeId, AZ::SerializeContext::ClassData&& classData, CreateAnyFunc createAnyFunc) -> ClassBuilder
     {
+        InvalidateClassPlans();
         auto [typeToClassIter, inserted] = m_uuidMap.try_emplace(typeId, AZStd::move(classData));
         m_classNameToUuid.emplace(AZ::Crc32(typeToClassIter->second.m_name), typeId);
         m_uuidAnyCreationMap.emplace(typeId, createAnyFunc);
@@ -532,6 +533,7 @@ namespace AZ
 
     bool SerializeContext::UnregisterType(const AZ::TypeId& typeId)
     {
+        InvalidateClassPlans();
         if (auto typeToClassIter = m_uuidMap.find(typeId); typeToClassIter != m_uuidMap.end())
         {
             ClassData& classData = typeToClassIter->second;
@@ -563,6 +565,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        InvalidateClassPlans();
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -700,6 +703,143 @@ namespace AZ
         return nullptr;
     }
 
+    //=========================================================================
+    // GetClassPlan
+    //=========================================================================
+    const SerializeContext::ClassPlan* SerializeContext::GetClassPlan(const ClassData* classData) const
+    {
+        if (!classData || classData->m_container || classData->m_serializer)
+        {
+            return nullptr;
+        }
+
+        const ClassPlan* plan = classData->m_plan.Get();
+        if (plan && plan->m_generation == m_classPlanGeneration && plan->m_context == this)
+        {
+            return plan;
+        }
+
+        // Only compile plans for class data registered in this context, class data of generic types can be
+        // shared by several contexts and would be resolved against the wrong one.
+        auto classIt = m_uuidMap.find(classData->m_typeId);
+        if (classIt == m_uuidMap.end() || &classIt->second != classData)
+        {
+            return nullptr;
+        }
+
+        ClassPlan* compiledPlan = CompileClassPlan(classData);
+        const ClassPlan* publishedPlan = classData->m_plan.Publish(compiledPlan, plan);
+        if (publishedPlan == compiledPlan && plan)
+        {
+            // The replaced plan can't be freed yet as other threads may still be reading it
+            AZStd::lock_guard<AZStd::mutex> lock(m_retiredClassPlansMutex);
+            m_retiredClassPlans.emplace_back(const_cast<ClassPlan*>(plan));
+        }
+        return publishedPlan;
+    }
+
+    size_t SerializeContext::GetNumRetiredClassPlans() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_retiredClassPlansMutex);
+        return m_retiredClassPlans.size();
+    }
+
+    void SerializeContext::InvalidateClassPlans()
+    {
+        ++m_classPlanGeneration;
+
+        // Reflection doesn't change while the context is used for serialization, so this is a safe point to free
+        // the replaced plans as no thread can still be reading them.
+        AZStd::lock_guard<AZStd::mutex> lock(m_retiredClassPlansMutex);
+        m_retiredClassPlans.clear();
+    }
+
+    SerializeContext::ClassPlan* SerializeContext::CompileClassPlan(const ClassData* classData) const
+    {
+        ClassPlan* plan = aznew ClassPlan;
+        plan->m_context = this;
+        plan->m_generation = m_classPlanGeneration;
+        plan->m_elementNameCrcs.reserve(classData->m_elements.size());
+        plan->m_elements.reserve(classData->m_elements.size());
+
+        for (const ClassElement& classElement : classData->m_elements)
+        {
+            ClassPlan::ElementPlan& elementPlan = plan->m_elements.emplace_back();
+            elementPlan.m_classElement = &classElement;
+            elementPlan.m_classData = classElement.m_genericClassInfo
+                ? classElement.m_genericClassInfo->GetClassData()
+                : FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+            plan->m_elementNameCrcs.push_back(classElement.m_nameCrc);
+
+            if (elementPlan.m_classData)
+            {
+                // Resolve the type id that is written for the element the way the reader resolves it, so that reading
+                // an element of that type can use the result directly
+                elementPlan.m_streamTypeId = elementPlan.m_classData->m_typeId;
+                elementPlan.m_streamClassData = FindClassData(elementPlan.m_streamTypeId, classData, classElement.m_nameCrc);
+                elementPlan.m_loadedTypeId = elementPlan.m_streamTypeId;
+                if (elementPlan.m_streamClassData)
+                {
+                    if (GenericClassInfo* genericClassInfo = FindGenericClassInfo(elementPlan.m_streamClassData->m_typeId))
+                    {
+                        elementPlan.m_loadedTypeId = genericClassInfo->GetSpecializedTypeId();
+                    }
+                }
+            }
+        }
+
+        return plan;
+    }
+
+    //=========================================================================
+    // ClassPlan
+    //=========================================================================
+    const SerializeContext::ClassPlan::ElementPlan* SerializeContext::ClassPlan::FindElement(u32 nameCrc) const
+    {
+        for (size_t i = 0; i < m_elementNameCrcs.size(); ++i)
+        {
+            if (m_elementNameCrcs[i] == nameCrc)
+            {
+                return &m_elements[i];
+            }
+        }
+        return nullptr;
+    }
+
+    //=========================================================================
+    // ClassPlanHolder
+    //=========================================================================
+    SerializeContext::ClassPlanHolder::ClassPlanHolder(ClassPlanHolder&& other)
+        : m_plan(other.m_plan.exchange(nullptr))
+    {
+    }
+
+    SerializeContext::ClassPlanHolder& SerializeContext::ClassPlanHolder::operator=(ClassPlanHolder&& other)
+    {
+        if (this != &other)
+        {
+            delete m_plan.exchange(other.m_plan.exchange(nullptr));
+        }
+        return *this;
+    }
+
+    SerializeContext::ClassPlanHolder::~ClassPlanHolder()
+    {
+        delete m_plan.load();
+    }
+
+    const SerializeContext::ClassPlan* SerializeContext::ClassPlanHolder::Publish(ClassPlan* plan, const ClassPlan* expected) const
+    {
+        ClassPlan* current = const_cast<ClassPlan*>(expected);
+        if (m_plan.compare_exchange_strong(current, plan, AZStd::memory_order_acq_rel))
+        {
+            return plan;
+        }
+
+        delete plan;
+        return current;
+    }
+
     const TypeId& SerializeContext::GetUnderlyingTypeId(const TypeId& enumTypeId) const
     {
         auto enumToUnderlyingTypeIdIter = m_enumTypeIdToUnderlyingTypeIdMap.find(enumTypeId);
@@ -713,6 +853,7 @@ namespace AZ
             return;
         }
 
+        InvalidateClassPlans();
         if (IsRemovingReflection())
         {
             RemoveGenericClassInfo(genericClassInfo);
@@ -1909,13 +2050,15 @@ namespace AZ
             }
             else
             {
+                const ClassPlan* classPlan = GetClassPlan(dataClassInfo);
                 for (size_t i = 0, n = dataClassInfo->m_elements.size(); i < n; ++i)
                 {
                     const SerializeContext::ClassElement& ed = dataClassInfo->m_elements[i];
                     void* dataAddress = (char*)(objectPtr) + ed.m_offset;
                     if (dataAddress)
                     {
-                        const SerializeContext::ClassData* elemClassInfo = ed.m_genericClassInfo ? ed.m_genericClassInfo->GetClassData() : FindClassData(ed.m_typeId, dataClassInfo, ed.m_nameCrc);
+                        const SerializeContext::ClassData* elemClassInfo = classPlan ? classPlan->m_elements[i].m_classData
+                            : ed.m_genericClassInfo ? ed.m_genericClassInfo->GetClassData() : FindClassData(ed.m_typeId, dataClassInfo, ed.m_nameCrc);
 
                         keepEnumeratingSiblings = EnumerateInstance(callContext, dataAddress, ed.m_typeId, elemClassInfo, &ed);
                         if (!keepEnumeratingSiblings)
@@ -2802,6 +2945,7 @@ namespace AZ
 
     void SerializeContext::RemoveGenericClassInfo(GenericClassInfo* genericClassInfo)
     {
+        InvalidateClassPlans();
         const Uuid& classId = genericClassInfo->GetSpecializedTypeId();
         RemoveClassData(genericClassInfo->GetClassData());
         // Find the module GenericClassInfo in the SerializeContext GenericClassInfo multimap and remove it from there
@@ -14,6 +14,7 @@
 
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/flat_unordered_map.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/map.h>
@@ -28,6 +29,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -576,6 +578,31 @@ namespace AZ
         };
         typedef AZStd::vector<ClassElement> ClassElementArray;
 
+        struct ClassPlan;
+
+        /**
+         * Owns the ClassPlan compiled for a ClassData. Plans are compiled lazily by whichever thread serializes
+         * the class first, so the pointer is published atomically and a plan is never freed while its class data lives.
+         */
+        class ClassPlanHolder
+        {
+        public:
+            ClassPlanHolder() = default;
+            ClassPlanHolder(ClassPlanHolder&& other);
+            ClassPlanHolder& operator=(ClassPlanHolder&& other);
+            ~ClassPlanHolder();
+
+            const ClassPlan* Get() const { return m_plan.load(AZStd::memory_order_acquire); }
+
+            /// Replaces the expected plan with the new one, taking ownership of it. If another thread published a plan
+            /// first, the new plan is deleted and the published one is returned instead. If the new plan was published
+            /// the caller takes ownership of the replaced plan.
+            const ClassPlan* Publish(ClassPlan* plan, const ClassPlan* expected) const;
+
+        private:
+            mutable AZStd::atomic<ClassPlan*> m_plan{ nullptr };
+        };
+
         /**
          * Class Data contains the data/info for each registered class
          * all if it members (their offsets, etc.), creator, version converts, etc.
@@ -634,6 +661,8 @@ namespace AZ
             /// which while it inherits from IAllocatorAllocate, does not work as function pointers do not support covariant return types
             AZStd::vector<AttributeSharedPair, AZStdFunctorAllocator> m_attributes{AZStdFunctorAllocator(&GetSystemAllocator) };
 
+            ClassPlanHolder     m_plan;             ///< Compiled serialization plan, see SerializeContext::GetClassPlan.
+
         private:
             static IAllocatorAllocate& GetSystemAllocator()
             {
@@ -641,6 +670,33 @@ namespace AZ
             }
         };
 
+        /**
+         * Flattened serialization metadata of a class with reflected elements, compiled on first use by GetClassPlan.
+         * It resolves what serializers would otherwise look up for every element of every instance: the class data
+         * of each element type and the type id ObjectStream writes for it.
+         */
+        struct ClassPlan
+        {
+            AZ_CLASS_ALLOCATOR(ClassPlan, SystemAllocator, 0);
+
+            struct ElementPlan
+            {
+                const ClassElement* m_classElement = nullptr;
+                const ClassData*    m_classData = nullptr;          ///< Class data of the element type, as FindClassData(type, parent, nameCrc) resolves it.
+                Uuid                m_streamTypeId;                 ///< Type id written to streams for the element when it holds its declared type.
+                const ClassData*    m_streamClassData = nullptr;    ///< Class data the reader resolves for m_streamTypeId, nullptr if it can't be resolved ahead of time.
+                Uuid                m_loadedTypeId;                 ///< Type id the reader stores in the data element for m_streamTypeId.
+            };
+
+            /// Returns the element with the name crc, nullptr if the class has no such element.
+            const ElementPlan* FindElement(u32 nameCrc) const;
+
+            const SerializeContext*     m_context = nullptr;
+            size_t                      m_generation = 0;           ///< SerializeContext reflection generation the plan was compiled for.
+            AZStd::vector<u32>          m_elementNameCrcs;          ///< Name crcs of m_elements, kept in a compact array for lookups by name.
+            AZStd::vector<ElementPlan>  m_elements;                 ///< One entry per ClassData::m_elements entry, in the same order.
+        };
+
         /**
          * Interface for creating and destroying object from the serializer.
          */
@@ -1055,6 +1111,14 @@ namespace AZ
         /// Find GenericClassData data based on the supplied class ID
         GenericClassInfo* FindGenericClassInfo(const Uuid& classId) const; 
 
+        /// Returns the serialization plan of a class with reflected elements, compiling it on first use. The plan stays
+        /// valid until reflection changes. Returns nullptr for containers, classes with a custom serializer and class data
+        /// that isn't owned by this context, in which case callers use the ClassData directly.
+        const ClassPlan* GetClassPlan(const ClassData* classData) const;
+
+        /// Returns the number of replaced ClassPlans that are waiting to be freed on the next reflection change.
+        size_t GetNumRetiredClassPlans() const;
+
         /// Creates an AZStd::any based on the provided class Uuid, or returns an empty AZStd::any if no class data is found or the class is virtual
         AZStd::any CreateAny(const Uuid& classId);
 
@@ -1332,9 +1396,16 @@ namespace AZ
         AZStd::unordered_multimap<AZ::Crc32, AZ::Uuid> m_classNameToUuid;  /// Map all class names to their uuid
         AZStd::unordered_multimap<Uuid, GenericClassInfo*>  m_uuidGenericMap;      ///< Uuid to ClassData map of reflected classes with GenericTypeInfo
         AZStd::unordered_multimap<Uuid, Uuid> m_legacySpecializeTypeIdToTypeIdMap; ///< Keep a map of old legacy specialized typeids of template classes to new specialized typeids
-        AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
-        AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
+        AZStd::flat_unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
+        AZStd::flat_unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        size_t m_classPlanGeneration = 0; ///< Incremented whenever reflection changes, so compiled ClassPlans are recompiled
+        mutable AZStd::mutex m_retiredClassPlansMutex;
+        mutable AZStd::vector<AZStd::unique_ptr<ClassPlan>> m_retiredClassPlans; ///< Plans replaced by a recompiled plan, other threads may still hold them.
+
+        ClassPlan* CompileClassPlan(const ClassData* classData) const;
+        /// Called whenever reflection changes. Outdates all compiled ClassPlans and frees the ones that were replaced.
+        void InvalidateClassPlans();
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
@@ -1886,6 +1957,7 @@ namespace AZ
 
         const Uuid& typeUuid = AzTypeInfo<T>::Uuid();
         const char* name = AzTypeInfo<T>::Name();
+        InvalidateClassPlans();
 
         if (IsRemovingReflection())
         {
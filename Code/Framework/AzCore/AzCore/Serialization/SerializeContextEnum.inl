@@ -143,6 +143,7 @@ namespace AZ
         AZ_Assert(!enumTypeId.IsNull(), "Enum Type has invalid AZ::TypeId. Has it been specialized with AZ_TYPE_INFO_INTERNAL_SPECIALIZE macro?");
         AZ_Assert(!underlyingTypeId.IsNull(), "Underlying Type of enum has invalid AZ::TypeId. Has it been specialized with AZ_TYPE_INFO_INTERNAL_SPECIALIZE macro?");
 
+        InvalidateClassPlans();
         auto enumTypeIter = m_uuidMap.find(enumTypeId);
         if (IsRemovingReflection())
         {
@@ -146,10 +146,13 @@ set(FILES
     EBus/ScheduledEvent.h
     EBus/ScheduledEventHandle.cpp
     EBus/ScheduledEventHandle.h
+    EBus/ScheduledEventTimingWheel.cpp
+    EBus/ScheduledEventTimingWheel.h
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/HandlerSnapshot.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
@@ -183,8 +186,12 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/BlockDecompressor.h
+    IO/Streamer/BlockDecompressor.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
+    IO/Streamer/DiskCache.h
+    IO/Streamer/DiskCache.cpp
     IO/Streamer/FileRange.h
     IO/Streamer/FileRange.cpp
     IO/Streamer/FileRequest.h
@@ -215,11 +222,15 @@ set(FILES
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
+    Jobs/CpuTopology.cpp
+    Jobs/CpuTopology.h
     Jobs/Internal/JobManagerBase.cpp
     Jobs/Internal/JobManagerBase.h
     Jobs/Internal/JobManagerWorkStealing.cpp
     Jobs/Internal/JobManagerWorkStealing.h
     Jobs/Internal/JobNotify.h
+    Jobs/Internal/JobTrace.h
+    Jobs/Internal/WorkStealingDeque.h
     Jobs/Job.h
     Jobs/JobCancelGroup.h
     Jobs/JobCompletion.h
@@ -240,6 +251,8 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/Aabbx8.h
+    Math/Aabbx8.inl
     Math/Color.cpp
     Math/Color.h
     Math/Color.inl
@@ -249,6 +262,8 @@ set(FILES
     Math/Crc.inl
     Math/Crc.h
     Math/DocsMath.h
+    Math/FastHash.cpp
+    Math/FastHash.h
     Math/Frustum.cpp
     Math/Frustum.h
     Math/Frustum.inl
@@ -268,6 +283,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_simd.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -315,6 +332,7 @@ set(FILES
     Math/Random.h
     Math/Sfmt.cpp
     Math/Sfmt.h
+    Math/ShapeIntersection.cpp
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
     Math/SimdMath.h
@@ -322,6 +340,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -342,6 +361,8 @@ set(FILES
     Math/Vector3.cpp
     Math/Vector3.h
     Math/Vector3.inl
+    Math/Vector3x8.h
+    Math/Vector3x8.inl
     Math/Vector4.cpp
     Math/Vector4.h
     Math/Vector4.inl
@@ -358,6 +379,8 @@ set(FILES
     Math/ToString.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorManager.cpp
@@ -372,6 +395,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -396,6 +421,8 @@ set(FILES
     Memory/PoolAllocator.h
     Memory/PoolSchema.cpp
     Memory/PoolSchema.h
+    Memory/ReservedAddressSpaceSchema.cpp
+    Memory/ReservedAddressSpaceSchema.h
     Memory/SimpleSchemaAllocator.h
     Memory/SystemAllocator.cpp
     Memory/SystemAllocator.h
@@ -523,6 +550,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
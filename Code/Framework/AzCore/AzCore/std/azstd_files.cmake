@@ -19,6 +19,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -50,6 +51,8 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_unordered_map.h
+    containers/flat_unordered_set.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -163,6 +166,7 @@ set(FILES
     typetraits/is_compound.h
     typetraits/is_constructible.h
     typetraits/is_const.h
+    typetraits/is_constant_evaluated.h
     typetraits/is_convertible.h
     typetraits/is_destructible.h
     typetraits/is_empty.h
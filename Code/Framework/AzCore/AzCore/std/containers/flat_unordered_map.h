@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template <class Key, class MappedType, class Hasher, class KeyEqual, class Allocator>
+        struct FlatUnorderedMapTableTraits
+        {
+            using key_type = Key;
+            using key_equal = KeyEqual;
+            using hasher = Hasher;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Unordered map with open addressing, see \ref flat_hash_table.
+     * It has the interface of unordered_map without the bucket and node handle functions. The elements live in
+     * the table itself, so inserting may move them: don't keep pointers or references to elements across inserts.
+     * Prefer it to unordered_map for lookup heavy maps of small keys and values.
+     */
+    template <class Key, class MappedType, class Hasher = AZStd::hash<Key>, class KeyEqual = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_unordered_map
+        : public flat_hash_table<Internal::FlatUnorderedMapTableTraits<Key, MappedType, Hasher, KeyEqual, Allocator>>
+    {
+        using this_type = flat_unordered_map<Key, MappedType, Hasher, KeyEqual, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatUnorderedMapTableTraits<Key, MappedType, Hasher, KeyEqual, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using mapped_type = MappedType;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_unordered_map()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_unordered_map(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator) {}
+        explicit flat_unordered_map(size_type numBucketsHint, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        template <class InputIterator>
+        flat_unordered_map(InputIterator first, InputIterator last, size_type numBucketsHint = 0, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_unordered_map(AZStd::initializer_list<value_type> list, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(list.size());
+            base_type::insert(list.begin(), list.end());
+        }
+        flat_unordered_map(const flat_unordered_map& rhs) = default;
+        flat_unordered_map(flat_unordered_map&& rhs) = default;
+
+        flat_unordered_map& operator=(const flat_unordered_map& rhs) = default;
+        flat_unordered_map& operator=(flat_unordered_map&& rhs) = default;
+        flat_unordered_map& operator=(AZStd::initializer_list<value_type> list)
+        {
+            base_type::clear();
+            base_type::insert(list.begin(), list.end());
+            return *this;
+        }
+
+        using base_type::insert;
+
+        //! Inserts value converted to value_type, like inserting AZStd::make_pair(key, value).
+        template <class P, class = AZStd::enable_if_t<AZStd::is_constructible_v<value_type, P&&>>>
+        pair_iter_bool insert(P&& value)
+        {
+            return base_type::emplace(AZStd::forward<P>(value));
+        }
+
+        //! Constructs the mapped value from arguments only if key isn't in the map yet.
+        template <class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return base_type::emplace_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template <class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return base_type::emplace_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template <class... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return try_emplace(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template <class... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+        //! Assigns value to the element of key, inserting it if needed.
+        template <class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template <class M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator it = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(it != base_type::end(), "flat_unordered_map::at - key is not in the map");
+            return it->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator it = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(it != base_type::end(), "flat_unordered_map::at - key is not in the map");
+            return it->second;
+        }
+    };
+
+    template <class Key, class MappedType, class Hasher, class KeyEqual, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_unordered_map<Key, MappedType, Hasher, KeyEqual, Allocator>& lhs, flat_unordered_map<Key, MappedType, Hasher, KeyEqual, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template <class Key, class MappedType, class Hasher, class KeyEqual, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_unordered_map<Key, MappedType, Hasher, KeyEqual, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
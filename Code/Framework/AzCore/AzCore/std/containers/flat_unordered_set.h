@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template <class Key, class Hasher, class KeyEqual, class Allocator>
+        struct FlatUnorderedSetTableTraits
+        {
+            using key_type = Key;
+            using key_equal = KeyEqual;
+            using hasher = Hasher;
+            using value_type = Key;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Unordered set with open addressing, see \ref flat_hash_table.
+     * It has the interface of unordered_set without the bucket and node handle functions. The elements live in
+     * the table itself, so inserting may move them: don't keep pointers or references to elements across inserts.
+     */
+    template <class Key, class Hasher = AZStd::hash<Key>, class KeyEqual = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_unordered_set
+        : public flat_hash_table<Internal::FlatUnorderedSetTableTraits<Key, Hasher, KeyEqual, Allocator>>
+    {
+        using this_type = flat_unordered_set<Key, Hasher, KeyEqual, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatUnorderedSetTableTraits<Key, Hasher, KeyEqual, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using value_type = typename base_type::value_type;
+        using hasher = typename base_type::hasher;
+        using key_equal = typename base_type::key_equal;
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_unordered_set()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_unordered_set(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator) {}
+        explicit flat_unordered_set(size_type numBucketsHint, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        template <class InputIterator>
+        flat_unordered_set(InputIterator first, InputIterator last, size_type numBucketsHint = 0, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_unordered_set(AZStd::initializer_list<value_type> list, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(list.size());
+            base_type::insert(list.begin(), list.end());
+        }
+        flat_unordered_set(const flat_unordered_set& rhs) = default;
+        flat_unordered_set(flat_unordered_set&& rhs) = default;
+
+        flat_unordered_set& operator=(const flat_unordered_set& rhs) = default;
+        flat_unordered_set& operator=(flat_unordered_set&& rhs) = default;
+        flat_unordered_set& operator=(AZStd::initializer_list<value_type> list)
+        {
+            base_type::clear();
+            base_type::insert(list.begin(), list.end());
+            return *this;
+        }
+    };
+
+    template <class Key, class Hasher, class KeyEqual, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_unordered_set<Key, Hasher, KeyEqual, Allocator>& lhs, flat_unordered_set<Key, Hasher, KeyEqual, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    template <class Key, class Hasher, class KeyEqual, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_unordered_set<Key, Hasher, KeyEqual, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
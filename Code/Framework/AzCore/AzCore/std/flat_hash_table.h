@@ -0,0 +1,995 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Internal/MathTypes.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    template <class Traits>
+    class flat_hash_table;
+
+    namespace Internal
+    {
+        namespace FlatHash
+        {
+            //! Control byte of a slot: the 7 low bits of the hash (H2) when the slot is full,
+            //! one of the negative markers below otherwise.
+            using ctrl_t = int8_t;
+            enum : ctrl_t
+            {
+                CtrlEmpty = -128,
+                CtrlDeleted = -2
+            };
+
+            //! Number of control bytes probed at once.
+            static constexpr size_t GroupWidth = 16;
+            //! Smallest allocated capacity, smaller tables are covered by a single group through the cloned control bytes.
+            static constexpr size_t MinCapacity = 8;
+
+            inline bool IsFull(ctrl_t ctrl)
+            {
+                return ctrl >= 0;
+            }
+
+            //! Mixes the user hash, AZStd::hash is the identity for integers and pointers which would put
+            //! the same bits in H2 for every aligned pointer.
+            inline size_t Mix(size_t hash)
+            {
+                const uint64_t product = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+                return static_cast<size_t>(product ^ (product >> 32));
+            }
+
+            //! Selects the first group probed.
+            inline size_t H1(size_t hash)
+            {
+                return hash >> 7;
+            }
+
+            //! Stored in the control byte, filters out most slots before comparing keys.
+            inline ctrl_t H2(size_t hash)
+            {
+                return static_cast<ctrl_t>(hash & 0x7F);
+            }
+
+            //! Set of matching lanes of a group, each lane uses 1 << Shift bits of the mask.
+            template <uint32_t Shift>
+            class BitMask
+            {
+            public:
+                explicit BitMask(uint64_t mask)
+                    : m_mask(mask)
+                {
+                }
+
+                explicit operator bool() const
+                {
+                    return m_mask != 0;
+                }
+
+                //! Index of the first matching lane, the mask must not be empty.
+                uint32_t LowestLane() const
+                {
+                    return static_cast<uint32_t>(az_ctz_u64(m_mask)) >> Shift;
+                }
+
+                void ClearLowestLane()
+                {
+                    m_mask &= m_mask - 1;
+                }
+
+                //! Number of lanes before the first matching one, the mask must not be empty.
+                uint32_t TrailingZeros() const
+                {
+                    return LowestLane();
+                }
+
+                //! Number of lanes after the last matching one, the mask must not be empty.
+                uint32_t LeadingZeros() const
+                {
+                    constexpr uint32_t UnusedBits = 64 - static_cast<uint32_t>(GroupWidth << Shift);
+                    return (static_cast<uint32_t>(az_clz_u64(m_mask)) - UnusedBits) >> Shift;
+                }
+
+            private:
+                uint64_t m_mask;
+            };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            //! Compares the 16 control bytes of a group at once with SSE2.
+            class Group
+            {
+            public:
+                using Mask = BitMask<0>;
+
+                explicit Group(const ctrl_t* ctrl)
+                    : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+                {
+                }
+
+                Mask Match(ctrl_t h2) const
+                {
+                    return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+                }
+
+                Mask MatchEmpty() const
+                {
+                    return Match(CtrlEmpty);
+                }
+
+                //! Empty and deleted are the only control bytes with the sign bit set
+                Mask MatchEmptyOrDeleted() const
+                {
+                    return Mask(static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl)));
+                }
+
+            private:
+                __m128i m_ctrl;
+            };
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            //! Compares the 16 control bytes of a group at once with NEON, lanes are narrowed to 4 bits of the mask.
+            class Group
+            {
+            public:
+                using Mask = BitMask<2>;
+
+                explicit Group(const ctrl_t* ctrl)
+                    : m_ctrl(vld1q_s8(ctrl))
+                {
+                }
+
+                Mask Match(ctrl_t h2) const
+                {
+                    return ToMask(vceqq_s8(vdupq_n_s8(h2), m_ctrl));
+                }
+
+                Mask MatchEmpty() const
+                {
+                    return Match(CtrlEmpty);
+                }
+
+                Mask MatchEmptyOrDeleted() const
+                {
+                    return ToMask(vcltq_s8(m_ctrl, vdupq_n_s8(0)));
+                }
+
+            private:
+                static Mask ToMask(uint8x16_t lanes)
+                {
+                    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4);
+                    return Mask(vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ull);
+                }
+
+                int8x16_t m_ctrl;
+            };
+#else
+            //! Portable group, compares the control bytes one at a time.
+            class Group
+            {
+            public:
+                using Mask = BitMask<0>;
+
+                explicit Group(const ctrl_t* ctrl)
+                    : m_ctrl(ctrl)
+                {
+                }
+
+                Mask Match(ctrl_t h2) const
+                {
+                    uint64_t mask = 0;
+                    for (size_t i = 0; i < GroupWidth; ++i)
+                    {
+                        mask |= static_cast<uint64_t>(m_ctrl[i] == h2) << i;
+                    }
+                    return Mask(mask);
+                }
+
+                Mask MatchEmpty() const
+                {
+                    return Match(CtrlEmpty);
+                }
+
+                Mask MatchEmptyOrDeleted() const
+                {
+                    uint64_t mask = 0;
+                    for (size_t i = 0; i < GroupWidth; ++i)
+                    {
+                        mask |= static_cast<uint64_t>(m_ctrl[i] < 0) << i;
+                    }
+                    return Mask(mask);
+                }
+
+            private:
+                const ctrl_t* m_ctrl;
+            };
+#endif
+
+            //! Triangular probing over groups, visits every group of a power of two capacity once.
+            class ProbeSequence
+            {
+            public:
+                ProbeSequence(size_t hash, size_t mask)
+                    : m_mask(mask)
+                    , m_offset(H1(hash) & mask)
+                {
+                }
+
+                size_t GetOffset() const
+                {
+                    return m_offset;
+                }
+
+                size_t GetOffset(uint32_t lane) const
+                {
+                    return (m_offset + lane) & m_mask;
+                }
+
+                void Next()
+                {
+                    m_index += GroupWidth;
+                    m_offset = (m_offset + m_index) & m_mask;
+                }
+
+            private:
+                size_t m_mask;
+                size_t m_offset;
+                size_t m_index = 0;
+            };
+
+            //! Control bytes of tables without storage, lookups find no match and stop at the first group.
+            inline ctrl_t* EmptyGroup()
+            {
+                alignas(GroupWidth) static ctrl_t s_emptyGroup[GroupWidth] = {
+                    CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty,
+                    CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty
+                };
+                return s_emptyGroup;
+            }
+
+            //! Number of elements a capacity holds before growing, 7/8 of the slots.
+            inline size_t CapacityToGrowth(size_t capacity)
+            {
+                return capacity - capacity / 8;
+            }
+
+            //! Smallest capacity holding count elements.
+            inline size_t CapacityForCount(size_t count)
+            {
+                size_t capacity = MinCapacity;
+                while (CapacityToGrowth(capacity) < count)
+                {
+                    capacity *= 2;
+                }
+                return capacity;
+            }
+        } // namespace FlatHash
+
+        template <class ValueType, bool IsConst>
+        class flat_hash_iterator
+        {
+            template <class Traits>
+            friend class AZStd::flat_hash_table;
+            template <class, bool>
+            friend class flat_hash_iterator;
+
+        public:
+            using iterator_category = AZStd::forward_iterator_tag;
+            using value_type = ValueType;
+            using difference_type = AZStd::ptrdiff_t;
+            using pointer = AZStd::conditional_t<IsConst, const ValueType*, ValueType*>;
+            using reference = AZStd::conditional_t<IsConst, const ValueType&, ValueType&>;
+
+            flat_hash_iterator() = default;
+
+            //! Conversion from iterator to const_iterator.
+            template <bool OtherIsConst, class = AZStd::enable_if_t<IsConst && !OtherIsConst>>
+            flat_hash_iterator(const flat_hash_iterator<ValueType, OtherIsConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_ctrlEnd(rhs.m_ctrlEnd)
+                , m_slot(rhs.m_slot)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *m_slot;
+            }
+
+            pointer operator->() const
+            {
+                return m_slot;
+            }
+
+            flat_hash_iterator& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                SkipEmptyOrDeleted();
+                return *this;
+            }
+
+            flat_hash_iterator operator++(int)
+            {
+                flat_hash_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            template <bool OtherIsConst>
+            bool operator==(const flat_hash_iterator<ValueType, OtherIsConst>& rhs) const
+            {
+                return m_slot == rhs.m_slot;
+            }
+
+            template <bool OtherIsConst>
+            bool operator!=(const flat_hash_iterator<ValueType, OtherIsConst>& rhs) const
+            {
+                return m_slot != rhs.m_slot;
+            }
+
+        private:
+            flat_hash_iterator(const FlatHash::ctrl_t* ctrl, const FlatHash::ctrl_t* ctrlEnd, pointer slot)
+                : m_ctrl(ctrl)
+                , m_ctrlEnd(ctrlEnd)
+                , m_slot(slot)
+            {
+            }
+
+            void SkipEmptyOrDeleted()
+            {
+                while (m_ctrl != m_ctrlEnd && !FlatHash::IsFull(*m_ctrl))
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const FlatHash::ctrl_t* m_ctrl = nullptr;
+            const FlatHash::ctrl_t* m_ctrlEnd = nullptr;
+            pointer m_slot = nullptr;
+        };
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table storing the elements inline in a single allocation (Swiss table).
+     * Every slot has a control byte holding 7 bits of the element hash, lookups compare a group
+     * of 16 control bytes at once with SIMD and only compare the keys of the matching slots.
+     * Unlike hash_table, inserting and rehashing move the elements: inserts invalidate all iterators,
+     * pointers and references when they grow the table. Erasing only invalidates the erased element.
+     *
+     * Traits must provide key_type, value_type, hasher, key_equal, allocator_type and key_from_value(value).
+     * The allocator is an AZStd allocator, the table is a single block of allocate(byteSize, alignment).
+     */
+    template <class Traits>
+    class flat_hash_table
+    {
+        using this_type = flat_hash_table<Traits>;
+        using ctrl_t = Internal::FlatHash::ctrl_t;
+
+    public:
+        using traits_type = Traits;
+        using key_type = typename Traits::key_type;
+        using value_type = typename Traits::value_type;
+        using hasher = typename Traits::hasher;
+        using key_equal = typename Traits::key_equal;
+        using allocator_type = typename Traits::allocator_type;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using iterator = Internal::flat_hash_iterator<value_type, false>;
+        using const_iterator = Internal::flat_hash_iterator<value_type, true>;
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+        flat_hash_table(const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(rhs.m_allocator)
+        {
+            copy_from(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(rhs.m_allocator)
+        {
+            steal(rhs);
+        }
+
+        ~flat_hash_table()
+        {
+            destroy_elements();
+            deallocate_storage();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                copy_from(rhs);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                destroy_elements();
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                if (m_allocator == rhs.m_allocator)
+                {
+                    deallocate_storage();
+                    steal(rhs);
+                }
+                else
+                {
+                    // The storage can't change allocators, move the elements one by one
+                    reset_ctrl();
+                    reserve(rhs.m_size);
+                    for (value_type& value : rhs)
+                    {
+                        insert_unique_no_check(AZStd::move(value));
+                    }
+                    rhs.clear();
+                }
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+            it.SkipEmptyOrDeleted();
+            return it;
+        }
+        const_iterator begin() const
+        {
+            const_iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+            it.SkipEmptyOrDeleted();
+            return it;
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+        iterator end()
+        {
+            return iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity);
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+        size_type size() const
+        {
+            return m_size;
+        }
+        size_type max_size() const
+        {
+            return AZStd::numeric_limits<difference_type>::max() / sizeof(value_type);
+        }
+        //! Number of slots, the table grows once size() reaches 7/8 of it.
+        size_type capacity() const
+        {
+            return m_capacity;
+        }
+        size_type bucket_count() const
+        {
+            return m_capacity;
+        }
+        float load_factor() const
+        {
+            return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+        float max_load_factor() const
+        {
+            return 7.0f / 8.0f;
+        }
+
+        hasher hash_function() const
+        {
+            return m_hasher;
+        }
+        key_equal key_eq() const
+        {
+            return m_keyEqual;
+        }
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_allocator;
+        }
+
+        //! Destroys all the elements, the storage is kept for reuse.
+        void clear()
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            destroy_elements();
+            reset_ctrl();
+        }
+
+        //! Makes room for count elements without growing.
+        void reserve(size_type count)
+        {
+            if (count > m_size + m_growthLeft)
+            {
+                resize(Internal::FlatHash::CapacityForCount(count));
+            }
+        }
+
+        //! Sets the capacity to at least numBuckets slots and enough for the current elements.
+        //! rehash(0) on an empty table releases its storage.
+        void rehash(size_type numBuckets)
+        {
+            if (numBuckets == 0 && m_size == 0)
+            {
+                deallocate_storage();
+                return;
+            }
+
+            size_type capacity = Internal::FlatHash::CapacityForCount(m_size);
+            while (capacity < numBuckets)
+            {
+                capacity *= 2;
+            }
+            if (capacity != m_capacity)
+            {
+                resize(capacity);
+            }
+        }
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            return emplace_key(Traits::key_from_value(value), value);
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            return emplace_key(Traits::key_from_value(value), AZStd::move(value));
+        }
+        iterator insert(const_iterator, const value_type& value)
+        {
+            return insert(value).first;
+        }
+        iterator insert(const_iterator, value_type&& value)
+        {
+            return insert(AZStd::move(value)).first;
+        }
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        void insert(AZStd::initializer_list<value_type> list)
+        {
+            insert(list.begin(), list.end());
+        }
+
+        //! Constructs the element before looking up its key, prefer try_emplace on maps.
+        template <class... Args>
+        pair_iter_bool emplace(Args&&... arguments)
+        {
+            value_type value(AZStd::forward<Args>(arguments)...);
+            return emplace_key(Traits::key_from_value(value), AZStd::move(value));
+        }
+        template <class... Args>
+        iterator emplace_hint(const_iterator, Args&&... arguments)
+        {
+            return emplace(AZStd::forward<Args>(arguments)...).first;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            iterator next(position.m_ctrl, position.m_ctrlEnd, const_cast<pointer>(position.m_slot));
+            erase_index(static_cast<size_type>(next.m_slot - m_slots));
+            ++next;
+            return next;
+        }
+        iterator erase(iterator position)
+        {
+            return erase(const_iterator(position));
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(last.m_ctrl, last.m_ctrlEnd, const_cast<pointer>(last.m_slot));
+        }
+        size_type erase(const key_type& key)
+        {
+            const size_type index = find_index(key, Internal::FlatHash::Mix(m_hasher(key)));
+            if (index == npos)
+            {
+                return 0;
+            }
+            erase_index(index);
+            return 1;
+        }
+
+        iterator find(const key_type& key)
+        {
+            return iterator_at(find_index(key, Internal::FlatHash::Mix(m_hasher(key))));
+        }
+        const_iterator find(const key_type& key) const
+        {
+            return const_cast<this_type*>(this)->find(key);
+        }
+        bool contains(const key_type& key) const
+        {
+            return find_index(key, Internal::FlatHash::Mix(m_hasher(key))) != npos;
+        }
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+        AZStd::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            iterator it = find(key);
+            if (it == end())
+            {
+                return { it, it };
+            }
+            iterator next = it;
+            return { it, ++next };
+        }
+        AZStd::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            auto range = const_cast<this_type*>(this)->equal_range(key);
+            return { range.first, range.second };
+        }
+
+        void swap(flat_hash_table& rhs)
+        {
+            AZSTD_CONTAINER_ASSERT(m_allocator == rhs.m_allocator, "flat_hash_table::swap requires equal allocators");
+            AZStd::swap(m_ctrl, rhs.m_ctrl);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+        }
+
+        bool validate() const
+        {
+            size_type count = 0;
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (Internal::FlatHash::IsFull(m_ctrl[i]))
+                {
+                    if (find_index(Traits::key_from_value(m_slots[i]), Internal::FlatHash::Mix(m_hasher(Traits::key_from_value(m_slots[i])))) != i)
+                    {
+                        return false;
+                    }
+                    ++count;
+                }
+            }
+            return count == m_size;
+        }
+
+    protected:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        //! Inserts a new element constructed from arguments unless key is already in the table.
+        template <class... Args>
+        pair_iter_bool emplace_key(const key_type& key, Args&&... arguments)
+        {
+            const size_t hash = Internal::FlatHash::Mix(m_hasher(key));
+            size_type index = find_index(key, hash);
+            if (index != npos)
+            {
+                return { iterator_at(index), false };
+            }
+            index = prepare_insert(hash);
+            AZStd::construct_at(m_slots + index, AZStd::forward<Args>(arguments)...);
+            return { iterator_at(index), true };
+        }
+
+        iterator iterator_at(size_type index)
+        {
+            if (index == npos)
+            {
+                return end();
+            }
+            return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+        }
+
+        size_type find_index(const key_type& key, size_t hash) const
+        {
+            Internal::FlatHash::ProbeSequence sequence(hash, probe_mask());
+            const ctrl_t h2 = Internal::FlatHash::H2(hash);
+            for (;;)
+            {
+                const Internal::FlatHash::Group group(m_ctrl + sequence.GetOffset());
+                for (auto match = group.Match(h2); match; match.ClearLowestLane())
+                {
+                    const size_type index = sequence.GetOffset(match.LowestLane());
+                    if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.MatchEmpty())
+                {
+                    return npos;
+                }
+                sequence.Next();
+            }
+        }
+
+    private:
+        size_type probe_mask() const
+        {
+            return m_capacity ? m_capacity - 1 : 0;
+        }
+
+        //! First empty or deleted slot on the probe sequence of hash.
+        size_type find_first_non_full(size_t hash) const
+        {
+            Internal::FlatHash::ProbeSequence sequence(hash, probe_mask());
+            for (;;)
+            {
+                auto mask = Internal::FlatHash::Group(m_ctrl + sequence.GetOffset()).MatchEmptyOrDeleted();
+                if (mask)
+                {
+                    return sequence.GetOffset(mask.LowestLane());
+                }
+                sequence.Next();
+            }
+        }
+
+        //! Claims a slot for a new element with hash, growing the table when needed.
+        size_type prepare_insert(size_t hash)
+        {
+            size_type index = find_first_non_full(hash);
+            if (m_growthLeft == 0 && m_ctrl[index] != Internal::FlatHash::CtrlDeleted)
+            {
+                rehash_and_grow();
+                index = find_first_non_full(hash);
+            }
+            m_growthLeft -= (m_ctrl[index] == Internal::FlatHash::CtrlEmpty) ? 1 : 0;
+            set_ctrl(index, Internal::FlatHash::H2(hash));
+            ++m_size;
+            return index;
+        }
+
+        template <class ValueArg>
+        void insert_unique_no_check(ValueArg&& value)
+        {
+            const size_t hash = Internal::FlatHash::Mix(m_hasher(Traits::key_from_value(value)));
+            AZStd::construct_at(m_slots + prepare_insert(hash), AZStd::forward<ValueArg>(value));
+        }
+
+        void rehash_and_grow()
+        {
+            if (m_capacity > Internal::FlatHash::GroupWidth && m_size * 32 <= m_capacity * 25)
+            {
+                // Mostly deleted slots, rebuild at the same capacity to drop them
+                resize(m_capacity);
+            }
+            else
+            {
+                resize(m_capacity ? m_capacity * 2 : Internal::FlatHash::MinCapacity);
+            }
+        }
+
+        void erase_index(size_type index)
+        {
+            AZStd::destroy_at(m_slots + index);
+            --m_size;
+
+            // A probe only continues past a group without empty slots. If no window of GroupWidth slots around this
+            // one is without empty slots, no probe went past it and it can be marked empty instead of deleted.
+            bool wasNeverFull = m_capacity < Internal::FlatHash::GroupWidth;
+            if (!wasNeverFull)
+            {
+                const size_type indexBefore = (index - Internal::FlatHash::GroupWidth) & (m_capacity - 1);
+                const auto emptyAfter = Internal::FlatHash::Group(m_ctrl + index).MatchEmpty();
+                const auto emptyBefore = Internal::FlatHash::Group(m_ctrl + indexBefore).MatchEmpty();
+                wasNeverFull = emptyBefore && emptyAfter &&
+                    (emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) < Internal::FlatHash::GroupWidth;
+            }
+            set_ctrl(index, wasNeverFull ? Internal::FlatHash::CtrlEmpty : Internal::FlatHash::CtrlDeleted);
+            m_growthLeft += wasNeverFull ? 1 : 0;
+        }
+
+        //! Sets a control byte and its clones past the end, which let groups read over the end of the table.
+        void set_ctrl(size_type index, ctrl_t ctrl)
+        {
+            m_ctrl[index] = ctrl;
+            for (size_type clone = index + m_capacity; clone < m_capacity + Internal::FlatHash::GroupWidth; clone += m_capacity)
+            {
+                m_ctrl[clone] = ctrl;
+            }
+        }
+
+        static size_type slots_offset(size_type capacity)
+        {
+            const size_type ctrlBytes = capacity + Internal::FlatHash::GroupWidth;
+            return (ctrlBytes + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+        }
+
+        static size_type storage_size(size_type capacity)
+        {
+            return slots_offset(capacity) + capacity * sizeof(value_type);
+        }
+
+        static constexpr size_type storage_alignment()
+        {
+            return alignof(value_type) > alignof(void*) ? alignof(value_type) : alignof(void*);
+        }
+
+        //! Moves the elements to new storage with capacity slots.
+        void resize(size_type capacity)
+        {
+            ctrl_t* oldCtrl = m_ctrl;
+            pointer oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            char* storage = static_cast<char*>(m_allocator.allocate(storage_size(capacity), storage_alignment()));
+            m_ctrl = reinterpret_cast<ctrl_t*>(storage);
+            m_slots = reinterpret_cast<pointer>(storage + slots_offset(capacity));
+            m_capacity = capacity;
+            reset_ctrl();
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (Internal::FlatHash::IsFull(oldCtrl[i]))
+                {
+                    const size_t hash = Internal::FlatHash::Mix(m_hasher(Traits::key_from_value(oldSlots[i])));
+                    const size_type index = find_first_non_full(hash);
+                    set_ctrl(index, Internal::FlatHash::H2(hash));
+                    AZStd::construct_at(m_slots + index, AZStd::move(oldSlots[i]));
+                    AZStd::destroy_at(oldSlots + i);
+                }
+            }
+            m_growthLeft = Internal::FlatHash::CapacityToGrowth(m_capacity) - m_size;
+
+            if (oldCapacity != 0)
+            {
+                m_allocator.deallocate(oldCtrl, storage_size(oldCapacity), storage_alignment());
+            }
+        }
+
+        //! Marks all slots empty, the elements must already be destroyed or moved out.
+        void reset_ctrl()
+        {
+            if (m_capacity != 0)
+            {
+                ::memset(m_ctrl, Internal::FlatHash::CtrlEmpty, m_capacity + Internal::FlatHash::GroupWidth);
+            }
+            m_growthLeft = Internal::FlatHash::CapacityToGrowth(m_capacity);
+        }
+
+        void destroy_elements()
+        {
+            if constexpr (!AZStd::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (Internal::FlatHash::IsFull(m_ctrl[i]))
+                    {
+                        AZStd::destroy_at(m_slots + i);
+                    }
+                }
+            }
+            m_size = 0;
+        }
+
+        void deallocate_storage()
+        {
+            if (m_capacity != 0)
+            {
+                m_allocator.deallocate(m_ctrl, storage_size(m_capacity), storage_alignment());
+            }
+            m_ctrl = Internal::FlatHash::EmptyGroup();
+            m_slots = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        void copy_from(const flat_hash_table& rhs)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                insert_unique_no_check(value);
+            }
+        }
+
+        //! Takes the storage of rhs, which must be compatible with the allocator of this table.
+        void steal(flat_hash_table& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            m_growthLeft = rhs.m_growthLeft;
+            rhs.m_ctrl = Internal::FlatHash::EmptyGroup();
+            rhs.m_slots = nullptr;
+            rhs.m_size = 0;
+            rhs.m_capacity = 0;
+            rhs.m_growthLeft = 0;
+        }
+
+        ctrl_t* m_ctrl = Internal::FlatHash::EmptyGroup(); //!< capacity control bytes followed by GroupWidth clones of the first ones
+        pointer m_slots = nullptr;
+        size_type m_size = 0;
+        size_type m_capacity = 0;
+        size_type m_growthLeft = 0; //!< Empty slots that can be filled before growing
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+    };
+
+    template <class Traits>
+    bool operator==(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (const auto& value : lhs)
+        {
+            auto it = rhs.find(Traits::key_from_value(value));
+            if (it == rhs.end() || !(*it == value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Traits>
+    bool operator!=(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+} // namespace AZStd
@@ -94,6 +94,16 @@ namespace AZStd
             }
         }
 
+        //! Takes over a reference already held on p when add_ref is false.
+        intrusive_ptr(T* p, bool add_ref)
+            : px(p)
+        {
+            if (px != 0 && add_ref)
+            {
+                CountPolicy::add_ref(px);
+            }
+        }
+
         template<class U>
         intrusive_ptr(intrusive_ptr<U> const& rhs, enable_if_t<is_convertible<U*, T*>::value, int> = 0)
             : px(rhs.get())
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/typetraits/config.h>
+
+namespace AZStd
+{
+    //! Backport of C++20 std::is_constant_evaluated, returns true when called during constant evaluation.
+    //! Allows constexpr functions to switch to a faster runtime implementation that can't be constexpr.
+    constexpr bool is_constant_evaluated() noexcept
+    {
+        return __builtin_is_constant_evaluated();
+    }
+}
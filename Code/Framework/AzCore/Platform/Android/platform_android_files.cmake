@@ -45,6 +45,8 @@ set(FILES
     AzCore/Memory/HeapSchema_Android.cpp
     AzCore/Memory/OSAllocator_Platform.h
     AzCore/Memory/OverrunDetectionAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/ReservedAddressSpace_Unimplemented.cpp
+    ../Common/Unimplemented/AzCore/Jobs/CpuTopology_Unimplemented.cpp
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Internal/MathTypes_Android.h
     AzCore/Math/Random_Platform.h
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
+
+namespace AZ::Platform
+{
+    size_t GetVirtualMemoryPageSize()
+    {
+        return 4096;
+    }
+
+    size_t GetHugePageSize()
+    {
+        return 0;
+    }
+
+    void* ReserveAddressSpace([[maybe_unused]] size_t byteSize, [[maybe_unused]] size_t alignment)
+    {
+        return nullptr;
+    }
+
+    void ReleaseAddressSpace([[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize)
+    {
+    }
+
+    bool CommitAddressSpace([[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize, [[maybe_unused]] ReservedAddressSpaceSchema::HugePages hugePages)
+    {
+        return false;
+    }
+
+    void DecommitAddressSpace([[maybe_unused]] void* address, [[maybe_unused]] size_t byteSize)
+    {
+    }
+} // namespace AZ::Platform
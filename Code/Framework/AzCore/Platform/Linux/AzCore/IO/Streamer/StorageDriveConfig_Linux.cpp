@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/any.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        DriveList drives;
+        if (const DriveList* probedDrives = AZStd::any_cast<DriveList>(&hardware.m_platformData); probedDrives != nullptr)
+        {
+            drives = *probedDrives;
+        }
+        if (drives.empty())
+        {
+            // No hardware information was collected, so create a single drive for the entire file system.
+            DriveInformation& drive = drives.emplace_back();
+            drive.m_paths.emplace_back("/");
+            drive.m_physicalSectorSize = hardware.m_maxPhysicalSectorSize;
+            drive.m_logicalSectorSize = hardware.m_maxLogicalSectorSize;
+        }
+
+        // Drives are added from the bottom of the stack up and the first drive that services a path handles the request.
+        // Sort the drives so drives with more specific mount points, such as "/home", end up above the drive for "/".
+        auto longestPath = [](const DriveInformation& drive)
+        {
+            size_t length = 0;
+            for (const AZStd::string& path : drive.m_paths)
+            {
+                length = AZStd::max(length, path.size());
+            }
+            return length;
+        };
+        AZStd::sort(drives.begin(), drives.end(), [&longestPath](const DriveInformation& lhs, const DriveInformation& rhs)
+            {
+                return longestPath(lhs) < longestPath(rhs);
+            });
+
+        AZStd::shared_ptr<StreamStackEntry> stackEntry = AZStd::move(parent);
+        for (const DriveInformation& drive : drives)
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+            options.m_enableDirectReads = m_enableDirectReads;
+            options.m_minimalReporting = m_minimalReporting;
+
+            // Don't queue more reads than the device's request queue can hold as they'd only wait in the kernel.
+            u32 queueDepth = m_queueDepth;
+            if (drive.m_ioChannelCount > 0)
+            {
+                queueDepth = AZStd::min(queueDepth, drive.m_ioChannelCount);
+            }
+
+            AZStd::vector<AZStd::string_view> drivePaths;
+            drivePaths.reserve(drive.m_paths.size());
+            for (const AZStd::string& path : drive.m_paths)
+            {
+                drivePaths.emplace_back(path);
+            }
+
+            auto driveEntry = AZStd::make_shared<StorageDriveLinux>(
+                drivePaths, m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize,
+                queueDepth, m_overcommit, options);
+            if (!driveEntry->IsAvailable())
+            {
+                // Leave the stack as is so reads are handled by the entry below, such as the generic storage drive.
+                AZ_Warning("Streamer", false, "io_uring isn't available so the Linux storage drive can't be used.\n");
+                return stackEntry;
+            }
+
+            driveEntry->SetNext(AZStd::move(stackEntry));
+            stackEntry = AZStd::move(driveEntry);
+        }
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
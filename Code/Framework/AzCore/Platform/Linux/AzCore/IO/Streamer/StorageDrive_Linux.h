@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Storage drive that uses io_uring to keep multiple reads in flight on the device. Completions are signaled through an
+    //! eventfd that's registered with the scheduler thread, so the scheduler sleeps until either new requests arrive or
+    //! reads complete.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use direct reads (O_DIRECT) to bypass the Linux page cache. This results in a faster read the first time a file
+            //! is read, but subsequent reads will possibly be slower as those could have been serviced from the page cache.
+            //! Direct reads have alignment restrictions. Reads that don't meet those are read into an internal aligned buffer
+            //! first. For the most optimal performance align read buffers to the physicalSectorSize. If a file system doesn't
+            //! support direct reads, files on it will be read through the page cache.
+            u8 m_enableDirectReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The paths to the mount points that are serviced by this device. A single device can have multiple
+        //!     mount points.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the
+        //!     read size and read offset need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that are kept in flight on the device.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        //! Whether or not the io_uring could be created. If the kernel doesn't support io_uring or it has been disabled
+        //! the drive can't be used.
+        bool IsAvailable() const;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! User data for submissions that don't belong to a read slot, such as cancellations.
+        inline static constexpr u64 InternalSubmissionUserData = std::numeric_limits<u64>::max();
+
+        //! The user data of a read holds the read slot in the lower 32 bits and the generation of the slot in the upper 32 bits,
+        //! so a cancellation that's still queued when the read completes can't cancel a newer read in the same slot.
+        u64 GetReadUserData(size_t readSlot) const;
+
+        //! Minimal wrapper around the kernel's io_uring interface. The rings are shared with the kernel, so the heads and tails
+        //! are accessed with acquire/release semantics.
+        class IoUring
+        {
+        public:
+            IoUring() = default;
+            IoUring(const IoUring&) = delete;
+            IoUring& operator=(const IoUring&) = delete;
+            ~IoUring();
+
+            bool Initialize(u32 entries);
+            void Shutdown();
+            bool IsInitialized() const;
+
+            //! Adds a vectored read to the submission queue. The buffer needs to stay alive until the read completes.
+            //! @return False if the submission queue is full.
+            bool QueueRead(int file, const iovec* buffer, u64 offset, u64 userData);
+            //! Adds a request to cancel the submission with the provided user data to the submission queue.
+            //! @return False if the submission queue is full.
+            bool QueueCancel(u64 targetUserData);
+            //! Submits all queued entries to the kernel.
+            //! @return The number of submitted entries or a negative errno value.
+            int Submit();
+            //! Retrieves the next completed submission if there is one.
+            //! @param userData The user data that was provided when the submission was queued.
+            //! @param result The number of bytes read or a negative errno value.
+            //! @return False if there are no completed submissions available.
+            bool PopCompletion(u64& userData, s32& result);
+            //! Takes back the most recently queued entry that the kernel hasn't consumed yet.
+            //! @param userData The user data that was provided when the entry was queued.
+            //! @return False if all queued entries have been consumed by the kernel.
+            bool PopUnsubmitted(u64& userData);
+
+            int GetCompletionEvent() const;
+
+        private:
+            void* m_submissionRing{ nullptr };
+            void* m_completionRing{ nullptr };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            size_t m_completionRingSize{ 0 };
+            size_t m_submissionEntriesSize{ 0 };
+            u32 m_submissionMask{ 0 };
+            u32 m_completionMask{ 0 };
+            u32 m_submissionEntryCount{ 0 };
+            u32 m_localSubmissionTail{ 0 }; //!< Tail of the entries that have been queued but not submitted yet.
+            int m_ringFile{ -1 };
+            int m_completionEvent{ -1 }; //!< eventfd that's signaled by the kernel when a completion is posted.
+        };
+
+        struct FileReadStatus
+        {
+            iovec m_buffer{};
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            size_t m_copyBackOffset{ 0 };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(const char* filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFile(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void SubmitReads();
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        IoUring m_ring;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<FileReadStatus> m_readSlots_statusInfo;
+        AZStd::vector<bool> m_readSlots_active;
+        AZStd::vector<u32> m_readSlots_generation; //!< Incremented every time a read is queued in the slot.
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_unsubmittedCount{ 0 }; //!< Number of reads and cancellations in the submission queue that the kernel hasn't accepted yet.
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
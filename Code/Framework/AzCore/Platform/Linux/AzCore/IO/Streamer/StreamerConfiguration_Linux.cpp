@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    struct MountPoint
+    {
+        AZStd::string m_path;
+        AZStd::string m_device; //!< Major and minor number of the device, for instance "259:2".
+        bool m_isUsed{ false };
+    };
+
+    static size_t PreviousPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result <= (value >> 1))
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    static bool ReadSysfsValue(const AZStd::string& path, size_t& value)
+    {
+        int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return false;
+        }
+        char buffer[32];
+        ssize_t bytesRead = ::read(file, buffer, sizeof(buffer) - 1);
+        ::close(file);
+        if (bytesRead <= 0)
+        {
+            return false;
+        }
+        buffer[bytesRead] = 0;
+
+        char* end = nullptr;
+        unsigned long long result = ::strtoull(buffer, &end, 10);
+        if (end == buffer)
+        {
+            return false;
+        }
+        value = aznumeric_caster(result);
+        return true;
+    }
+
+    // Mount points in /proc/self/mountinfo escape spaces, tabs, new lines and backslashes as 3 digit octal values.
+    static AZStd::string UnescapeMountPath(AZStd::string_view path)
+    {
+        AZStd::string result;
+        result.reserve(path.size());
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (path[i] == '\\' && i + 3 < path.size())
+            {
+                const char* digits = path.data() + i + 1;
+                if (digits[0] >= '0' && digits[0] <= '7' && digits[1] >= '0' && digits[1] <= '7' && digits[2] >= '0' && digits[2] <= '7')
+                {
+                    result += static_cast<char>(((digits[0] - '0') << 6) | ((digits[1] - '0') << 3) | (digits[2] - '0'));
+                    i += 3;
+                    continue;
+                }
+            }
+            result += path[i];
+        }
+        return result;
+    }
+
+    static bool CollectMountPoints(AZStd::vector<MountPoint>& mountPoints)
+    {
+        int file = ::open("/proc/self/mountinfo", O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return false;
+        }
+        AZStd::string content;
+        char buffer[4096];
+        ssize_t bytesRead;
+        while ((bytesRead = ::read(file, buffer, sizeof(buffer))) > 0)
+        {
+            content.append(buffer, bytesRead);
+        }
+        ::close(file);
+
+        // Each line has the format:
+        //      36 35 98:0 /mnt1 /mnt/parent rw,noatime master:1 - ext3 /dev/root rw,errors=continue
+        //      (1)(2)(3)   (4)   (5)      (6)      (7)   (8) (9)   (10)         (11)
+        // The third field is the device and the fifth the mount point. Devices with major number 0 are not backed
+        // by a block device, such as tmpfs, proc and network file systems.
+        AZ::StringFunc::TokenizeVisitor(content, [&mountPoints](AZStd::string_view line)
+            {
+                AZStd::string_view fields[5];
+                size_t fieldCount = 0;
+                AZ::StringFunc::TokenizeVisitor(line, [&fields, &fieldCount](AZStd::string_view field)
+                    {
+                        if (fieldCount < AZ_ARRAY_SIZE(fields))
+                        {
+                            fields[fieldCount] = field;
+                        }
+                        fieldCount++;
+                    }, ' ');
+                if (fieldCount >= AZ_ARRAY_SIZE(fields) && !AZ::StringFunc::StartsWith(fields[2], "0:"))
+                {
+                    MountPoint& mountPoint = mountPoints.emplace_back();
+                    mountPoint.m_device = fields[2];
+                    mountPoint.m_path = UnescapeMountPath(fields[4]);
+                }
+            }, '\n');
+        return true;
+    }
+
+    static void CollectUsedPaths(AZStd::vector<AZStd::string>& paths)
+    {
+        struct PathVisitor : SettingsRegistryInterface::Visitor
+        {
+            ~PathVisitor() override = default;
+
+            AZStd::vector<AZStd::string>* m_paths{ nullptr };
+            bool m_firstObject = true;
+
+            SettingsRegistryInterface::VisitResponse Traverse([[maybe_unused]] AZStd::string_view path,
+                [[maybe_unused]] AZStd::string_view valueName, [[maybe_unused]] SettingsRegistryInterface::VisitAction action,
+                SettingsRegistryInterface::Type type) override
+            {
+                if (type == SettingsRegistryInterface::Type::Object)
+                {
+                    if (m_firstObject)
+                    {
+                        m_firstObject = false;
+                        return SettingsRegistryInterface::VisitResponse::Continue;
+                    }
+                    else
+                    {
+                        return SettingsRegistryInterface::VisitResponse::Skip;
+                    }
+                }
+
+                return type == SettingsRegistryInterface::Type::String ?
+                    SettingsRegistryInterface::VisitResponse::Continue : SettingsRegistryInterface::VisitResponse::Skip;
+            }
+
+            void Visit([[maybe_unused]] AZStd::string_view path, [[maybe_unused]] AZStd::string_view valueName,
+                [[maybe_unused]] AZ::SettingsRegistryInterface::Type type, AZStd::string_view value) override
+            {
+                m_paths->emplace_back(value);
+            }
+        };
+
+        if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            PathVisitor visitor;
+            visitor.m_paths = &paths;
+            settingsRegistry->Visit(visitor, SettingsRegistryMergeUtils::FilePathsRootKey);
+        }
+    }
+
+    // Finds the mount point that the path is on, which is the mount point with the longest path that's a parent of the path.
+    static MountPoint* FindMountPoint(AZStd::vector<MountPoint>& mountPoints, AZStd::string_view path)
+    {
+        MountPoint* result = nullptr;
+        for (MountPoint& mountPoint : mountPoints)
+        {
+            AZStd::string_view mountPath = mountPoint.m_path;
+            if (mountPath.ends_with(AZ_CORRECT_FILESYSTEM_SEPARATOR))
+            {
+                mountPath.remove_suffix(1);
+            }
+            if (path.starts_with(mountPath) &&
+                (path.size() == mountPath.size() || path[mountPath.size()] == AZ_CORRECT_FILESYSTEM_SEPARATOR) &&
+                (result == nullptr || mountPoint.m_path.size() >= result->m_path.size()))
+            {
+                // Later entries in the mount table hide earlier ones on the same path, so they take precedence.
+                result = &mountPoint;
+            }
+        }
+        return result;
+    }
+
+    // Finds the sysfs directory of the device that holds the request queue. For partitions that's the parent device.
+    static bool ResolveDeviceDirectory(const AZStd::string& device, AZStd::string& deviceDirectory)
+    {
+        AZStd::string devicePath = "/sys/dev/block/";
+        devicePath += device;
+        char* resolvedPath = ::realpath(devicePath.c_str(), nullptr);
+        if (!resolvedPath)
+        {
+            return false;
+        }
+        deviceDirectory = resolvedPath;
+        ::free(resolvedPath);
+
+        struct stat attributes;
+        if (::stat((deviceDirectory + "/partition").c_str(), &attributes) == 0)
+        {
+            deviceDirectory.erase(deviceDirectory.find_last_of(AZ_CORRECT_FILESYSTEM_SEPARATOR));
+        }
+        return ::stat((deviceDirectory + "/queue").c_str(), &attributes) == 0;
+    }
+
+    static void CollectDeviceProfile(AZStd::string_view deviceName, DriveInformation& information, bool reportHardware)
+    {
+        if (deviceName.starts_with("nvme"))
+        {
+            information.m_profile = "Nvme";
+        }
+        else if (deviceName.starts_with("sd"))
+        {
+            information.m_profile = "Scsi";
+        }
+        else if (deviceName.starts_with("mmcblk"))
+        {
+            information.m_profile = "Mmc";
+        }
+        else if (deviceName.starts_with("vd") || deviceName.starts_with("xvd"))
+        {
+            information.m_profile = "Virtual";
+        }
+        else if (deviceName.starts_with("md") || deviceName.starts_with("dm-"))
+        {
+            information.m_profile = "Raid";
+        }
+        else
+        {
+            information.m_profile = "Generic";
+        }
+
+        if (reportHardware)
+        {
+            AZ_Printf("Streamer", "    Bus: %s\n", information.m_profile.c_str());
+        }
+    }
+
+    static void CollectQueueInformation(const AZStd::string& deviceDirectory, DriveInformation& information, bool reportHardware)
+    {
+        const AZStd::string queueDirectory = deviceDirectory + "/queue/";
+        size_t value = 0;
+
+        // The rotational flag is the closest equivalent to the seek penalty and TRIM checks on other platforms.
+        if (ReadSysfsValue(queueDirectory + "rotational", value))
+        {
+            information.m_hasSeekPenalty = value != 0;
+            information.m_profile += information.m_hasSeekPenalty ? "_HDD" : "_SSD";
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "    Drive type: %s\n", information.m_hasSeekPenalty ? "HDD" : "SSD");
+            }
+        }
+        else if (reportHardware)
+        {
+            AZ_Printf("Streamer", "    Drive type couldn't be determined.\n");
+        }
+
+        if (ReadSysfsValue(queueDirectory + "max_sectors_kb", value) && value > 0)
+        {
+            // Caches and the read splitter use the max transfer for their block sizes, which need to be a power of two.
+            information.m_maxTransfer = PreviousPowerOfTwo(value * 1_kib);
+        }
+        if (ReadSysfsValue(queueDirectory + "logical_block_size", value) && IStreamerTypes::IsPowerOf2(value))
+        {
+            information.m_logicalSectorSize = value;
+        }
+        if (ReadSysfsValue(queueDirectory + "physical_block_size", value) && IStreamerTypes::IsPowerOf2(value))
+        {
+            information.m_physicalSectorSize = value;
+        }
+        if (ReadSysfsValue(queueDirectory + "nr_requests", value))
+        {
+            information.m_ioChannelCount = aznumeric_caster(value);
+            information.m_supportsQueuing = value > 1;
+        }
+        information.m_pageSize = aznumeric_caster(::sysconf(_SC_PAGESIZE));
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "    Max transfer: %.3f kb\n"
+                "    Page size: %zu kb\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n"
+                "    Max IO count: %u\n",
+                (1.0f / 1024.0f) * information.m_maxTransfer,
+                information.m_pageSize / 1_kib,
+                information.m_physicalSectorSize,
+                information.m_logicalSectorSize,
+                information.m_ioChannelCount);
+        }
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        AZStd::vector<MountPoint> mountPoints;
+        if (!CollectMountPoints(mountPoints))
+        {
+            return false;
+        }
+
+        if (addAllDrives)
+        {
+            for (MountPoint& mountPoint : mountPoints)
+            {
+                mountPoint.m_isUsed = true;
+            }
+        }
+        else
+        {
+            AZStd::vector<AZStd::string> usedPaths;
+            CollectUsedPaths(usedPaths);
+            for (const AZStd::string& usedPath : usedPaths)
+            {
+                if (MountPoint* mountPoint = FindMountPoint(mountPoints, usedPath); mountPoint != nullptr)
+                {
+                    mountPoint->m_isUsed = true;
+                }
+            }
+        }
+
+        // Multiple mount points can be on the same device, so group them by the device's sysfs directory.
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+        for (const MountPoint& mountPoint : mountPoints)
+        {
+            if (!mountPoint.m_isUsed)
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping mount point '%s' because no paths make use of it.\n", mountPoint.m_path.c_str());
+                }
+                continue;
+            }
+
+            AZStd::string deviceDirectory;
+            if (!ResolveDeviceDirectory(mountPoint.m_device, deviceDirectory))
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping mount point '%s' because device %s has no request queue.\n",
+                        mountPoint.m_path.c_str(), mountPoint.m_device.c_str());
+                }
+                continue;
+            }
+
+            auto driveInformationEntry = driveMappings.find(deviceDirectory);
+            if (driveInformationEntry != driveMappings.end())
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                        mountPoint.m_path.c_str(), driveInformationEntry->second.m_paths[0].c_str());
+                }
+                driveInformationEntry->second.m_paths.push_back(mountPoint.m_path);
+                continue;
+            }
+
+            const AZStd::string_view deviceName =
+                AZStd::string_view(deviceDirectory).substr(deviceDirectory.find_last_of(AZ_CORRECT_FILESYSTEM_SEPARATOR) + 1);
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "Device '%.*s' for mount point '%s':\n", AZ_STRING_ARG(deviceName), mountPoint.m_path.c_str());
+            }
+
+            DriveInformation driveInformation;
+            driveInformation.m_paths.push_back(mountPoint.m_path);
+            CollectDeviceProfile(deviceName, driveInformation, reportHardware);
+            CollectQueueInformation(deviceDirectory, driveInformation, reportHardware);
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "\n");
+            }
+
+            hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+            hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+            hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, driveInformation.m_pageSize);
+            hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+            driveMappings.emplace(AZStd::move(deviceDirectory), AZStd::move(driveInformation));
+        }
+
+        if (driveMappings.empty())
+        {
+            return false;
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            driveList.push_back(AZStd::move(drive.second));
+        }
+        hardwareInfo.m_profile = driveList.size() == 1 ? driveList.front().m_profile : "Generic";
+        if (reportHardware)
+        {
+            AZ_Printf("Streamer", "Selected hardware profile: %s\n", hardwareInfo.m_profile.c_str());
+        }
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0].fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        m_events[0].events = POLLIN;
+        AZ_Assert(m_events[0].fd >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_events[0].fd >= 0)
+        {
+            ::close(m_events[0].fd);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result = 0;
+        do
+        {
+            result = ::poll(m_events, m_eventCount, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            // Reset the events that woke up the thread.
+            for (size_t i = 0; i < m_eventCount; ++i)
+            {
+                if (m_events[i].revents & POLLIN)
+                {
+                    eventfd_t value;
+                    ::eventfd_read(m_events[i].fd, &value);
+                }
+            }
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected poll result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0].fd, 1);
+    }
+
+    bool StreamerContextThreadSync::AddIoEvent(int event)
+    {
+        if (!AreIoEventsAvailable())
+        {
+            return false;
+        }
+
+        m_events[m_eventCount].fd = event;
+        m_events[m_eventCount].events = POLLIN;
+        m_events[m_eventCount].revents = 0;
+        m_eventCount++;
+        return true;
+    }
+
+    void StreamerContextThreadSync::RemoveIoEvent(int event)
+    {
+        AZ_Assert(m_eventCount > 1, "There are no more IO events that can be removed.");
+
+        for (size_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd == event)
+            {
+                m_eventCount--;
+                m_events[i] = m_events[m_eventCount];
+                m_events[m_eventCount] = pollfd{};
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be removed as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetIoEventCount() const
+    {
+        return m_eventCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreIoEventsAvailable() const
+    {
+        return m_eventCount < AZ_ARRAY_SIZE(m_events);
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <poll.h>
+
+namespace AZ::Platform
+{
+    //! Suspends the scheduler thread until it's either explicitly woken up or one of the registered io events, such as
+    //! the completion event of an io_uring, is signaled. All events are eventfd file descriptors.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 63;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds an eventfd that will wake up the scheduler thread when signaled. The event remains owned by the caller and
+        //! needs to be removed before it's closed.
+        //! @return True if the event was added, false if there are no more slots available.
+        bool AddIoEvent(int event);
+        void RemoveIoEvent(int event);
+        size_t GetIoEventCount() const;
+        bool AreIoEventsAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread with the rest
+        // of the engine and is owned by this class. The remaining events are added by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        size_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <dirent.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace AZ::Platform
+{
+    namespace
+    {
+        using SysfsPath = AZStd::fixed_string<128>;
+        const char* s_cpuSysfsRoot = "/sys/devices/system/cpu";
+
+        //! Reads the first line of a sysfs file, returns false if the file can't be read.
+        bool ReadSysfsLine(const char* path, char* buffer, size_t bufferSize)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+            const bool result = fgets(buffer, static_cast<int>(bufferSize), file) != nullptr;
+            fclose(file);
+            return result;
+        }
+
+        int ReadSysfsInt(const char* path, int defaultValue)
+        {
+            char buffer[64];
+            return ReadSysfsLine(path, buffer, sizeof(buffer)) ? atoi(buffer) : defaultValue;
+        }
+
+        //! Parses a kernel cpu list ("0-3,8,10-11") and calls the callback for every cpu in it.
+        template<typename Callback>
+        void ForEachCpuInList(const char* list, Callback&& callback)
+        {
+            const char* current = list;
+            while (*current >= '0' && *current <= '9')
+            {
+                char* end = nullptr;
+                const long first = strtol(current, &end, 10);
+                long last = first;
+                if (*end == '-')
+                {
+                    last = strtol(end + 1, &end, 10);
+                }
+                for (long cpu = first; cpu <= last; ++cpu)
+                {
+                    callback(static_cast<int>(cpu));
+                }
+                current = (*end == ',') ? end + 1 : end;
+            }
+        }
+
+        //! The last level cache is the cache index with the highest level, its shared_cpu_list identifies the domain.
+        int ReadCacheDomain(int cpuId)
+        {
+            int cacheDomain = -1;
+            int highestLevel = 0;
+            for (int index = 0; ; ++index)
+            {
+                SysfsPath path = SysfsPath::format("%s/cpu%d/cache/index%d/level", s_cpuSysfsRoot, cpuId, index);
+                const int level = ReadSysfsInt(path.c_str(), -1);
+                if (level < 0)
+                {
+                    break;
+                }
+                if (level < highestLevel)
+                {
+                    continue;
+                }
+
+                char sharedCpus[256];
+                path = SysfsPath::format("%s/cpu%d/cache/index%d/shared_cpu_list", s_cpuSysfsRoot, cpuId, index);
+                if (ReadSysfsLine(path.c_str(), sharedCpus, sizeof(sharedCpus)))
+                {
+                    int lowestCpu = -1;
+                    ForEachCpuInList(sharedCpus, [&lowestCpu](int cpu)
+                    {
+                        lowestCpu = (lowestCpu == -1) ? cpu : AZStd::GetMin(lowestCpu, cpu);
+                    });
+                    highestLevel = level;
+                    cacheDomain = lowestCpu;
+                }
+            }
+            return cacheDomain;
+        }
+
+        //! The NUMA node is exposed as a "nodeN" link in the cpu directory.
+        int ReadNumaNode(int cpuId)
+        {
+            const SysfsPath path = SysfsPath::format("%s/cpu%d", s_cpuSysfsRoot, cpuId);
+            DIR* dir = opendir(path.c_str());
+            if (!dir)
+            {
+                return -1;
+            }
+
+            int numaNode = -1;
+            while (dirent* entry = readdir(dir))
+            {
+                if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+                {
+                    numaNode = atoi(entry->d_name + 4);
+                    break;
+                }
+            }
+            closedir(dir);
+            return numaNode;
+        }
+    }
+
+    bool QueryCpuTopology(CpuTopology& topology)
+    {
+        char onlineCpus[256];
+        const SysfsPath onlinePath = SysfsPath::format("%s/online", s_cpuSysfsRoot);
+        if (!ReadSysfsLine(onlinePath.c_str(), onlineCpus, sizeof(onlineCpus)))
+        {
+            return false;
+        }
+
+        ForEachCpuInList(onlineCpus, [&topology](int cpuId)
+        {
+            CpuTopology::LogicalCpu cpu;
+            cpu.m_cpuId = cpuId;
+            SysfsPath path = SysfsPath::format("%s/cpu%d/topology/core_id", s_cpuSysfsRoot, cpuId);
+            cpu.m_coreId = ReadSysfsInt(path.c_str(), -1);
+            path = SysfsPath::format("%s/cpu%d/topology/physical_package_id", s_cpuSysfsRoot, cpuId);
+            cpu.m_packageId = ReadSysfsInt(path.c_str(), -1);
+            cpu.m_numaNode = ReadNumaNode(cpuId);
+            cpu.m_cacheDomain = ReadCacheDomain(cpuId);
+            topology.m_cpus.push_back(cpu);
+        });
+
+        return !topology.m_cpus.empty();
+    }
+
+    int GetCurrentCpu()
+    {
+        return sched_getcpu();
+    }
+} // namespace AZ::Platform
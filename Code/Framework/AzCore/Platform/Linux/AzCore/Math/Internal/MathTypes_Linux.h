@@ -13,3 +13,7 @@
 #   include <emmintrin.h>
 #   include <smmintrin.h>
 #endif
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   include <immintrin.h>
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
+
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    namespace
+    {
+        size_t QueryHugePageSize()
+        {
+            // size of the transparent huge pages, which is also the default MAP_HUGETLB page size on x64 and arm64
+            if (FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r"))
+            {
+                unsigned long long hugePageSize = 0;
+                const bool isValid = fscanf(file, "%llu", &hugePageSize) == 1;
+                fclose(file);
+                if (isValid && hugePageSize)
+                {
+                    return static_cast<size_t>(hugePageSize);
+                }
+            }
+
+            if (FILE* file = fopen("/proc/meminfo", "r"))
+            {
+                char line[128];
+                unsigned long long hugePageSizeKB = 0;
+                while (fgets(line, sizeof(line), file))
+                {
+                    if (sscanf(line, "Hugepagesize: %llu kB", &hugePageSizeKB) == 1)
+                    {
+                        break;
+                    }
+                }
+                fclose(file);
+                if (hugePageSizeKB)
+                {
+                    return static_cast<size_t>(hugePageSizeKB * 1024);
+                }
+            }
+
+            return 2 * 1024 * 1024;
+        }
+    }
+
+    size_t GetVirtualMemoryPageSize()
+    {
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+
+    size_t GetHugePageSize()
+    {
+        static const size_t hugePageSize = QueryHugePageSize();
+        return hugePageSize;
+    }
+
+    void* ReserveAddressSpace(size_t byteSize, size_t alignment)
+    {
+        // over reserve to align the range and unmap the excess at both ends
+        const size_t mappedSize = byteSize + alignment;
+        void* mapped = mmap(nullptr, mappedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        char* mappedStart = reinterpret_cast<char*>(mapped);
+        char* start = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(mappedStart) + alignment - 1) / alignment * alignment);
+        if (start != mappedStart)
+        {
+            munmap(mappedStart, start - mappedStart);
+        }
+        const size_t tailSize = (mappedStart + mappedSize) - (start + byteSize);
+        if (tailSize)
+        {
+            munmap(start + byteSize, tailSize);
+        }
+        return start;
+    }
+
+    void ReleaseAddressSpace(void* address, size_t byteSize)
+    {
+        munmap(address, byteSize);
+    }
+
+    bool CommitAddressSpace(void* address, size_t byteSize, ReservedAddressSpaceSchema::HugePages hugePages)
+    {
+        using HugePages = ReservedAddressSpaceSchema::HugePages;
+        if (hugePages == HugePages::Explicit)
+        {
+            // replace the reserved pages with pages from the huge page pool, MAP_FIXED keeps the address
+            void* mapped = mmap(address, byteSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0);
+            if (mapped != MAP_FAILED)
+            {
+                return true;
+            }
+            // the pool is empty (or not configured, see /proc/sys/vm/nr_hugepages), use transparent huge pages
+            AZ_Warning("Memory", false, "MAP_HUGETLB failed to commit %zu bytes, using transparent huge pages.", byteSize);
+            mapped = mmap(address, byteSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_NORESERVE, -1, 0);
+            if (mapped == MAP_FAILED)
+            {
+                return false;
+            }
+            madvise(address, byteSize, MADV_HUGEPAGE);
+            return true;
+        }
+
+        if (mprotect(address, byteSize, PROT_READ | PROT_WRITE) != 0)
+        {
+            return false;
+        }
+        if (hugePages == HugePages::Transparent)
+        {
+            // fails when the kernel is built without transparent huge pages, regular pages are used then
+            madvise(address, byteSize, MADV_HUGEPAGE);
+        }
+        return true;
+    }
+
+    void DecommitAddressSpace(void* address, size_t byteSize)
+    {
+        // private anonymous pages are released and read back as zeros, the range stays accessible
+        madvise(address, byteSize, MADV_DONTNEED);
+    }
+} // namespace AZ::Platform
@@ -48,6 +48,8 @@ set(FILES
     AzCore/Memory/HeapSchema_Mac.cpp
     AzCore/Memory/OSAllocator_Platform.h
     AzCore/Memory/OverrunDetectionAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/ReservedAddressSpace_Unimplemented.cpp
+    ../Common/Unimplemented/AzCore/Jobs/CpuTopology_Unimplemented.cpp
     AzCore/Module/Internal/ModuleManagerSearchPathTool_Mac.cpp
     AzCore/Math/Internal/MathTypes_Mac.h
     AzCore/Math/Random_Platform.h
@@ -51,9 +51,11 @@ set(FILES
     AzCore/Memory/HeapSchema_Windows.cpp
     AzCore/Memory/OSAllocator_Platform.h
     AzCore/Memory/OverrunDetectionAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/ReservedAddressSpace_Unimplemented.cpp
     AzCore/Math/Random_Platform.h
     AzCore/Math/Random_Windows.cpp
     AzCore/Math/Random_Windows.h
+    ../Common/Unimplemented/AzCore/Jobs/CpuTopology_Unimplemented.cpp
     AzCore/Module/Internal/ModuleManagerSearchPathTool_Windows.cpp
     AzCore/Math/Internal/MathTypes_Windows.h
     ../Common/WinAPI/AzCore/Module/DynamicModuleHandle_WinAPI.cpp
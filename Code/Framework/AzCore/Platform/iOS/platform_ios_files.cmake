@@ -46,7 +46,9 @@ set(FILES
     AzCore/Memory/HeapSchema_iOS.cpp
     AzCore/Memory/OSAllocator_Platform.h
     AzCore/Memory/OverrunDetectionAllocator_Platform.h
+    ../Common/Unimplemented/AzCore/Memory/ReservedAddressSpace_Unimplemented.cpp
     AzCore/Math/Internal/MathTypes_iOS.h
+    ../Common/Unimplemented/AzCore/Jobs/CpuTopology_Unimplemented.cpp
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Random_Platform.h
     ../Common/UnixLike/AzCore/Math/Random_UnixLike.cpp
@@ -11,7 +11,10 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_unordered_set.h>
+#include <AzCore/std/containers/flat_unordered_map.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/Math/Uuid.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -2079,6 +2082,175 @@ namespace UnitTest
         EXPECT_EQ(0, HashedContainerTransparentTestInternal::s_allAssignmentCount);
     }
 
+    TEST_F(HashedContainers, FlatUnorderedMapBasic)
+    {
+        AZStd::flat_unordered_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.end(), map.find(1));
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_EQ(0, map.erase(1));
+
+        // Grow through several capacities
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_TRUE(map.insert(AZStd::make_pair(i, i * 2)).second);
+        }
+        EXPECT_EQ(1000, map.size());
+        EXPECT_TRUE(map.validate());
+        EXPECT_FALSE(map.insert(AZStd::make_pair(10, 0)).second);
+        EXPECT_EQ(20, map[10]);
+        EXPECT_EQ(40, map.at(20));
+        EXPECT_TRUE(map.contains(999));
+        EXPECT_FALSE(map.contains(1000));
+        EXPECT_EQ(1, map.count(0));
+
+        int iterated = 0;
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(item.first * 2, item.second);
+            ++iterated;
+        }
+        EXPECT_EQ(1000, iterated);
+
+        // Erase half of the elements, then re-add them so the deleted slots get reused
+        for (int i = 0; i < 1000; i += 2)
+        {
+            EXPECT_EQ(1, map.erase(i));
+        }
+        EXPECT_EQ(500, map.size());
+        EXPECT_TRUE(map.validate());
+        for (int i = 0; i < 1000; i += 2)
+        {
+            EXPECT_EQ(map.end(), map.find(i));
+            map[i] = i * 2;
+        }
+        EXPECT_EQ(1000, map.size());
+        EXPECT_TRUE(map.validate());
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_NE(0, map.capacity());
+        map.rehash(0);
+        EXPECT_EQ(0, map.capacity());
+    }
+
+    TEST_F(HashedContainers, FlatUnorderedMapEraseWhileIterating)
+    {
+        AZStd::flat_unordered_map<int, int> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i);
+        }
+        for (auto it = map.begin(); it != map.end();)
+        {
+            it = (it->first % 3 == 0) ? map.erase(it) : AZStd::next(it);
+        }
+        EXPECT_EQ(66, map.size());
+        EXPECT_EQ(0, AZStd::erase_if(map, [](const auto& item) { return item.first % 3 == 0; }));
+        EXPECT_EQ(33, AZStd::erase_if(map, [](const auto& item) { return item.first % 3 == 1; }));
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(2, item.first % 3);
+        }
+        EXPECT_TRUE(map.validate());
+    }
+
+    TEST_F(HashedContainers, FlatUnorderedMapNonTrivialValue)
+    {
+        AZStd::flat_unordered_map<AZStd::string, MoveOnlyType> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            AZStd::string key = AZStd::string::format("key%d", i);
+            auto result = map.try_emplace(key, key);
+            EXPECT_TRUE(result.second);
+        }
+
+        // try_emplace doesn't touch its arguments on an existing key
+        MoveOnlyType value("replacement");
+        EXPECT_FALSE(map.try_emplace("key5", AZStd::move(value)).second);
+        EXPECT_EQ("replacement", value.m_name);
+        EXPECT_EQ("key5", map.at("key5").m_name);
+
+        // Elements are moved when the table grows and survive copies and moves of the map
+        for (int i = 0; i < 100; ++i)
+        {
+            AZStd::string key = AZStd::string::format("key%d", i);
+            EXPECT_EQ(key, map[key].m_name);
+        }
+        AZStd::flat_unordered_map<AZStd::string, MoveOnlyType> movedMap = AZStd::move(map);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(100, movedMap.size());
+        EXPECT_EQ("key42", movedMap.at("key42").m_name);
+    }
+
+    TEST_F(HashedContainers, FlatUnorderedMapCopyAndCompare)
+    {
+        AZStd::flat_unordered_map<int, AZStd::string> map{ { 1, "one" }, { 2, "two" }, { 3, "three" } };
+        AZStd::flat_unordered_map<int, AZStd::string> copy = map;
+        EXPECT_EQ(map, copy);
+        copy.insert_or_assign(2, "deux");
+        EXPECT_NE(map, copy);
+        EXPECT_EQ("deux", copy.at(2));
+        EXPECT_EQ("two", map.at(2));
+
+        copy = map;
+        EXPECT_EQ(map, copy);
+        copy.swap(map);
+        EXPECT_EQ(3, map.size());
+    }
+
+    TEST_F(HashedContainers, FlatUnorderedSetBasic)
+    {
+        AZStd::flat_unordered_set<AZStd::string> set{ "a", "b", "c" };
+        EXPECT_EQ(3, set.size());
+        EXPECT_FALSE(set.insert("a").second);
+        EXPECT_TRUE(set.insert("d").second);
+        EXPECT_TRUE(set.contains("d"));
+        EXPECT_EQ(1, set.erase("a"));
+        EXPECT_FALSE(set.contains("a"));
+        EXPECT_EQ(3, set.size());
+
+        AZStd::flat_unordered_set<int> intSet;
+        intSet.reserve(1000);
+        const size_t capacity = intSet.capacity();
+        for (int i = 0; i < 1000; ++i)
+        {
+            intSet.insert(i);
+        }
+        EXPECT_EQ(capacity, intSet.capacity());
+        EXPECT_TRUE(intSet.validate());
+    }
+
+    TEST_F(HashedContainers, FlatUnorderedMapMatchesUnorderedMap)
+    {
+        // Random inserts and erases over a small key range exercise the deleted slot reuse and in place rehashes
+        AZStd::flat_unordered_map<int, int> flatMap;
+        AZStd::unordered_map<int, int> map;
+        unsigned int seed = 1;
+        for (int i = 0; i < 50000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 500);
+            if ((seed >> 28) & 1)
+            {
+                EXPECT_EQ(map.emplace(key, i).second, flatMap.emplace(key, i).second);
+            }
+            else
+            {
+                EXPECT_EQ(map.erase(key), flatMap.erase(key));
+            }
+        }
+        EXPECT_EQ(map.size(), flatMap.size());
+        EXPECT_TRUE(flatMap.validate());
+        for (const auto& item : map)
+        {
+            auto it = flatMap.find(item.first);
+            ASSERT_NE(flatMap.end(), it);
+            EXPECT_EQ(item.second, it->second);
+        }
+    }
+
 #if defined(HAVE_BENCHMARK)
     template <template <typename...> class Hash>
     void Benchmark_Lookup(benchmark::State& state)
@@ -2172,6 +2344,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatUnorderedMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatUnorderedMapLookup);
+
+    void Benchmark_FlatUnorderedMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatUnorderedMapInsert);
+
+    void Benchmark_FlatUnorderedMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatUnorderedMapErase);
+
+    void Benchmark_FlatUnorderedMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatUnorderedMapThrash);
 #endif
 } // namespace UnitTest
 
@@ -2275,5 +2471,87 @@ namespace Benchmark
     }
     BENCHMARK(BM_UnorderedMap_InsertDuplicatesViaBracket);
 
+    // BM_HashedMap_XXX: node based unordered_map against the open addressing flat_unordered_map
+    // with type ids as keys, like the SerializeContext maps, for state.range(0) elements
+    using UuidUnorderedMap = AZStd::unordered_map<AZ::Uuid, int>;
+    using UuidFlatUnorderedMap = AZStd::flat_unordered_map<AZ::Uuid, int>;
+
+    template <class MapType>
+    static void FillUuidMap(MapType& map, AZStd::vector<AZ::Uuid>& keys, int64_t count)
+    {
+        keys.reserve(count);
+        for (int64_t i = 0; i < count; ++i)
+        {
+            keys.push_back(AZ::Uuid::CreateName(AZStd::string::format("BenchmarkType%lld", static_cast<long long>(i)).c_str()));
+            map.emplace(keys.back(), static_cast<int>(i));
+        }
+    }
+
+    template <class MapType>
+    static void BM_HashedMap_UuidLookupHit(::benchmark::State& state)
+    {
+        MapType map;
+        AZStd::vector<AZ::Uuid> keys;
+        FillUuidMap(map, keys, state.range(0));
+
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            auto it = map.find(keys[index]);
+            benchmark::DoNotOptimize(it->second);
+            index = (index + 7919) % keys.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidLookupHit, UuidUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidLookupHit, UuidFlatUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+
+    template <class MapType>
+    static void BM_HashedMap_UuidLookupMiss(::benchmark::State& state)
+    {
+        MapType map;
+        AZStd::vector<AZ::Uuid> keys;
+        FillUuidMap(map, keys, state.range(0));
+
+        AZStd::vector<AZ::Uuid> missingKeys;
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            missingKeys.push_back(AZ::Uuid::CreateName(AZStd::string::format("MissingType%lld", static_cast<long long>(i)).c_str()));
+        }
+
+        size_t index = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(map.find(missingKeys[index]) == map.end());
+            index = (index + 7919) % missingKeys.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidLookupMiss, UuidUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidLookupMiss, UuidFlatUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+
+    template <class MapType>
+    static void BM_HashedMap_UuidFill(::benchmark::State& state)
+    {
+        AZStd::vector<AZ::Uuid> keys;
+        {
+            MapType map;
+            FillUuidMap(map, keys, state.range(0));
+        }
+
+        for (auto _ : state)
+        {
+            MapType map;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                map.emplace(keys[i], static_cast<int>(i));
+            }
+            benchmark::DoNotOptimize(map.size());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidFill, UuidUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+    BENCHMARK_TEMPLATE(BM_HashedMap_UuidFill, UuidFlatUnorderedMap)->RangeMultiplier(16)->Range(16, 65536);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
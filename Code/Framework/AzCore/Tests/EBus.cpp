@@ -8,9 +8,11 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
@@ -1847,6 +1849,136 @@ namespace UnitTest
 
     }
 
+    namespace CommandQueueTest
+    {
+        class CommandQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            using MutexType = AZStd::mutex;
+            static const bool EnableEventQueue = true;
+            template <bool IsEnabled, class Bus, class QueueMutexType>
+            using QueuePolicy = AZ::EBusCommandQueuePolicy<IsEnabled, Bus, QueueMutexType>;
+            //////////////////////////////////////////////////////////////////////////
+
+            virtual ~CommandQueueEvents() = default;
+            virtual void OnMessage(int producer, int sequence) = 0;
+            virtual void OnSharedMessage(AZStd::shared_ptr<int> value) = 0;
+            virtual void OnBigMessage(const AZStd::array<int, 8192>& values) = 0;
+        };
+        using CommandQueueBus = AZ::EBus<CommandQueueEvents>;
+
+        static const int NumProducers = 4;
+
+        class CommandQueueHandler
+            : public CommandQueueBus::Handler
+        {
+        public:
+            CommandQueueHandler() { BusConnect(); }
+            ~CommandQueueHandler() override { BusDisconnect(); }
+
+            void OnMessage(int producer, int sequence) override
+            {
+                // calls queued from one thread are executed in order
+                EXPECT_EQ(m_nextSequence[producer], sequence);
+                m_nextSequence[producer] = sequence + 1;
+                ++m_numMessages;
+            }
+
+            void OnSharedMessage(AZStd::shared_ptr<int> value) override
+            {
+                m_sharedSum += *value;
+            }
+
+            void OnBigMessage(const AZStd::array<int, 8192>& values) override
+            {
+                m_sharedSum += values[0] + values[values.size() - 1];
+            }
+
+            int m_nextSequence[NumProducers] = {};
+            int m_numMessages = 0;
+            int m_sharedSum = 0;
+        };
+    }
+
+    TEST_F(QueueEbusTest, CommandQueuePolicy_MultipleProducers_ExecutesAllCallsInProducerOrder)
+    {
+        using namespace CommandQueueTest;
+        CommandQueueHandler handler;
+
+        const int numMessages = 20000;
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < NumProducers; ++producer)
+        {
+            producers.emplace_back([producer]()
+            {
+                for (int sequence = 0; sequence < numMessages; ++sequence)
+                {
+                    CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnMessage, producer, sequence);
+                }
+            });
+        }
+
+        // execute while the producers are queueing
+        while (handler.m_numMessages < NumProducers * numMessages)
+        {
+            CommandQueueBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        EXPECT_EQ(0, CommandQueueBus::QueuedEventCount());
+        for (int producer = 0; producer < NumProducers; ++producer)
+        {
+            EXPECT_EQ(numMessages, handler.m_nextSequence[producer]);
+        }
+    }
+
+    TEST_F(QueueEbusTest, CommandQueuePolicy_ClearAndExecute_DestroysQueuedArguments)
+    {
+        using namespace CommandQueueTest;
+        CommandQueueHandler handler;
+
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(3);
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnSharedMessage, value);
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnSharedMessage, value);
+        EXPECT_EQ(2, CommandQueueBus::QueuedEventCount());
+        EXPECT_EQ(3, value.use_count());
+
+        CommandQueueBus::ClearQueuedEvents();
+        EXPECT_EQ(0, CommandQueueBus::QueuedEventCount());
+        EXPECT_EQ(1, value.use_count());
+        EXPECT_EQ(0, handler.m_sharedSum);
+
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnSharedMessage, value);
+        CommandQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, value.use_count());
+        EXPECT_EQ(3, handler.m_sharedSum);
+    }
+
+    TEST_F(QueueEbusTest, CommandQueuePolicy_CallBiggerThanAChunk_IsExecuted)
+    {
+        using namespace CommandQueueTest;
+        CommandQueueHandler handler;
+
+        AZStd::array<int, 8192> values;
+        values.fill(0);
+        values[0] = 1;
+        values[values.size() - 1] = 2;
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnMessage, 0, 0);
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnBigMessage, values);
+        CommandQueueBus::QueueBroadcast(&CommandQueueBus::Events::OnMessage, 0, 1);
+        CommandQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(3, handler.m_sharedSum);
+        EXPECT_EQ(2, handler.m_numMessages);
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -3022,6 +3154,174 @@ namespace UnitTest
         ThrashLocklessDispatchNullMutex();
     }
 
+    namespace SnapshotDispatchTest
+    {
+        struct SnapshotEvents
+            : public AZ::EBusTraits
+        {
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+            static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::MultipleAndOrdered;
+            using BusIdType = int;
+            using MutexType = AZStd::recursive_mutex;
+            static const bool SnapshotDispatch = true;
+
+            virtual ~SnapshotEvents() = default;
+            virtual bool Compare(const SnapshotEvents* other) const = 0;
+            virtual void OnEvent(AZStd::vector<int>& calls) = 0;
+            virtual int GetOrder() = 0;
+            virtual void DisconnectHandlers() = 0;
+        };
+
+        using SnapshotBus = AZ::EBus<SnapshotEvents>;
+
+        static const AZ::u32 AliveMarker = 0xA11FE;
+
+        struct SnapshotHandler
+            : public SnapshotBus::Handler
+        {
+            SnapshotHandler(int id, int order)
+                : m_id(id)
+                , m_order(order)
+            {
+                BusConnect(id);
+            }
+
+            ~SnapshotHandler() override
+            {
+                BusDisconnect();
+                m_alive = 0;
+            }
+
+            bool Compare(const SnapshotEvents* other) const override
+            {
+                return m_order < static_cast<const SnapshotHandler*>(other)->m_order;
+            }
+
+            void OnEvent(AZStd::vector<int>& calls) override
+            {
+                EXPECT_EQ(AliveMarker, m_alive);
+                const int* busId = SnapshotBus::GetCurrentBusId();
+                EXPECT_TRUE(busId != nullptr && *busId == m_id);
+                calls.push_back(m_order);
+            }
+
+            int GetOrder() override
+            {
+                EXPECT_EQ(AliveMarker, m_alive);
+                ++m_numCalls;
+                return m_order;
+            }
+
+            void DisconnectHandlers() override
+            {
+                ++m_numCalls;
+                for (SnapshotHandler* handler : m_toDisconnect)
+                {
+                    handler->BusDisconnect();
+                }
+            }
+
+            int m_id;
+            int m_order;
+            AZStd::atomic_int m_numCalls{ 0 };
+            AZStd::vector<SnapshotHandler*> m_toDisconnect;
+            AZ::u32 m_alive = AliveMarker;
+        };
+    }
+
+    TEST_F(EBus, SnapshotDispatch_EventsAndBroadcasts_ReachConnectedHandlersInOrder)
+    {
+        using namespace SnapshotDispatchTest;
+        SnapshotHandler first(1, 0);
+        SnapshotHandler second(1, 1);
+        SnapshotHandler other(2, 2);
+
+        AZStd::vector<int> calls;
+        SnapshotBus::Event(1, &SnapshotEvents::OnEvent, calls);
+        EXPECT_EQ((AZStd::vector<int>{ 0, 1 }), calls);
+
+        calls.clear();
+        SnapshotBus::EventReverse(1, &SnapshotEvents::OnEvent, calls);
+        EXPECT_EQ((AZStd::vector<int>{ 1, 0 }), calls);
+
+        calls.clear();
+        SnapshotBus::Broadcast(&SnapshotEvents::OnEvent, calls);
+        EXPECT_EQ(3, calls.size());
+
+        AZ::EBusAggregateResults<int> results;
+        SnapshotBus::EventResult(results, 2, &SnapshotEvents::GetOrder);
+        EXPECT_EQ((AZStd::vector<int>{ 2 }), results.values);
+
+        second.BusDisconnect();
+        calls.clear();
+        SnapshotBus::Event(1, &SnapshotEvents::OnEvent, calls);
+        EXPECT_EQ((AZStd::vector<int>{ 0 }), calls);
+        EXPECT_EQ(1, SnapshotBus::GetNumOfEventHandlers(1));
+
+        calls.clear();
+        SnapshotBus::Event(3, &SnapshotEvents::OnEvent, calls);
+        EXPECT_TRUE(calls.empty());
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DisconnectDuringDispatch_DisconnectedHandlersAreSkipped)
+    {
+        using namespace SnapshotDispatchTest;
+        SnapshotHandler first(1, 0);
+        SnapshotHandler second(1, 1);
+        SnapshotHandler third(1, 2);
+        first.m_toDisconnect = { &first, &second, &third };
+
+        SnapshotBus::Broadcast(&SnapshotEvents::DisconnectHandlers);
+        EXPECT_EQ(1, first.m_numCalls);
+        EXPECT_EQ(0, second.m_numCalls);
+        EXPECT_EQ(0, third.m_numCalls);
+        EXPECT_FALSE(SnapshotBus::HasHandlers());
+
+        SnapshotBus::Broadcast(&SnapshotEvents::GetOrder);
+        EXPECT_EQ(1, first.m_numCalls);
+    }
+
+    TEST_F(EBus, SnapshotDispatch_ConnectDisconnectWhileDispatching_Multithread_Thrash)
+    {
+        using namespace SnapshotDispatchTest;
+        constexpr size_t threadCount = 8;
+        constexpr int cycleCount = 2000;
+        AZStd::thread threads[threadCount];
+
+        SnapshotHandler permanent(0, 0);
+        AZStd::atomic_int runningThreads{ threadCount };
+
+        auto work = [&runningThreads]()
+        {
+            for (int i = 0; i < cycleCount; ++i)
+            {
+                SnapshotBus::Broadcast(&SnapshotEvents::GetOrder);
+                SnapshotBus::Event(i & 3, &SnapshotEvents::GetOrder);
+            }
+            --runningThreads;
+        };
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread(work);
+        }
+
+        // handlers are destroyed right after they disconnect, while the other threads dispatch to them
+        for (int i = 0; runningThreads > 0; ++i)
+        {
+            AZStd::unique_ptr<SnapshotHandler> handler = AZStd::make_unique<SnapshotHandler>(i & 3, i);
+            AZStd::this_thread::yield();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // every broadcast reaches the permanent handler
+        EXPECT_LE(threadCount * cycleCount, static_cast<size_t>(permanent.m_numCalls));
+    }
+
     namespace EBusResultsTest
     {
         class ResultClass
@@ -3488,6 +3788,66 @@ namespace UnitTest
         handlerTest.BusConnect();
     }
 
+    class MultiBusWithConnectionPolicy
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = int;
+
+        virtual ~MultiBusWithConnectionPolicy() = default;
+
+        virtual void MessageWhichOccursDuringDisconnect() = 0;
+
+        template<class Bus>
+        struct ConnectionPolicy : public AZ::EBusConnectionPolicy<Bus>
+        {
+            static void Disconnect(typename Bus::Context&, typename Bus::HandlerNode& handler, typename Bus::BusPtr&)
+            {
+                handler->MessageWhichOccursDuringDisconnect();
+            }
+        };
+    };
+    using MultiBusWithConnectionPolicyBus = AZ::EBus<MultiBusWithConnectionPolicy>;
+
+    class MultiHandlerWhichConnectsDuringDisconnect
+        : public MultiBusWithConnectionPolicyBus::MultiHandler
+    {
+    public:
+        static const int NumReconnects = 64;
+
+        void MessageWhichOccursDuringDisconnect() override
+        {
+            if (!m_isReconnecting)
+            {
+                // Connect to enough new addresses to have the handler's map grow while the disconnect is in progress.
+                m_isReconnecting = true;
+                for (int id = 1; id <= NumReconnects; ++id)
+                {
+                    BusConnect(id);
+                }
+            }
+        }
+
+        bool m_isReconnecting{ false };
+    };
+
+    TEST_F(EBus, ConnectionPolicy_MultiHandlerConnectsDuringDisconnect)
+    {
+        MultiHandlerWhichConnectsDuringDisconnect handlerTest;
+        handlerTest.BusConnect(0);
+        handlerTest.BusDisconnect(0);
+
+        EXPECT_FALSE(handlerTest.BusIsConnectedId(0));
+        for (int id = 1; id <= MultiHandlerWhichConnectsDuringDisconnect::NumReconnects; ++id)
+        {
+            EXPECT_TRUE(handlerTest.BusIsConnectedId(id));
+        }
+        EXPECT_EQ(MultiHandlerWhichConnectsDuringDisconnect::NumReconnects, MultiBusWithConnectionPolicyBus::GetTotalNumOfEventHandlers());
+
+        handlerTest.BusDisconnect();
+    }
+
     class BusWithConnectionPolicyUnlocksBeforeHandler
         : public AZ::EBusTraits
     {
@@ -4500,6 +4860,222 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Queue policies
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace QueuePolicyBenchmark
+    {
+        static AZStd::atomic<size_t> s_numAllocations{ 0 };
+
+        // Counts the allocations of the bus (and its queue)
+        class CountingAllocator
+            : public AZStd::allocator
+        {
+        public:
+            CountingAllocator(const char* name = "EBusQueueBenchmarkAllocator")
+                : AZStd::allocator(name)
+            {
+            }
+
+            pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+            {
+                s_numAllocations.fetch_add(1, AZStd::memory_order_relaxed);
+                return AZStd::allocator::allocate(byteSize, alignment, flags);
+            }
+        };
+
+        class Events
+        {
+        public:
+            virtual ~Events() = default;
+            virtual void OnMessage(int entityId, float x, float y, float z) = 0;
+        };
+
+        template <template <bool, class, class> class QueuePolicyType>
+        class Traits
+            : public AZ::EBusTraits
+        {
+        public:
+            using AllocatorType = CountingAllocator;
+            using MutexType = AZStd::mutex;
+            static const bool EnableEventQueue = true;
+            template <bool IsEnabled, class Bus, class QueueMutexType>
+            using QueuePolicy = QueuePolicyType<IsEnabled, Bus, QueueMutexType>;
+        };
+
+        using FunctionQueueBus = AZ::EBus<Events, Traits<AZ::EBusQueuePolicy>>;
+        using CommandQueueBus = AZ::EBus<Events, Traits<AZ::EBusCommandQueuePolicy>>;
+
+        template <typename Bus>
+        class MessageHandler
+            : public Bus::Handler
+        {
+        public:
+            MessageHandler() { this->BusConnect(); }
+            ~MessageHandler() override { this->BusDisconnect(); }
+
+            void OnMessage(int entityId, float x, float y, float z) override
+            {
+                m_sum += entityId + x + y + z;
+            }
+
+            float m_sum = 0.0f;
+        };
+
+        static const int64_t MessagesPerBatch = 1024;
+    }
+
+    // Queues a batch of events and executes them, reports the allocations per message
+    template <typename Bus>
+    static void BM_EBus_QueuePolicy_QueueAndExecute(::benchmark::State& state)
+    {
+        using namespace QueuePolicyBenchmark;
+        MessageHandler<Bus> handler;
+
+        // warm up the queue
+        Bus::QueueBroadcast(&Bus::Events::OnMessage, 0, 0.0f, 0.0f, 0.0f);
+        Bus::ExecuteQueuedEvents();
+
+        s_numAllocations = 0;
+        for (auto _ : state)
+        {
+            for (int64_t i = 0; i < MessagesPerBatch; ++i)
+            {
+                Bus::QueueBroadcast(&Bus::Events::OnMessage, static_cast<int>(i), 1.0f, 2.0f, 3.0f);
+            }
+            Bus::ExecuteQueuedEvents();
+        }
+
+        const int64_t numMessages = state.iterations() * MessagesPerBatch;
+        state.SetItemsProcessed(numMessages);
+        state.counters["AllocationsPerMessage"] = static_cast<double>(s_numAllocations.load()) / static_cast<double>(numMessages);
+        ::benchmark::DoNotOptimize(handler.m_sum);
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_QueuePolicy_QueueAndExecute, QueuePolicyBenchmark::FunctionQueueBus)->Apply(&BenchmarkSettings::Common);
+    BENCHMARK_TEMPLATE(BM_EBus_QueuePolicy_QueueAndExecute, QueuePolicyBenchmark::CommandQueueBus)->Apply(&BenchmarkSettings::Common);
+
+    // Several threads queue events while the first thread also executes them
+    template <typename Bus>
+    static void BM_EBus_QueuePolicy_Multithreaded(::benchmark::State& state)
+    {
+        using namespace QueuePolicyBenchmark;
+        AZStd::unique_ptr<MessageHandler<Bus>> handler;
+        if (state.thread_index == 0)
+        {
+            handler = AZStd::make_unique<MessageHandler<Bus>>();
+            s_numAllocations = 0;
+        }
+
+        for (auto _ : state)
+        {
+            for (int64_t i = 0; i < MessagesPerBatch; ++i)
+            {
+                Bus::QueueBroadcast(&Bus::Events::OnMessage, static_cast<int>(i), 1.0f, 2.0f, 3.0f);
+            }
+            if (state.thread_index == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        }
+
+        const int64_t numMessages = state.iterations() * MessagesPerBatch;
+        state.SetItemsProcessed(numMessages);
+        if (state.thread_index == 0)
+        {
+            Bus::ExecuteQueuedEvents();
+            state.counters["AllocationsPerMessage"] = ::benchmark::Counter(static_cast<double>(s_numAllocations.load()) / static_cast<double>(numMessages * state.threads));
+            handler.reset();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_QueuePolicy_Multithreaded, QueuePolicyBenchmark::FunctionQueueBus)->Apply(&BenchmarkSettings::Common)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_QueuePolicy_Multithreaded, QueuePolicyBenchmark::CommandQueueBus)->Apply(&BenchmarkSettings::Common)->ThreadRange(1, 8)->UseRealTime();
+
+    //////////////////////////////////////////////////////////////////////////
+    // Dispatch contention
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace DispatchContentionBenchmark
+    {
+        class Events
+        {
+        public:
+            virtual ~Events() = default;
+            virtual int GetValue() const = 0;
+        };
+
+        template <bool locklessDispatch, bool snapshotDispatch>
+        class Traits
+            : public AZ::EBusTraits
+        {
+        public:
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+            using BusIdType = int;
+            using MutexType = AZStd::recursive_mutex;
+            static const bool LocklessDispatch = locklessDispatch;
+            static const bool SnapshotDispatch = snapshotDispatch;
+        };
+
+        using LockedBus = AZ::EBus<Events, Traits<false, false>>;
+        using LocklessBus = AZ::EBus<Events, Traits<true, false>>;
+        using SnapshotBus = AZ::EBus<Events, Traits<false, true>>;
+
+        template <typename Bus>
+        class ValueHandler
+            : public Bus::Handler
+        {
+        public:
+            ValueHandler(int id, int value) : m_value(value) { this->BusConnect(id); }
+            ~ValueHandler() override { this->BusDisconnect(); }
+
+            int GetValue() const override { return m_value; }
+
+        private:
+            int m_value;
+        };
+
+        static const int NumAddresses = 16;
+        static const int HandlersPerAddress = 4;
+    }
+
+    // Every thread sends read only events to one address and broadcasts, which only measures the cost of the synchronization of the dispatch
+    template <typename Bus>
+    static void BM_EBus_DispatchContention(::benchmark::State& state)
+    {
+        using namespace DispatchContentionBenchmark;
+        AZStd::vector<AZStd::unique_ptr<ValueHandler<Bus>>> handlers;
+        if (state.thread_index == 0)
+        {
+            for (int id = 0; id < NumAddresses; ++id)
+            {
+                for (int handler = 0; handler < HandlersPerAddress; ++handler)
+                {
+                    handlers.emplace_back(AZStd::make_unique<ValueHandler<Bus>>(id, handler));
+                }
+            }
+        }
+
+        const int id = state.thread_index % NumAddresses;
+        int sum = 0;
+        for (auto _ : state)
+        {
+            AZ::EBusAggregateResults<int> results;
+            Bus::EventResult(results, id, &Events::GetValue);
+            Bus::Broadcast(&Events::GetValue);
+            sum += static_cast<int>(results.values.size());
+        }
+        ::benchmark::DoNotOptimize(sum);
+
+        state.SetItemsProcessed(state.iterations() * 2);
+        if (state.thread_index == 0)
+        {
+            handlers.clear();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_DispatchContention, DispatchContentionBenchmark::LockedBus)->ThreadRange(1, 64)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_DispatchContention, DispatchContentionBenchmark::LocklessBus)->ThreadRange(1, 64)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_DispatchContention, DispatchContentionBenchmark::SnapshotBus)->ThreadRange(1, 64)->UseRealTime();
 }
 
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Time source advanced by hand, so that every run expires the same events per tick
+    class ScheduledEventBenchmarkTime
+        : public AZ::ITime
+    {
+    public:
+        ScheduledEventBenchmarkTime() { AZ::Interface<AZ::ITime>::Register(this); }
+        ~ScheduledEventBenchmarkTime() override { AZ::Interface<AZ::ITime>::Unregister(this); }
+        AZ::TimeMs GetElapsedTimeMs() const override { return m_timeMs; }
+
+        AZ::TimeMs m_timeMs = AZ::TimeMs{ 0 };
+    };
+
+    //! Schedules state.range(1) events with durations spread over a minute, on a scheduler using the queue type state.range(0)
+    class ScheduledEventBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        static constexpr int64_t MaxDurationMs = 60000;
+        static constexpr int64_t FrameTimeMs = 16;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::NameDictionary::Create();
+
+            m_time = new ScheduledEventBenchmarkTime;
+            m_eventScheduler = new AZ::EventSchedulerSystemComponent(static_cast<AZ::EventSchedulerQueueType>(state.range(0)));
+
+            const size_t eventCount = static_cast<size_t>(state.range(1));
+            const AZ::Name eventName("ScheduledEventBenchmark");
+            m_events = new AZStd::vector<AZ::ScheduledEvent>();
+            m_events->reserve(eventCount);
+            for (size_t i = 0; i < eventCount; ++i)
+            {
+                m_events->emplace_back([this] { ++m_triggerCount; }, eventName);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_events;
+            delete m_eventScheduler;
+            delete m_time;
+
+            AZ::NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Deterministic pseudo random duration in [1, MaxDurationMs]
+        AZ::TimeMs NextDuration()
+        {
+            m_random = m_random * 6364136223846793005ull + 1442695040888963407ull;
+            return AZ::TimeMs{ 1 + static_cast<int64_t>((m_random >> 33) % MaxDurationMs) };
+        }
+
+        void EnqueueAll()
+        {
+            for (AZ::ScheduledEvent& event : *m_events)
+            {
+                event.Enqueue(NextDuration());
+            }
+        }
+
+        void RemoveAll()
+        {
+            for (AZ::ScheduledEvent& event : *m_events)
+            {
+                event.RemoveFromQueue();
+            }
+        }
+
+        ScheduledEventBenchmarkTime* m_time = nullptr;
+        AZ::EventSchedulerSystemComponent* m_eventScheduler = nullptr;
+        AZStd::vector<AZ::ScheduledEvent>* m_events = nullptr;
+        uint64_t m_random = 0;
+        int64_t m_triggerCount = 0;
+    };
+
+    static void ScheduledEventBenchmarkArgs(benchmark::internal::Benchmark* b)
+    {
+        for (AZ::EventSchedulerQueueType queueType : { AZ::EventSchedulerQueueType::PriorityQueue, AZ::EventSchedulerQueueType::TimingWheel })
+        {
+            for (int64_t eventCount : { 100000, 1000000 })
+            {
+                b->Args({ static_cast<int64_t>(queueType), eventCount });
+            }
+        }
+        b->ArgNames({ "QueueType", "Events" })->Unit(benchmark::kMillisecond);
+    }
+
+    // Schedules and then cancels every event
+    BENCHMARK_DEFINE_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_EnqueueRemove)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            EnqueueAll();
+            RemoveAll();
+
+            // Let the priority queue drop its cancelled handles
+            state.PauseTiming();
+            m_time->m_timeMs += AZ::TimeMs{ MaxDurationMs + 1 };
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK_REGISTER_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_EnqueueRemove)->Apply(ScheduledEventBenchmarkArgs);
+
+    // Moves every queued event to a new execution time, like timeouts being extended by incoming traffic
+    BENCHMARK_DEFINE_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_Requeue)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            EnqueueAll();
+            state.ResumeTiming();
+
+            for (AZ::ScheduledEvent& event : *m_events)
+            {
+                event.Requeue(NextDuration());
+            }
+
+            // Trigger everything so that the priority queue drops the handles it couldn't remove
+            state.PauseTiming();
+            m_time->m_timeMs += AZ::TimeMs{ MaxDurationMs + 1 };
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK_REGISTER_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_Requeue)->Apply(ScheduledEventBenchmarkArgs);
+
+    // Ticks at 60Hz until every event has triggered, the cost of expiring all the events in frame sized batches
+    BENCHMARK_DEFINE_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_Expire)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            EnqueueAll();
+            const AZ::TimeMs endTimeMs = m_time->m_timeMs + AZ::TimeMs{ MaxDurationMs };
+            state.ResumeTiming();
+
+            while (m_time->m_timeMs < endTimeMs)
+            {
+                m_time->m_timeMs += AZ::TimeMs{ FrameTimeMs };
+                m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+        benchmark::DoNotOptimize(m_triggerCount);
+    }
+    BENCHMARK_REGISTER_F(ScheduledEventBenchmarkFixture, BM_ScheduledEvent_Expire)->Apply(ScheduledEventBenchmarkArgs);
+}
+#endif // HAVE_BENCHMARK
@@ -101,4 +101,216 @@ namespace UnitTest
         // Use EXPECT_GT in case the OS oversleeps long enough to cause unexpected extra timer pops
         EXPECT_GT(m_requeuedEventTriggerCount, 1);
     }
+
+    //! Time source advanced by hand, so that scheduling is deterministic
+    class ManualTime
+        : public AZ::ITime
+    {
+    public:
+        ManualTime()
+        {
+            AZ::Interface<AZ::ITime>::Register(this);
+        }
+
+        ~ManualTime() override
+        {
+            AZ::Interface<AZ::ITime>::Unregister(this);
+        }
+
+        AZ::TimeMs GetElapsedTimeMs() const override
+        {
+            return m_timeMs;
+        }
+
+        AZ::TimeMs m_timeMs = AZ::TimeMs{ 1000 };
+    };
+
+    class ScheduledEventQueueTypeTests
+        : public AllocatorsFixture
+        , public ::testing::WithParamInterface<AZ::EventSchedulerQueueType>
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+
+            m_time = new ManualTime;
+            m_eventSchedulerComponent = new AZ::EventSchedulerSystemComponent(GetParam());
+        }
+
+        void TearDown() override
+        {
+            delete m_eventSchedulerComponent;
+            delete m_time;
+
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        //! Advances the time in steps of stepMs, ticking the scheduler after each step
+        void Run(AZ::TimeMs durationMs, AZ::TimeMs stepMs)
+        {
+            const AZ::TimeMs endTimeMs = m_time->m_timeMs + durationMs;
+            while (m_time->m_timeMs < endTimeMs)
+            {
+                m_time->m_timeMs = AZStd::min(m_time->m_timeMs + stepMs, endTimeMs);
+                m_eventSchedulerComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            }
+        }
+
+        ManualTime* m_time = nullptr;
+        AZ::EventSchedulerSystemComponent* m_eventSchedulerComponent = nullptr;
+    };
+
+    TEST_P(ScheduledEventQueueTypeTests, Enqueue_EventsFireInExecutionOrderAfterTheirDuration)
+    {
+        // Durations spread over every level of the timing wheel
+        const AZ::TimeMs durations[] = { AZ::TimeMs{ 70000 }, AZ::TimeMs{ 0 }, AZ::TimeMs{ 300 }, AZ::TimeMs{ 20000000 }, AZ::TimeMs{ 1 }, AZ::TimeMs{ 255 }, AZ::TimeMs{ 65536 } };
+        constexpr size_t EventCount = AZ_ARRAY_SIZE(durations);
+
+        const AZ::TimeMs startTimeMs = m_time->m_timeMs;
+        AZStd::vector<AZ::TimeMs> fireTimes(EventCount, AZ::TimeMs{ -1 });
+        AZStd::vector<size_t> fireOrder;
+        AZStd::vector<AZStd::unique_ptr<AZ::ScheduledEvent>> events;
+        for (size_t i = 0; i < EventCount; ++i)
+        {
+            events.emplace_back(AZStd::make_unique<AZ::ScheduledEvent>([this, i, &fireTimes, &fireOrder]
+            {
+                fireTimes[i] = m_time->m_timeMs;
+                fireOrder.push_back(i);
+            }, AZ::Name("UnitTestEvent")));
+            events[i]->Enqueue(durations[i]);
+        }
+        EXPECT_EQ(EventCount, m_eventSchedulerComponent->GetQueueSize());
+
+        Run(AZ::TimeMs{ 20000100 }, AZ::TimeMs{ 7 });
+
+        for (size_t i = 0; i < EventCount; ++i)
+        {
+            EXPECT_GE(fireTimes[i], startTimeMs + durations[i]);
+            EXPECT_LE(fireTimes[i], startTimeMs + durations[i] + AZ::TimeMs{ 7 });
+            EXPECT_FALSE(events[i]->IsScheduled());
+        }
+        const size_t expectedOrder[] = { 1, 4, 5, 2, 6, 0, 3 };
+        ASSERT_EQ(EventCount, fireOrder.size());
+        for (size_t i = 0; i < EventCount; ++i)
+        {
+            EXPECT_EQ(expectedOrder[i], fireOrder[i]);
+        }
+        EXPECT_EQ(0, m_eventSchedulerComponent->GetQueueSize());
+        EXPECT_EQ(m_eventSchedulerComponent->GetHandleCount(), m_eventSchedulerComponent->GetFreeHandleCount());
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, RemoveFromQueue_EventDoesNotFire)
+    {
+        uint32_t triggerCount = 0;
+        AZ::ScheduledEvent removedEvent([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent removed"));
+        removedEvent.Enqueue(AZ::TimeMs{ 100 });
+        {
+            AZ::ScheduledEvent deletedEvent([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent deleted"));
+            deletedEvent.Enqueue(AZ::TimeMs{ 100 });
+        }
+        removedEvent.RemoveFromQueue();
+        EXPECT_FALSE(removedEvent.IsScheduled());
+
+        Run(AZ::TimeMs{ 200 }, AZ::TimeMs{ 10 });
+        EXPECT_EQ(0, triggerCount);
+        EXPECT_EQ(m_eventSchedulerComponent->GetHandleCount(), m_eventSchedulerComponent->GetFreeHandleCount());
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, Requeue_WhileQueued_FiresOnceAtTheNewTime)
+    {
+        AZ::TimeMs fireTimeMs{ 0 };
+        uint32_t triggerCount = 0;
+        AZ::ScheduledEvent event([this, &fireTimeMs, &triggerCount] { fireTimeMs = m_time->m_timeMs; ++triggerCount; }, AZ::Name("UnitTestEvent"));
+        const AZ::TimeMs startTimeMs = m_time->m_timeMs;
+        event.Enqueue(AZ::TimeMs{ 50 });
+        event.Requeue(AZ::TimeMs{ 500 });
+
+        Run(AZ::TimeMs{ 1000 }, AZ::TimeMs{ 1 });
+        EXPECT_EQ(1, triggerCount);
+        EXPECT_EQ(startTimeMs + AZ::TimeMs{ 500 }, fireTimeMs);
+        EXPECT_EQ(m_eventSchedulerComponent->GetHandleCount(), m_eventSchedulerComponent->GetFreeHandleCount());
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, AutoRequeue_FiresEveryInterval)
+    {
+        uint32_t triggerCount = 0;
+        AZ::ScheduledEvent event([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent auto Requeue"));
+        event.Enqueue(AZ::TimeMs{ 100 }, true);
+
+        Run(AZ::TimeMs{ 1050 }, AZ::TimeMs{ 10 });
+        EXPECT_EQ(10, triggerCount);
+        EXPECT_TRUE(event.IsScheduled());
+
+        event.RemoveFromQueue();
+        Run(AZ::TimeMs{ 500 }, AZ::TimeMs{ 10 });
+        EXPECT_EQ(10, triggerCount);
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, DeleteEventDuringCallback_HandleIsReleased)
+    {
+        AZ::ScheduledEvent* event = nullptr;
+        event = new AZ::ScheduledEvent([&event]
+        {
+            AZ::ScheduledEvent* self = event;
+            event = nullptr;
+            delete self;
+        }, AZ::Name("UnitTestEvent self delete"));
+        event->Enqueue(AZ::TimeMs{ 10 }, true);
+
+        Run(AZ::TimeMs{ 100 }, AZ::TimeMs{ 10 });
+        EXPECT_EQ(nullptr, event);
+        EXPECT_EQ(0, m_eventSchedulerComponent->GetQueueSize());
+        EXPECT_EQ(m_eventSchedulerComponent->GetHandleCount(), m_eventSchedulerComponent->GetFreeHandleCount());
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, AddCallback_ManyCallbacks_AllFire)
+    {
+        constexpr uint32_t CallbackCount = 10000;
+        uint32_t triggerCount = 0;
+        for (uint32_t i = 0; i < CallbackCount; ++i)
+        {
+            m_eventSchedulerComponent->AddCallback([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent callback"), AZ::TimeMs{ aznumeric_cast<int64_t>(i * 37 % 100000) });
+        }
+
+        Run(AZ::TimeMs{ 50000 }, AZ::TimeMs{ 16 });
+        EXPECT_GT(triggerCount, 0);
+        EXPECT_LT(triggerCount, CallbackCount);
+
+        Run(AZ::TimeMs{ 50016 }, AZ::TimeMs{ 16 });
+        EXPECT_EQ(CallbackCount, triggerCount);
+        EXPECT_EQ(0, m_eventSchedulerComponent->GetQueueSize());
+    }
+
+    TEST_P(ScheduledEventQueueTypeTests, SetQueueType_QueuedEventsAreMovedOver)
+    {
+        uint32_t triggerCount = 0;
+        AZ::ScheduledEvent shortEvent([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent short"));
+        AZ::ScheduledEvent longEvent([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent long"));
+        AZ::ScheduledEvent removedEvent([&triggerCount] { ++triggerCount; }, AZ::Name("UnitTestEvent removed"));
+        shortEvent.Enqueue(AZ::TimeMs{ 0 });
+        longEvent.Enqueue(AZ::TimeMs{ 100000 });
+        removedEvent.Enqueue(AZ::TimeMs{ 10 });
+        removedEvent.RemoveFromQueue();
+
+        const AZ::EventSchedulerQueueType otherType = (GetParam() == AZ::EventSchedulerQueueType::TimingWheel)
+            ? AZ::EventSchedulerQueueType::PriorityQueue
+            : AZ::EventSchedulerQueueType::TimingWheel;
+        m_eventSchedulerComponent->SetQueueType(otherType);
+        EXPECT_EQ(otherType, m_eventSchedulerComponent->GetQueueType());
+        EXPECT_EQ(2, m_eventSchedulerComponent->GetQueueSize());
+
+        Run(AZ::TimeMs{ 1 }, AZ::TimeMs{ 1 });
+        EXPECT_EQ(1, triggerCount);
+        Run(AZ::TimeMs{ 100000 }, AZ::TimeMs{ 100 });
+        EXPECT_EQ(2, triggerCount);
+        EXPECT_EQ(m_eventSchedulerComponent->GetHandleCount(), m_eventSchedulerComponent->GetFreeHandleCount());
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        ScheduledEvent,
+        ScheduledEventQueueTypeTests,
+        ::testing::Values(AZ::EventSchedulerQueueType::PriorityQueue, AZ::EventSchedulerQueueType::TimingWheel));
 }
@@ -5,12 +5,15 @@
  *
  */
 
+#include <AzCore/Jobs/CpuTopology.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobCompletionSpin.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/LegacyJobExecutor.h>
 #include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/Internal/JobTrace.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/std/delegate/delegate.h>
@@ -20,17 +23,23 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/fixed_list.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/time.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+#include <algorithm>
 #include <random>
 
 #if AZ_TRAIT_SUPPORTS_MICROSOFT_PPL
@@ -1135,6 +1144,123 @@ namespace UnitTest
         run();
     }
 
+    class JobParallelAlgorithmsTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        static AZStd::vector<int> MakeRandomValues(size_t numValues, AZ::u64 seed)
+        {
+            AZStd::vector<int> values(numValues);
+            AZ::SimpleLcgRandom random(seed);
+            for (int& value : values)
+            {
+                value = static_cast<int>(random.GetRandom() % 100000) - 50000;
+            }
+            return values;
+        }
+
+        // sizes around the block size and ones that don't split evenly
+        static constexpr size_t s_sizes[] = { 0, 1, 7, 1023, 1024, 1025, 5000, 100003 };
+    };
+
+    TEST_F(JobParallelAlgorithmsTest, Reduce_MatchesSerialAccumulate)
+    {
+        for (size_t size : s_sizes)
+        {
+            AZStd::vector<int> values = MakeRandomValues(size, size);
+            const AZ::s64 expected = AZStd::accumulate(values.begin(), values.end(), AZ::s64(3));
+            EXPECT_EQ(expected, parallel_reduce(values.begin(), values.end(), AZ::s64(3), [](AZ::s64 lhs, AZ::s64 rhs) { return lhs + rhs; }));
+            EXPECT_EQ(expected, parallel_reduce(values.begin(), values.end(), AZ::s64(3), [](AZ::s64 lhs, AZ::s64 rhs) { return lhs + rhs; },
+                static_partitioner()));
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, Reduce_NonCommutativeOperationKeepsOrder)
+    {
+        const int numValues = 4000;
+        AZStd::vector<AZStd::string> values(numValues);
+        AZStd::string expected;
+        for (int i = 0; i < numValues; ++i)
+        {
+            values[i] = AZStd::string::format("%d,", i);
+            expected += values[i];
+        }
+        EXPECT_EQ(expected, parallel_reduce(values.begin(), values.end(), AZStd::string(), AZStd::plus<>()));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, InclusiveScan_MatchesSerialScan)
+    {
+        for (size_t size : s_sizes)
+        {
+            AZStd::vector<int> values = MakeRandomValues(size, size);
+            AZStd::vector<int> expected(size);
+            int sum = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                sum += values[i];
+                expected[i] = sum;
+            }
+
+            AZStd::vector<int> result(size);
+            EXPECT_EQ(result.end(), parallel_inclusive_scan(values.begin(), values.end(), result.begin()));
+            EXPECT_EQ(expected, result);
+
+            // in place
+            parallel_inclusive_scan(values.begin(), values.end(), values.begin(), AZStd::plus<>(), simple_partitioner(2048));
+            EXPECT_EQ(expected, values);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, Sort_MatchesSerialSort)
+    {
+        for (size_t size : s_sizes)
+        {
+            AZStd::vector<int> values = MakeRandomValues(size, size);
+            AZStd::vector<int> expected = values;
+            AZStd::sort(expected.begin(), expected.end());
+
+            AZStd::vector<int> autoSorted = values;
+            parallel_sort(autoSorted.begin(), autoSorted.end());
+            EXPECT_EQ(expected, autoSorted);
+
+            AZStd::vector<int> staticSorted = values;
+            parallel_sort(staticSorted.begin(), staticSorted.end(), AZStd::less<>(), static_partitioner());
+            EXPECT_EQ(expected, staticSorted);
+
+            AZStd::sort(expected.begin(), expected.end(), AZStd::greater<>());
+            parallel_sort(values.begin(), values.end(), AZStd::greater<>(), simple_partitioner(1500));
+            EXPECT_EQ(expected, values);
+        }
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, Sort_ManyDuplicates)
+    {
+        AZStd::vector<int> values = MakeRandomValues(50000, 1);
+        for (int& value : values)
+        {
+            value %= 4;
+        }
+        AZStd::vector<int> expected = values;
+        AZStd::sort(expected.begin(), expected.end());
+        parallel_sort(values.begin(), values.end());
+        EXPECT_EQ(expected, values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, Partition_IsStable)
+    {
+        auto isEven = [](int value) { return value % 2 == 0; };
+        for (size_t size : s_sizes)
+        {
+            AZStd::vector<int> values = MakeRandomValues(size, size);
+            AZStd::vector<int> expected = values;
+            const size_t numEven = std::stable_partition(expected.begin(), expected.end(), isEven) - expected.begin();
+
+            auto partitionPoint = parallel_partition(values.begin(), values.end(), isEven);
+            EXPECT_EQ(numEven, static_cast<size_t>(partitionPoint - values.begin()));
+            EXPECT_EQ(expected, values);
+        }
+    }
+
     class PERF_JobParallelForOverheadTest
         : public DefaultJobManagerSetupFixture
     {
@@ -1651,6 +1777,368 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class JobPriorityClassTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobPriorityClassTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize job execution
+        {
+        }
+
+        void StartJob(JobPriorityClass priorityClass, const char* name, AZStd::binary_semaphore& binarySemaphore, AZStd::vector<AZStd::string>& namesOfProcessedJobs)
+        {
+            Job* job = aznew TestJobWithPriority(0, name, m_jobContext, binarySemaphore, namesOfProcessedJobs);
+            job->SetPriorityClass(priorityClass);
+            job->Start();
+        }
+    };
+
+    TEST_F(JobPriorityClassTestFixture, JobsRunInPriorityClassOrder)
+    {
+        AZStd::vector<AZStd::string> namesOfProcessedJobs;
+
+        // As in JobPriorityTestFixture, the first job blocks the lone worker until all the other jobs are queued
+        AZStd::binary_semaphore binarySemaphore;
+        StartJob(JobPriorityClass::Critical, "FirstJobQueued", binarySemaphore, namesOfProcessedJobs);
+
+        StartJob(JobPriorityClass::Background, "Background1", binarySemaphore, namesOfProcessedJobs);
+        StartJob(JobPriorityClass::Normal, "Normal1", binarySemaphore, namesOfProcessedJobs);
+        StartJob(JobPriorityClass::Critical, "Critical1", binarySemaphore, namesOfProcessedJobs);
+        StartJob(JobPriorityClass::Background, "Background2", binarySemaphore, namesOfProcessedJobs);
+        StartJob(JobPriorityClass::Normal, "Normal2", binarySemaphore, namesOfProcessedJobs);
+        StartJob(JobPriorityClass::Critical, "Critical2", binarySemaphore, namesOfProcessedJobs);
+
+        binarySemaphore.release();
+        while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+
+        ASSERT_EQ(namesOfProcessedJobs.size(), 7);
+        EXPECT_EQ(namesOfProcessedJobs[0], "FirstJobQueued");
+        EXPECT_EQ(namesOfProcessedJobs[1], "Critical1");
+        EXPECT_EQ(namesOfProcessedJobs[2], "Critical2");
+        EXPECT_EQ(namesOfProcessedJobs[3], "Normal1");
+        EXPECT_EQ(namesOfProcessedJobs[4], "Normal2");
+        EXPECT_EQ(namesOfProcessedJobs[5], "Background1");
+        EXPECT_EQ(namesOfProcessedJobs[6], "Background2");
+    }
+
+    TEST_F(JobPriorityClassTestFixture, BackgroundJobIsNotStarvedByCriticalJobs)
+    {
+        constexpr int numCriticalJobs = 64;
+        AZStd::vector<AZStd::string> namesOfProcessedJobs;
+
+        AZStd::binary_semaphore binarySemaphore;
+        StartJob(JobPriorityClass::Critical, "FirstJobQueued", binarySemaphore, namesOfProcessedJobs);
+
+        StartJob(JobPriorityClass::Background, "Background", binarySemaphore, namesOfProcessedJobs);
+        for (int i = 0; i < numCriticalJobs; ++i)
+        {
+            StartJob(JobPriorityClass::Critical, "Critical", binarySemaphore, namesOfProcessedJobs);
+        }
+
+        binarySemaphore.release();
+        while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+
+        // the background job must get a turn before the critical jobs are all done
+        auto backgroundJob = AZStd::find(namesOfProcessedJobs.begin(), namesOfProcessedJobs.end(), "Background");
+        ASSERT_NE(backgroundJob, namesOfProcessedJobs.end());
+        EXPECT_LT(AZStd::distance(namesOfProcessedJobs.begin(), backgroundJob), numCriticalJobs);
+    }
+
+    TEST_F(JobPriorityClassTestFixture, JobsInheritPriorityClassFromContext)
+    {
+        JobContext backgroundContext(*m_jobManager, JobPriorityClass::Background);
+        AZStd::binary_semaphore binarySemaphore;
+        AZStd::vector<AZStd::string> namesOfProcessedJobs;
+        Job* job = aznew TestJobWithPriority(0, "Background", &backgroundContext, binarySemaphore, namesOfProcessedJobs);
+        EXPECT_EQ(JobPriorityClass::Background, job->GetPriorityClass());
+        binarySemaphore.release();
+        job->Start();
+        while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+    }
+
+    class CpuTopologyTest
+        : public AllocatorsTestFixture
+    {
+    protected:
+        static CpuTopology::LogicalCpu MakeCpu(int cpuId, int coreId, int packageId, int numaNode, int cacheDomain)
+        {
+            CpuTopology::LogicalCpu cpu;
+            cpu.m_cpuId = cpuId;
+            cpu.m_coreId = coreId;
+            cpu.m_packageId = packageId;
+            cpu.m_numaNode = numaNode;
+            cpu.m_cacheDomain = cacheDomain;
+            return cpu;
+        }
+    };
+
+    TEST_F(CpuTopologyTest, PlacementUsesEveryPhysicalCoreBeforeSmtSiblings)
+    {
+        // 2 sockets with 2 cores each and 2 hardware threads per core, siblings numbered like the Linux kernel does
+        CpuTopology topology;
+        for (int cpuId = 0; cpuId < 8; ++cpuId)
+        {
+            const int package = (cpuId / 2) % 2;
+            topology.m_cpus.push_back(MakeCpu(cpuId, cpuId % 2, package, package, package * 2));
+        }
+
+        AZStd::vector<int> order = topology.GetWorkerPlacementOrder();
+        ASSERT_EQ(8, order.size());
+        // one hardware thread per core, grouped by socket
+        EXPECT_EQ(0, order[0]);
+        EXPECT_EQ(1, order[1]);
+        EXPECT_EQ(2, order[2]);
+        EXPECT_EQ(3, order[3]);
+        // then the siblings
+        EXPECT_EQ(4, order[4]);
+        EXPECT_EQ(5, order[5]);
+        EXPECT_EQ(6, order[6]);
+        EXPECT_EQ(7, order[7]);
+    }
+
+    TEST_F(CpuTopologyTest, FindCpu)
+    {
+        CpuTopology topology;
+        topology.m_cpus.push_back(MakeCpu(3, 0, 0, 0, 0));
+        ASSERT_NE(nullptr, topology.FindCpu(3));
+        EXPECT_EQ(3, topology.FindCpu(3)->m_cpuId);
+        EXPECT_EQ(nullptr, topology.FindCpu(0));
+    }
+
+    class TopologyAwareJobManagerTest : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            desc.m_topologyAwareStealing = true;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+        }
+    };
+
+    TEST_F(TopologyAwareJobManagerTest, ProcessesAllJobs)
+    {
+        AZStd::atomic_int numJobsDone{ 0 };
+        JobCompletion completion;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Job* job = CreateJobFunction([&numJobsDone]() { ++numJobsDone; }, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+        EXPECT_EQ(1000, numJobsDone.load());
+    }
+
+    class WorkStealingDequeTest
+        : public AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(WorkStealingDequeTest, OwnerPopsInLifoOrderAndThiefStealsInFifoOrder)
+    {
+        int values[4] = { 0, 1, 2, 3 };
+        AZ::Internal::WorkStealingDeque<int*> deque;
+        for (int& value : values)
+        {
+            deque.PushBottom(&value);
+        }
+        EXPECT_EQ(4, deque.Size());
+
+        EXPECT_EQ(&values[3], deque.PopBottom());
+        EXPECT_EQ(&values[0], deque.StealTop());
+        EXPECT_EQ(&values[2], deque.PopBottom());
+        EXPECT_EQ(&values[1], deque.StealTop());
+        EXPECT_EQ(nullptr, deque.PopBottom());
+        EXPECT_EQ(nullptr, deque.StealTop());
+        EXPECT_TRUE(deque.Empty());
+    }
+
+    TEST_F(WorkStealingDequeTest, GrowsWhenFullAndKeepsOrder)
+    {
+        constexpr int numValues = 1000;
+        AZStd::vector<int> values(numValues);
+        AZ::Internal::WorkStealingDeque<int*> deque(4);
+        for (int& value : values)
+        {
+            deque.PushBottom(&value);
+        }
+        EXPECT_GE(deque.Capacity(), numValues);
+
+        for (int i = 0; i < numValues; ++i)
+        {
+            EXPECT_EQ(&values[i], deque.StealTop());
+        }
+        EXPECT_TRUE(deque.Empty());
+    }
+
+    TEST_F(WorkStealingDequeTest, ConcurrentStealsTakeEveryValueExactlyOnce)
+    {
+        constexpr int numValues = 100000;
+        constexpr int numThieves = 4;
+        AZStd::vector<int> values(numValues);
+        AZStd::vector<AZStd::atomic<int>> timesTaken(numValues);
+        for (AZStd::atomic<int>& taken : timesTaken)
+        {
+            taken = 0;
+        }
+
+        AZ::Internal::WorkStealingDeque<int*> deque(16);
+        AZStd::atomic_bool ownerDone{ false };
+        auto take = [&values, &timesTaken](int* value)
+        {
+            if (value)
+            {
+                timesTaken[value - values.data()].fetch_add(1);
+            }
+        };
+
+        AZStd::vector<AZStd::thread> thieves;
+        for (int i = 0; i < numThieves; ++i)
+        {
+            thieves.emplace_back([&deque, &ownerDone, &take]()
+            {
+                while (!ownerDone || !deque.Empty())
+                {
+                    take(deque.StealTop());
+                }
+            });
+        }
+
+        for (int i = 0; i < numValues; ++i)
+        {
+            deque.PushBottom(&values[i]);
+            if (i % 3 == 0)
+            {
+                take(deque.PopBottom());
+            }
+        }
+        while (int* value = deque.PopBottom())
+        {
+            take(value);
+        }
+        ownerDone = true;
+
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        for (int i = 0; i < numValues; ++i)
+        {
+            EXPECT_EQ(1, timesTaken[i].load());
+        }
+    }
+
+    class JobTraceTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        static size_t CountOccurrences(const AZStd::string& text, const char* pattern)
+        {
+            size_t count = 0;
+            for (size_t pos = text.find(pattern); pos != AZStd::string::npos; pos = text.find(pattern, pos + 1))
+            {
+                ++count;
+            }
+            return count;
+        }
+    };
+
+    TEST_F(JobTraceTest, TraceBuffer_KeepsMostRecentEvents)
+    {
+        AZ::Internal::JobTraceBuffer* buffer = aznew AZ::Internal::JobTraceBuffer;
+        const AZ::u64 numEvents = AZ::Internal::JobTraceBuffer::Capacity + 100;
+        for (AZ::u64 i = 0; i < numEvents; ++i)
+        {
+            buffer->Record(AZ::Internal::JobTraceEventType::JobBegin, nullptr, static_cast<AZ::s32>(i));
+        }
+
+        AZStd::vector<AZ::Internal::JobTraceEvent> events;
+        buffer->Read(events);
+        // the oldest slot is the one the writer fills next, so it's never returned once the buffer has wrapped
+        ASSERT_EQ(AZ::Internal::JobTraceBuffer::Capacity - 1, events.size());
+        EXPECT_EQ(101, events.front().m_arg);
+        EXPECT_EQ(static_cast<AZ::s32>(numEvents - 1), events.back().m_arg);
+
+        buffer->Clear();
+        events.clear();
+        buffer->Read(events);
+        EXPECT_TRUE(events.empty());
+        delete buffer;
+    }
+
+    TEST_F(JobTraceTest, Disabled_RecordsNothing)
+    {
+        JobCompletion completion;
+        for (int i = 0; i < 100; ++i)
+        {
+            Job* job = CreateJobFunction([]() {}, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        AZStd::string trace;
+        m_jobManager->ExportTrace(trace);
+        EXPECT_EQ(0u, CountOccurrences(trace, "\"name\":\"Job\""));
+    }
+
+    TEST_F(JobTraceTest, Enabled_ExportsBeginAndEndOfEveryJob)
+    {
+        m_jobManager->SetTraceEnabled(true);
+        const int numJobs = 500;
+        JobCompletion completion;
+        for (int i = 0; i < numJobs; ++i)
+        {
+            Job* job = CreateJobFunction([]() {}, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+        m_jobManager->SetTraceEnabled(false);
+
+        AZStd::string trace;
+        m_jobManager->ExportTrace(trace);
+        EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        // the completion job is processed in place and isn't traced
+        EXPECT_EQ(static_cast<size_t>(numJobs), CountOccurrences(trace, "\"name\":\"Job\""));
+        EXPECT_EQ(static_cast<size_t>(m_numWorkerThreads), CountOccurrences(trace, "\"name\":\"Job worker "));
+
+        m_jobManager->ClearTrace();
+        m_jobManager->ExportTrace(trace);
+        EXPECT_EQ(0u, CountOccurrences(trace, "\"name\":\"Job\""));
+    }
+
+    TEST_F(JobTraceTest, Enabled_RecordsSuspendedParentJobs)
+    {
+        m_jobManager->SetTraceEnabled(true);
+        Job* parent = CreateJobFunction([](Job& thisJob)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                thisJob.StartAsChild(CreateJobFunction([]() {}, true));
+            }
+            thisJob.WaitForChildren();
+        }, true);
+        parent->StartAndWaitForCompletion();
+        m_jobManager->SetTraceEnabled(false);
+
+        AZStd::string trace;
+        m_jobManager->ExportTrace(trace);
+        EXPECT_EQ(1u, CountOccurrences(trace, "\"name\":\"WaitForChildren\""));
+    }
+
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2011,6 +2499,347 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    class TestJobForkCalculatePi : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkCalculatePi, ThreadPoolAllocator, 0)
+
+        TestJobForkCalculatePi(AZ::u32 numberOfJobs, AZ::u32 depth, JobContext* context)
+            : Job(true, context)
+            , m_numberOfJobs(numberOfJobs)
+            , m_depth(depth)
+        {
+        }
+
+        void Process() override
+        {
+            // children are forked from a worker thread, so they go through the worker's local queue and get stolen by the others
+            for (AZ::u32 i = 0; i < m_numberOfJobs; ++i)
+            {
+                StartAsChild(aznew TestJobCalculatePi(m_depth, 0, GetContext()));
+            }
+            WaitForChildren();
+        }
+    private:
+        const AZ::u32 m_numberOfJobs;
+        const AZ::u32 m_depth;
+    };
+
+    BENCHMARK_F(JobBenchmarkFixture, RunLargeNumberOfForkedLightWeightJobs)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            TestJobForkCalculatePi* rootJob = aznew TestJobForkCalculatePi(LARGE_NUMBER_OF_JOBS * 4, LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH, m_jobContext);
+            rootJob->StartAndWaitForCompletion();
+        }
+    }
+
+    BENCHMARK_F(JobBenchmarkFixture, RunLargeNumberOfForkedMediumWeightJobs)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            TestJobForkCalculatePi* rootJob = aznew TestJobForkCalculatePi(LARGE_NUMBER_OF_JOBS, MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH, m_jobContext);
+            rootJob->StartAndWaitForCompletion();
+        }
+    }
+
+    // Same as the benchmarks above with the job timeline trace enabled, to measure its overhead.
+    BENCHMARK_F(JobBenchmarkFixture, RunLargeNumberOfLightWeightJobsWithTracing)(benchmark::State& state)
+    {
+        m_jobManager->SetTraceEnabled(true);
+        for (auto _ : state)
+        {
+            RunMultipleCalculatePiJobsWithDefaultPriority(LARGE_NUMBER_OF_JOBS, LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+        }
+        m_jobManager->SetTraceEnabled(false);
+    }
+
+    BENCHMARK_F(JobBenchmarkFixture, RunLargeNumberOfForkedLightWeightJobsWithTracing)(benchmark::State& state)
+    {
+        m_jobManager->SetTraceEnabled(true);
+        for (auto _ : state)
+        {
+            TestJobForkCalculatePi* rootJob = aznew TestJobForkCalculatePi(LARGE_NUMBER_OF_JOBS * 4, LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH, m_jobContext);
+            rootJob->StartAndWaitForCompletion();
+        }
+        m_jobManager->SetTraceEnabled(false);
+    }
+
+    // Reference implementation of the per worker queue before it was replaced by WorkStealingDeque
+    class LockedWorkQueue
+    {
+    public:
+        void PushBottom(int* value)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_queue.push_back(value);
+        }
+        int* PopBottom()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return PopFront();
+        }
+        int* StealTop()
+        {
+            if (m_mutex.try_lock())
+            {
+                int* result = PopFront();
+                m_mutex.unlock();
+                return result;
+            }
+            return nullptr;
+        }
+    private:
+        int* PopFront()
+        {
+            int* result = nullptr;
+            if (!m_queue.empty())
+            {
+                result = m_queue.front();
+                m_queue.pop_front();
+            }
+            return result;
+        }
+        AZStd::deque<int*> m_queue;
+        AZStd::mutex m_mutex;
+    };
+
+    class WorkQueueBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] ::benchmark::State& state) override
+        {
+            AllocatorInstance<SystemAllocator>::Create();
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            AllocatorInstance<SystemAllocator>::Destroy();
+        }
+
+    protected:
+        // The owner pushes numberOfJobs values and pops them back while (range(1)) thieves steal concurrently,
+        // the same access pattern a worker sees when it forks many fine grained jobs.
+        template<typename QueueType>
+        void RunOwnerAndThieves(::benchmark::State& state)
+        {
+            const AZ::s64 numberOfJobs = state.range(0);
+            const AZ::s64 numberOfThieves = state.range(1);
+            int value = 0;
+
+            for (auto _ : state)
+            {
+                QueueType queue;
+                AZStd::atomic_bool ownerDone{ false };
+                AZStd::atomic<AZ::s64> numTaken{ 0 };
+
+                AZStd::vector<AZStd::thread> thieves;
+                for (AZ::s64 i = 0; i < numberOfThieves; ++i)
+                {
+                    thieves.emplace_back([&queue, &ownerDone, &numTaken]()
+                    {
+                        while (!ownerDone.load(AZStd::memory_order_acquire))
+                        {
+                            if (queue.StealTop())
+                            {
+                                numTaken.fetch_add(1, AZStd::memory_order_relaxed);
+                            }
+                        }
+                    });
+                }
+
+                for (AZ::s64 i = 0; i < numberOfJobs; ++i)
+                {
+                    queue.PushBottom(&value);
+                    if ((i & 1) && queue.PopBottom())
+                    {
+                        numTaken.fetch_add(1, AZStd::memory_order_relaxed);
+                    }
+                }
+                while (queue.PopBottom())
+                {
+                    numTaken.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+                ownerDone.store(true, AZStd::memory_order_release);
+
+                for (AZStd::thread& thief : thieves)
+                {
+                    thief.join();
+                }
+                benchmark::DoNotOptimize(numTaken.load());
+            }
+            state.SetItemsProcessed(state.iterations() * numberOfJobs);
+        }
+    };
+
+    static void WorkQueueBenchmarkArgs(::benchmark::internal::Benchmark* benchmark)
+    {
+        for (AZ::s64 numberOfJobs : { 1 << 14, 1 << 17, 1 << 20 })
+        {
+            for (AZ::s64 numberOfThieves : { 0, 1, 3, 7 })
+            {
+                benchmark->Args({ numberOfJobs, numberOfThieves });
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(WorkQueueBenchmarkFixture, LockedWorkQueue)(benchmark::State& state)
+    {
+        RunOwnerAndThieves<LockedWorkQueue>(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, LockedWorkQueue)
+        ->Apply(WorkQueueBenchmarkArgs)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(WorkQueueBenchmarkFixture, WorkStealingDeque)(benchmark::State& state)
+    {
+        RunOwnerAndThieves<AZ::Internal::WorkStealingDeque<int*>>(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, WorkStealingDeque)
+        ->Apply(WorkQueueBenchmarkArgs)
+        ->Unit(::benchmark::kMillisecond);
+
+    /**
+     * Parallel algorithms (Jobs/Algorithms.h) against their serial AZStd counterparts, from 1e4 to 1e7 elements.
+     */
+    class ParallelAlgorithmsBenchmarkFixture
+        : public JobBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            JobBenchmarkFixture::SetUp(state);
+            m_values.resize(state.range(0));
+            AZ::SimpleLcgRandom random(1);
+            for (AZ::u32& value : m_values)
+            {
+                value = random.GetRandom();
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_values = {};
+            m_work = {};
+            JobBenchmarkFixture::TearDown(state);
+        }
+
+        void ResetWork()
+        {
+            m_work.assign(m_values.begin(), m_values.end());
+        }
+
+        AZStd::vector<AZ::u32> m_values;
+        AZStd::vector<AZ::u32> m_work;
+    };
+
+#define AZ_PARALLEL_ALGORITHM_BENCHMARK(Name) \
+    BENCHMARK_REGISTER_F(ParallelAlgorithmsBenchmarkFixture, Name)->RangeMultiplier(10)->Range(10000, 10000000)->Unit(::benchmark::kMicrosecond)
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialAccumulate)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZStd::accumulate(m_values.begin(), m_values.end(), AZ::u64(0)));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(SerialAccumulate);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelReduce)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(parallel_reduce(m_values.begin(), m_values.end(), AZ::u64(0), AZStd::plus<AZ::u64>()));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(ParallelReduce);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialInclusiveScan)(benchmark::State& state)
+    {
+        ResetWork();
+        for (auto _ : state)
+        {
+            AZ::u32 sum = 0;
+            for (size_t i = 0; i < m_values.size(); ++i)
+            {
+                sum += m_values[i];
+                m_work[i] = sum;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(SerialInclusiveScan);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelInclusiveScan)(benchmark::State& state)
+    {
+        ResetWork();
+        for (auto _ : state)
+        {
+            parallel_inclusive_scan(m_values.begin(), m_values.end(), m_work.begin());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(ParallelInclusiveScan);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            ResetWork();
+            state.ResumeTiming();
+            AZStd::sort(m_work.begin(), m_work.end());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(SerialSort);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelSort)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            ResetWork();
+            state.ResumeTiming();
+            parallel_sort(m_work.begin(), m_work.end());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(ParallelSort);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, SerialStablePartition)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            ResetWork();
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(std::stable_partition(m_work.begin(), m_work.end(), [](AZ::u32 value) { return (value & 1) == 0; }));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(SerialStablePartition);
+
+    BENCHMARK_DEFINE_F(ParallelAlgorithmsBenchmarkFixture, ParallelPartition)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            ResetWork();
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(parallel_partition(m_work.begin(), m_work.end(), [](AZ::u32 value) { return (value & 1) == 0; }));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    AZ_PARALLEL_ALGORITHM_BENCHMARK(ParallelPartition);
+
+#undef AZ_PARALLEL_ALGORITHM_BENCHMARK
+
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Aabbx8.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Transform.h>
@@ -454,4 +455,42 @@ namespace UnitTest
         EXPECT_THAT(aabb.GetMin(), IsClose(Vector3(1.0f, 12.0f, 12.0f)));
         EXPECT_THAT(aabb.GetMax(), IsClose(Vector3(3.0f, 18.0f, 15.0f)));
     }
+
+    TEST(MATH_Aabbx8, TestPlaneMasks)
+    {
+        // Boxes of half size 1 at x = -4, -2, ..., 10, tested against the plane x = 3 facing +x
+        Aabb aabbs[8];
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            aabbs[i] = Aabb::CreateCenterHalfExtents(Vector3(float(i) * 2.0f - 4.0f, 0.0f, 0.0f), Vector3(1.0f));
+        }
+        const Aabbx8 batch = Aabbx8::CreateFromAabbs(aabbs);
+        const Plane plane = Plane::CreateFromNormalAndPoint(Vector3::CreateAxisX(), Vector3(3.0f, 0.0f, 0.0f));
+
+        // Centers -4, -2, 0 and 2 end at or before x = 3, centers 4 and above start at or after it
+        EXPECT_EQ(batch.GetPlaneExteriorMask(plane), 0b00001111);
+        EXPECT_EQ(batch.GetPlaneInteriorMask(plane), 0b11110000);
+
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(batch.GetElement(i), aabbs[i]);
+        }
+    }
+
+    TEST(MATH_Aabbx8, TestTransformedAabbMatchesAabb)
+    {
+        Aabb aabbs[8];
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            aabbs[i] = Aabb::CreateFromMinMax(Vector3(float(i), -float(i), 1.0f), Vector3(float(i) + 2.0f, 1.0f, 1.5f + float(i)));
+        }
+        const Transform transform = Transform::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateRotationZ(0.7f) * Quaternion::CreateRotationX(-0.3f), Vector3(5.0f, 6.0f, 7.0f));
+
+        const Aabbx8 transformed = Aabbx8::CreateFromAabbs(aabbs).GetTransformedAabb(transform);
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_TRUE(transformed.GetElement(i).IsClose(aabbs[i].GetTransformedAabb(transform), 1e-4f));
+        }
+    }
 }
@@ -6,7 +6,10 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/FastHash.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -60,6 +63,98 @@ namespace Benchmark
     }
 
     BENCHMARK(MeasureCrc32ConstevalTime);
+
+    //! Hashes buffers of state.range(0) bytes, from short names to large blobs.
+    class HashThroughputFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_data.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (size_t i = 0; i < m_data.size(); ++i)
+            {
+                // Mixed case letters, so the lower case paths do work
+                m_data[i] = static_cast<uint8_t>((i & 1 ? 'a' : 'A') + i % 26);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_data = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::vector<uint8_t> m_data;
+    };
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, Crc32ByteWise)(benchmark::State& state)
+    {
+        // The table lookup per byte that Crc32 uses in constant evaluation, as a baseline
+        for (auto _ : state)
+        {
+            unsigned int crc = 0xffffffff;
+            for (uint8_t value : m_data)
+            {
+                crc = AZ::Internal::ComputeCrc32Octet(crc, value);
+            }
+            benchmark::DoNotOptimize(crc);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, Crc32ByteWise)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, Crc32)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Crc32(m_data.data(), m_data.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, Crc32)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, Crc32LowerCase)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Crc32(m_data.data(), m_data.size(), true));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, Crc32LowerCase)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, Crc32c)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::ComputeCrc32c(m_data.data(), m_data.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, Crc32c)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, FastHash64)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::FastHash64(m_data.data(), m_data.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, FastHash64)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+    BENCHMARK_DEFINE_F(HashThroughputFixture, StringHash)(benchmark::State& state)
+    {
+        // FNV-1a, used by AZStd::hash of strings and Name
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZStd::hash_string(m_data.data(), m_data.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(HashThroughputFixture, StringHash)->RangeMultiplier(8)->Range(8, 1 << 18);
 }
 
 #endif
@@ -115,4 +210,89 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    //! Reference byte-wise implementation, as used by Crc32 during constant evaluation.
+    static AZ::u32 ComputeCrc32ByteWise(const uint8_t* data, size_t size, bool forceLowerCase)
+    {
+        unsigned int crc = 0xffffffff;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const uint8_t value = data[i];
+            crc = AZ::Internal::ComputeCrc32Octet(crc, forceLowerCase && value >= 'A' && value <= 'Z' ? static_cast<uint8_t>(value + 'a' - 'A') : value);
+        }
+        return crc ^ 0xffffffff;
+    }
+
+    static AZStd::vector<uint8_t> CreateTestData(size_t size)
+    {
+        AZStd::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            // Spans upper case letters, the bytes around them and non ASCII bytes
+            data[i] = static_cast<uint8_t>(i * 37 + i / 7);
+        }
+        return data;
+    }
+
+    TEST_F(Crc32Fixture, RuntimeCrc32_MatchesByteWiseValues)
+    {
+        EXPECT_EQ(AZ::Crc32(0xcbf43926), AZ::Crc32("123456789", 9, false));
+        EXPECT_EQ(AZ::Crc32(0xf44f1a1d), AZ::Crc32(AZStd::string_view("EditorData")));
+
+        const AZStd::vector<uint8_t> data = CreateTestData(300);
+        for (size_t size = 0; size <= data.size(); ++size)
+        {
+            EXPECT_EQ(ComputeCrc32ByteWise(data.data(), size, false), AZ::Crc32(data.data(), size, false));
+            EXPECT_EQ(ComputeCrc32ByteWise(data.data(), size, true), AZ::Crc32(data.data(), size, true));
+        }
+    }
+
+    TEST_F(Crc32Fixture, RuntimeAdd_MatchesCrcOfConcatenation)
+    {
+        const AZStd::vector<uint8_t> data = CreateTestData(100);
+        for (size_t split = 0; split <= data.size(); ++split)
+        {
+            AZ::Crc32 crc(data.data(), split, true);
+            crc.Add(data.data() + split, data.size() - split, true);
+            EXPECT_EQ(ComputeCrc32ByteWise(data.data(), data.size(), true), crc);
+
+            AZ::Crc32 voidCrc(static_cast<const void*>(data.data()), split);
+            voidCrc.Add(static_cast<const void*>(data.data() + split), data.size() - split);
+            EXPECT_EQ(ComputeCrc32ByteWise(data.data(), data.size(), false), voidCrc);
+        }
+
+        AZ::Crc32 hello("Hello");
+        hello.Add(AZStd::string_view(" World"));
+        EXPECT_EQ(AZ::Crc32(0x0d4a1185), hello);
+    }
+
+    TEST_F(Crc32Fixture, ComputeCrc32c_MatchesCastagnoliCheckValue)
+    {
+        EXPECT_EQ(0xe3069283, AZ::ComputeCrc32c("123456789", 9));
+        EXPECT_EQ(0u, AZ::ComputeCrc32c(nullptr, 0));
+
+        // Continuing from a previous crc gives the crc of the whole
+        const AZStd::vector<uint8_t> data = CreateTestData(200);
+        const AZ::u32 expected = AZ::ComputeCrc32c(data.data(), data.size());
+        for (size_t split = 0; split <= data.size(); ++split)
+        {
+            EXPECT_EQ(expected, AZ::ComputeCrc32c(data.data() + split, data.size() - split, AZ::ComputeCrc32c(data.data(), split)));
+        }
+    }
+
+    TEST_F(Crc32Fixture, FastHash64_IsDeterministicAndSpreadsValues)
+    {
+        const AZStd::vector<uint8_t> data = CreateTestData(300);
+        AZStd::unordered_set<AZ::u64> hashes;
+        for (size_t size = 0; size <= data.size(); ++size)
+        {
+            const AZ::u64 hash = AZ::FastHash64(data.data(), size);
+            EXPECT_EQ(hash, AZ::FastHash64(data.data(), size));
+            hashes.insert(hash);
+        }
+        EXPECT_EQ(data.size() + 1, hashes.size());
+
+        EXPECT_NE(AZ::FastHash64("Name", 0), AZ::FastHash64("Name", 1));
+        EXPECT_NE(AZ::FastHash64("Name"), AZ::FastHash64("name"));
+        EXPECT_EQ(AZ::FastHash64(AZStd::string_view("Name")), AZ::FastStringHasher{}("Name"));
+    }
 }
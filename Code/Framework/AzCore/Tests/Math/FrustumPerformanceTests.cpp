@@ -5,7 +5,9 @@
  *
  */
 
+#include <AzCore/Math/Aabbx8.h>
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -38,8 +40,21 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            m_aabbBatches.reserve(m_dataArray.size() / Aabbx8Count);
+            for (size_t i = 0; i + Aabbx8Count <= m_dataArray.size(); i += Aabbx8Count)
+            {
+                AZ::Aabb aabbs[Aabbx8Count];
+                for (size_t j = 0; j < Aabbx8Count; ++j)
+                {
+                    aabbs[j] = AZ::Aabb::CreateFromMinMax(m_dataArray[i + j].aabbMin, m_dataArray[i + j].aabbMax);
+                }
+                m_aabbBatches.push_back(AZ::Aabbx8::CreateFromAabbs(aabbs));
+            }
         }
 
+        static constexpr size_t Aabbx8Count = AZ::Aabbx8::ElementCount;
+
         struct Data
         {
             AZ::Vector3 sphereCenter;
@@ -49,6 +64,7 @@ namespace Benchmark
         };
 
         std::vector<Data> m_dataArray;
+        std::vector<AZ::Aabbx8> m_aabbBatches;
         AZ::Frustum m_testFrustum;
     };
 
@@ -75,6 +91,34 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, AabbOverlaps)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (auto& data : m_dataArray)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_testFrustum, AZ::Aabb::CreateFromMinMax(data.aabbMin, data.aabbMax));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathFrustum, AabbOverlapsBatch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (auto& aabbBatch : m_aabbBatches)
+            {
+                int32_t exteriorMask = 0;
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    exteriorMask |= aabbBatch.GetPlaneExteriorMask(m_testFrustum.GetPlane(planeId));
+                }
+                benchmark::DoNotOptimize(exteriorMask);
+            }
+        }
+    }
 }
 
 #endif
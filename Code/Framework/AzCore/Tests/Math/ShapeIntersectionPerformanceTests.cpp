@@ -159,6 +159,160 @@ namespace Benchmark
             }
         }
     }
+
+    //! Structure of arrays primitives for the batch overlap tests, sized by the benchmark argument.
+    class BM_MathShapeIntersectionBatch
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            const size_t count = aznumeric_cast<size_t>(state.range(0));
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+
+            m_aabbs.resize(count);
+            m_minX.resize(count);
+            m_minY.resize(count);
+            m_minZ.resize(count);
+            m_maxX.resize(count);
+            m_maxY.resize(count);
+            m_maxZ.resize(count);
+            m_spheres.resize(count);
+            m_centerX.resize(count);
+            m_centerY.resize(count);
+            m_centerZ.resize(count);
+            m_radius.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const AZ::Vector3 center = AZ::Vector3(unif(rng), unif(rng), unif(rng));
+                const AZ::Vector3 halfExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 0.2f;
+                m_aabbs[i] = AZ::Aabb::CreateCenterHalfExtents(center, halfExtents);
+                m_minX[i] = m_aabbs[i].GetMin().GetX();
+                m_minY[i] = m_aabbs[i].GetMin().GetY();
+                m_minZ[i] = m_aabbs[i].GetMin().GetZ();
+                m_maxX[i] = m_aabbs[i].GetMax().GetX();
+                m_maxY[i] = m_aabbs[i].GetMax().GetY();
+                m_maxZ[i] = m_aabbs[i].GetMax().GetZ();
+
+                m_spheres[i] = AZ::Sphere(center, halfExtents.GetX());
+                m_centerX[i] = center.GetX();
+                m_centerY[i] = center.GetY();
+                m_centerZ[i] = center.GetZ();
+                m_radius[i] = halfExtents.GetX();
+            }
+
+            m_mask.resize((count + 31) / 32);
+            m_indices.resize(count);
+            m_frustumMasks.resize(count);
+            m_frusta[0] = frustum1;
+            m_frusta[1] = frustum2;
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_aabbs = {};
+            m_minX = m_minY = m_minZ = m_maxX = m_maxY = m_maxZ = {};
+            m_spheres = {};
+            m_centerX = m_centerY = m_centerZ = m_radius = {};
+            m_mask = m_indices = m_frustumMasks = {};
+        }
+
+        AZ::ShapeIntersection::AabbSoaView GetAabbView() const
+        {
+            return { m_minX.data(), m_minY.data(), m_minZ.data(), m_maxX.data(), m_maxY.data(), m_maxZ.data(), m_aabbs.size() };
+        }
+
+        AZ::ShapeIntersection::SphereSoaView GetSphereView() const
+        {
+            return { m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_radius.data(), m_spheres.size() };
+        }
+
+        std::vector<AZ::Aabb> m_aabbs;
+        std::vector<float> m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+        std::vector<AZ::Sphere> m_spheres;
+        std::vector<float> m_centerX, m_centerY, m_centerZ, m_radius;
+        std::vector<uint32_t> m_mask;
+        std::vector<uint32_t> m_indices;
+        std::vector<uint32_t> m_frustumMasks;
+        AZ::Frustum m_frusta[2];
+    };
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsFrustumAabbLoop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            size_t overlapCount = 0;
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                overlapCount += AZ::ShapeIntersection::Overlaps(frustum1, aabb) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(overlapCount);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsFrustumAabbLoop)->RangeMultiplier(10)->Range(10000, 1000000);
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsBatchFrustumAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(frustum1, GetAabbView(), m_mask.data());
+            benchmark::DoNotOptimize(m_mask.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsBatchFrustumAabb)->RangeMultiplier(10)->Range(10000, 1000000);
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsBatchIndicesFrustumAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const size_t overlapCount = AZ::ShapeIntersection::OverlapsBatchIndices(frustum1, GetAabbView(), m_indices.data());
+            benchmark::DoNotOptimize(overlapCount);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsBatchIndicesFrustumAabb)->RangeMultiplier(10)->Range(10000, 1000000);
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsFrustumSphereLoop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            size_t overlapCount = 0;
+            for (const AZ::Sphere& sphere : m_spheres)
+            {
+                overlapCount += AZ::ShapeIntersection::Overlaps(frustum1, sphere) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(overlapCount);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsFrustumSphereLoop)->RangeMultiplier(10)->Range(10000, 1000000);
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsBatchFrustumSphere)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(frustum1, GetSphereView(), m_mask.data());
+            benchmark::DoNotOptimize(m_mask.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsBatchFrustumSphere)->RangeMultiplier(10)->Range(10000, 1000000);
+
+    BENCHMARK_DEFINE_F(BM_MathShapeIntersectionBatch, OverlapsBatchMultipleFrustaAabb)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::ShapeIntersection::OverlapsBatch(m_frusta, AZ_ARRAY_SIZE(m_frusta), GetAabbView(), m_frustumMasks.data());
+            benchmark::DoNotOptimize(m_frustumMasks.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_MathShapeIntersectionBatch, OverlapsBatchMultipleFrustaAabb)->RangeMultiplier(10)->Range(10000, 1000000);
 }
 
 #endif
@@ -8,8 +8,10 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <random>
 
 namespace UnitTest
 {
@@ -142,4 +144,152 @@ namespace UnitTest
             EXPECT_FALSE(AZ::ShapeIntersection::Overlaps(frustum, obb1));
         }
     }
+
+    class MATH_ShapeIntersectionBatch
+        : public ::testing::TestWithParam<size_t>
+    {
+    protected:
+        void SetUp() override
+        {
+            // Frusta looking down +y from different origins, so primitives are a mix of inside, outside and straddling
+            m_frusta.push_back(AZ::Frustum::CreateFromMatrixColumnMajor(
+                AZ::Matrix4x4::CreateProjection(AZ::Constants::HalfPi, 1.0f, 0.1f, 50.0f) *
+                AZ::Matrix4x4::CreateRotationX(-AZ::Constants::HalfPi)));
+            m_frusta.push_back(AZ::Frustum(
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 1.f, 0.f), AZ::Vector3(0.f, -5.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, -1.f, 0.f), AZ::Vector3(0.f, 5.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.f, 0.f, 0.f), AZ::Vector3(-5.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.f, 0.f, 0.f), AZ::Vector3(5.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, -1.f), AZ::Vector3(0.f, 0.f, 5.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3(0.f, 0.f, -5.f))));
+            m_frusta.push_back(AZ::Frustum(
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 1.f, 0.f), AZ::Vector3(0.f, -2.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, -1.f, 0.f), AZ::Vector3(0.f, 2.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.f, 0.f, 0.f), AZ::Vector3(-2.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.f, 0.f, 0.f), AZ::Vector3(2.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, -1.f), AZ::Vector3(0.f, 0.f, 2.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3(0.f, 0.f, -2.f))));
+
+            const size_t count = GetParam();
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+            std::uniform_real_distribution<float> size(0.0f, 4.0f);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const AZ::Vector3 center(position(rng), position(rng), position(rng));
+                m_spheres.push_back(AZ::Sphere(center, size(rng)));
+                m_aabbs.push_back(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(size(rng), size(rng), size(rng))));
+
+                m_sphereCenterX.push_back(center.GetX());
+                m_sphereCenterY.push_back(center.GetY());
+                m_sphereCenterZ.push_back(center.GetZ());
+                m_sphereRadius.push_back(m_spheres.back().GetRadius());
+                m_aabbMinX.push_back(m_aabbs.back().GetMin().GetX());
+                m_aabbMinY.push_back(m_aabbs.back().GetMin().GetY());
+                m_aabbMinZ.push_back(m_aabbs.back().GetMin().GetZ());
+                m_aabbMaxX.push_back(m_aabbs.back().GetMax().GetX());
+                m_aabbMaxY.push_back(m_aabbs.back().GetMax().GetY());
+                m_aabbMaxZ.push_back(m_aabbs.back().GetMax().GetZ());
+            }
+        }
+
+        AZ::ShapeIntersection::SphereSoaView GetSphereView() const
+        {
+            return { m_sphereCenterX.data(), m_sphereCenterY.data(), m_sphereCenterZ.data(), m_sphereRadius.data(), m_spheres.size() };
+        }
+
+        AZ::ShapeIntersection::AabbSoaView GetAabbView() const
+        {
+            return { m_aabbMinX.data(), m_aabbMinY.data(), m_aabbMinZ.data(), m_aabbMaxX.data(), m_aabbMaxY.data(), m_aabbMaxZ.data(), m_aabbs.size() };
+        }
+
+        static bool IsMaskBitSet(const AZStd::vector<uint32_t>& mask, size_t index)
+        {
+            return (mask[index / 32] & (1u << (index % 32))) != 0;
+        }
+
+        AZStd::vector<AZ::Frustum> m_frusta;
+        AZStd::vector<AZ::Sphere> m_spheres;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<float> m_sphereCenterX, m_sphereCenterY, m_sphereCenterZ, m_sphereRadius;
+        AZStd::vector<float> m_aabbMinX, m_aabbMinY, m_aabbMinZ, m_aabbMaxX, m_aabbMaxY, m_aabbMaxZ;
+    };
+
+    TEST_P(MATH_ShapeIntersectionBatch, OverlapsBatchMaskMatchesOverlaps)
+    {
+        const size_t count = GetParam();
+        for (const AZ::Frustum& frustum : m_frusta)
+        {
+            AZStd::vector<uint32_t> sphereMask((count + 31) / 32, 0xFFFFFFFF);
+            AZStd::vector<uint32_t> aabbMask((count + 31) / 32, 0xFFFFFFFF);
+            AZ::ShapeIntersection::OverlapsBatch(frustum, GetSphereView(), sphereMask.data());
+            AZ::ShapeIntersection::OverlapsBatch(frustum, GetAabbView(), aabbMask.data());
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(AZ::ShapeIntersection::Overlaps(frustum, m_spheres[i]), IsMaskBitSet(sphereMask, i));
+                EXPECT_EQ(AZ::ShapeIntersection::Overlaps(frustum, m_aabbs[i]), IsMaskBitSet(aabbMask, i));
+            }
+
+            // Bits past the last primitive must be cleared
+            if (count % 32 != 0)
+            {
+                EXPECT_EQ(sphereMask.back() >> (count % 32), 0u);
+                EXPECT_EQ(aabbMask.back() >> (count % 32), 0u);
+            }
+        }
+    }
+
+    TEST_P(MATH_ShapeIntersectionBatch, OverlapsBatchIndicesMatchesOverlaps)
+    {
+        const size_t count = GetParam();
+        for (const AZ::Frustum& frustum : m_frusta)
+        {
+            AZStd::vector<uint32_t> expectedSphereIndices;
+            AZStd::vector<uint32_t> expectedAabbIndices;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, m_spheres[i]))
+                {
+                    expectedSphereIndices.push_back(static_cast<uint32_t>(i));
+                }
+                if (AZ::ShapeIntersection::Overlaps(frustum, m_aabbs[i]))
+                {
+                    expectedAabbIndices.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            AZStd::vector<uint32_t> sphereIndices(count);
+            AZStd::vector<uint32_t> aabbIndices(count);
+            sphereIndices.resize(AZ::ShapeIntersection::OverlapsBatchIndices(frustum, GetSphereView(), sphereIndices.data()));
+            aabbIndices.resize(AZ::ShapeIntersection::OverlapsBatchIndices(frustum, GetAabbView(), aabbIndices.data()));
+
+            EXPECT_EQ(expectedSphereIndices, sphereIndices);
+            EXPECT_EQ(expectedAabbIndices, aabbIndices);
+        }
+    }
+
+    TEST_P(MATH_ShapeIntersectionBatch, OverlapsBatchMultipleFrustaMatchesOverlaps)
+    {
+        const size_t count = GetParam();
+        AZStd::vector<uint32_t> sphereMasks(count, 0xFFFFFFFF);
+        AZStd::vector<uint32_t> aabbMasks(count, 0xFFFFFFFF);
+        AZ::ShapeIntersection::OverlapsBatch(m_frusta.data(), m_frusta.size(), GetSphereView(), sphereMasks.data());
+        AZ::ShapeIntersection::OverlapsBatch(m_frusta.data(), m_frusta.size(), GetAabbView(), aabbMasks.data());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t frustumIndex = 0; frustumIndex < m_frusta.size(); ++frustumIndex)
+            {
+                const uint32_t frustumBit = 1u << frustumIndex;
+                EXPECT_EQ(AZ::ShapeIntersection::Overlaps(m_frusta[frustumIndex], m_spheres[i]), (sphereMasks[i] & frustumBit) != 0);
+                EXPECT_EQ(AZ::ShapeIntersection::Overlaps(m_frusta[frustumIndex], m_aabbs[i]), (aabbMasks[i] & frustumBit) != 0);
+            }
+            EXPECT_EQ(sphereMasks[i] >> m_frusta.size(), 0u);
+            EXPECT_EQ(aabbMasks[i] >> m_frusta.size(), 0u);
+        }
+    }
+
+    // Counts around the batch width and mask word size, to cover partially filled batches and words
+    INSTANTIATE_TEST_CASE_P(MATH_ShapeIntersectionBatch, MATH_ShapeIntersectionBatch, ::testing::Values(0, 1, 7, 8, 9, 31, 32, 33, 100, 2500));
 }
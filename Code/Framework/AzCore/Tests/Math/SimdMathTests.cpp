@@ -2875,4 +2875,85 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestVec8Arithmetic)
+    {
+        AZ_ALIGN(float values1[8], 32) = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        AZ_ALIGN(float values2[8], 32) = { 2.0f, 2.0f, -2.0f, -2.0f, 4.0f, 4.0f, -4.0f, -4.0f };
+        AZ_ALIGN(float results[8], 32);
+
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadAligned(values1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadAligned(values2);
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Add(vec1, vec2));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], values1[i] + values2[i]);
+        }
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Sub(vec1, vec2));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], values1[i] - values2[i]);
+        }
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Madd(vec1, vec2, vec1));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], values1[i] * values2[i] + values1[i]);
+        }
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Div(vec1, vec2));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], values1[i] / values2[i]);
+        }
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Sqrt(Simd::Vec8::Abs(vec1)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], sqrtf(fabsf(values1[i])));
+        }
+    }
+
+    TEST(MATH_SimdMath, TestVec8CompareSelect)
+    {
+        AZ_ALIGN(float values1[8], 32) = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        AZ_ALIGN(float values2[8], 32) = { 2.0f, 2.0f, -2.0f, -4.0f, 4.0f, 4.0f, -4.0f, -4.0f };
+        AZ_ALIGN(float results[8], 32);
+
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadAligned(values1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadAligned(values2);
+
+        EXPECT_EQ(Simd::Vec8::GetBitMask(Simd::Vec8::CmpLt(vec1, vec2)), 0b10100011);
+        EXPECT_EQ(Simd::Vec8::GetBitMask(Simd::Vec8::CmpLtEq(vec1, vec2)), 0b10101011);
+        EXPECT_EQ(Simd::Vec8::GetBitMask(Simd::Vec8::CmpGt(vec1, vec2)), 0b01010100);
+        EXPECT_EQ(Simd::Vec8::GetBitMask(Simd::Vec8::CmpEq(vec1, vec2)), 0b00001000);
+        EXPECT_EQ(Simd::Vec8::GetBitMask(Simd::Vec8::CmpNeq(vec1, vec2)), 0b11110111);
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Select(vec1, vec2, Simd::Vec8::CmpGt(vec1, vec2)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(results[i], AZ::GetMax(values1[i], values2[i]));
+        }
+    }
+
+    TEST(MATH_SimdMath, TestVec8ConvertInt)
+    {
+        AZ_ALIGN(float values[8], 32) = { 1.5f, -2.5f, 3.0f, -4.9f, 5.1f, -6.0f, 7.7f, -8.2f };
+        AZ_ALIGN(int32_t results[8], 32);
+
+        const Simd::Vec8::Int32Type converted = Simd::Vec8::ConvertToInt(Simd::Vec8::LoadAligned(values));
+        Simd::Vec8::StoreAligned(results, converted);
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(results[i], static_cast<int32_t>(values[i]));
+        }
+
+        Simd::Vec8::StoreAligned(results, Simd::Vec8::Mul(converted, Simd::Vec8::Splat(3)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(results[i], static_cast<int32_t>(values[i]) * 3);
+        }
+    }
 }
@@ -10,6 +10,7 @@
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector3x8.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -49,6 +50,13 @@ namespace Benchmark
                 testData.index = distInt(rng) % 3;
                 return testData;
             });
+
+            m_points.resize(m_testDataArray.size());
+            m_results.resize(m_testDataArray.size());
+            std::generate(m_points.begin(), m_points.end(), [&distFloat, &rng]()
+            {
+                return AZ::Vector3(distFloat(rng), distFloat(rng), distFloat(rng));
+            });
         }
 
         struct TestData
@@ -65,6 +73,8 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+        std::vector<AZ::Vector3> m_points;
+        std::vector<AZ::Vector3> m_results;
     };
 
     BENCHMARK_F(BM_MathTransform, CreateIdentity)(benchmark::State& state)
@@ -414,6 +424,29 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_F(BM_MathTransform, TransformPointArray)(benchmark::State& state)
+    {
+        const AZ::Transform& transform = m_testDataArray.front().t1;
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_points.size(); ++i)
+            {
+                m_results[i] = transform.TransformPoint(m_points[i]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathTransform, TransformPointsBatch)(benchmark::State& state)
+    {
+        const AZ::Transform& transform = m_testDataArray.front().t1;
+        for (auto _ : state)
+        {
+            transform.TransformPoints(m_points.data(), m_results.data(), m_points.size());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
     BENCHMARK_F(BM_MathTransform, TransformPointVector4)(benchmark::State& state)
     {
         for (auto _ : state)
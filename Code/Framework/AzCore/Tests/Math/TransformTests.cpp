@@ -11,6 +11,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3x8.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include "MathTestData.h"
 
@@ -446,4 +447,33 @@ namespace UnitTest
         // relaxed custom tolerance passes
         EXPECT_TRUE(transformA.IsClose(transformB, 0.01f));
     }
+
+    TEST(MATH_Transform, TransformPointsMatchesTransformPoint)
+    {
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.3f, -0.2f, 0.5f, 0.7f).GetNormalized(), AZ::Vector3(1.0f, -2.0f, 3.0f)) * AZ::Transform::CreateUniformScale(1.5f);
+
+        // 19 points covers two full batches of eight and a remainder
+        AZ::Vector3 points[19];
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(points); ++i)
+        {
+            points[i] = AZ::Vector3(float(i), 1.0f - float(i) * 0.5f, float(i * i) * 0.1f);
+        }
+
+        AZ::Vector3 results[19];
+        transform.TransformPoints(points, results, AZ_ARRAY_SIZE(points));
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(points); ++i)
+        {
+            EXPECT_THAT(results[i], IsCloseTolerance(transform.TransformPoint(points[i]), 1e-4f));
+        }
+
+        const AZ::Vector3x8 batch = AZ::Vector3x8::CreateFromVector3s(points);
+        const AZ::Vector3x8 transformedPoints = transform.TransformPoint(batch);
+        const AZ::Vector3x8 transformedVectors = transform.TransformVector(batch);
+        for (int32_t i = 0; i < AZ::Vector3x8::ElementCount; ++i)
+        {
+            EXPECT_THAT(transformedPoints.GetElement(i), IsCloseTolerance(transform.TransformPoint(points[i]), 1e-4f));
+            EXPECT_THAT(transformedVectors.GetElement(i), IsCloseTolerance(transform.TransformVector(points[i]), 1e-4f));
+        }
+    }
 } // namespace UnitTest
@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector3x8.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -680,6 +681,91 @@ namespace Benchmark
             }
         }
     }
+
+    //! Measures the eight wide structure of arrays operations, compare with the BM_MathVector3 benchmarks of the same name.
+    class BM_MathVector3x8
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            constexpr size_t count = 1000;
+            m_vectors.resize(count);
+            for (auto& component : m_components)
+            {
+                component.resize(count);
+            }
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_vectors[i] = AZ::Vector3(unif(rng), unif(rng), unif(rng));
+                m_components[0][i] = m_vectors[i].GetX();
+                m_components[1][i] = m_vectors[i].GetY();
+                m_components[2][i] = m_vectors[i].GetZ();
+            }
+        }
+
+        AZ::Vector3x8 LoadBatch(size_t index) const
+        {
+            return AZ::Vector3x8::LoadUnaligned(&m_components[0][index], &m_components[1][index], &m_components[2][index]);
+        }
+
+        std::vector<AZ::Vector3> m_vectors;
+        std::vector<float> m_components[3];
+    };
+
+    BENCHMARK_F(BM_MathVector3x8, CreateFromVector3s)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i + AZ::Vector3x8::ElementCount <= m_vectors.size(); i += AZ::Vector3x8::ElementCount)
+            {
+                AZ::Vector3x8 result = AZ::Vector3x8::CreateFromVector3s(&m_vectors[i]);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathVector3x8, Dot)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i + AZ::Vector3x8::ElementCount <= m_vectors.size(); i += AZ::Vector3x8::ElementCount)
+            {
+                const AZ::Vector3x8 batch = LoadBatch(i);
+                AZ::Simd::Vec8::FloatType result = batch.Dot(batch);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathVector3x8, Cross)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i + AZ::Vector3x8::ElementCount <= m_vectors.size(); i += AZ::Vector3x8::ElementCount)
+            {
+                AZ::Vector3x8 result = LoadBatch(i).Cross(LoadBatch(m_vectors.size() - AZ::Vector3x8::ElementCount - i));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathVector3x8, GetNormalized)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i + AZ::Vector3x8::ElementCount <= m_vectors.size(); i += AZ::Vector3x8::ElementCount)
+            {
+                AZ::Vector3x8 result = LoadBatch(i).GetNormalized();
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
 }
 
 #endif
@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector3x8.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 using namespace AZ;
@@ -496,4 +497,53 @@ namespace UnitTest
         Vector3 rGrEq = Vector3::CreateSelectCmpGreater(vA, vB, Vector3(1.0f), Vector3(0.0f));
         AZ_TEST_ASSERT(rGrEq.IsClose(Vector3(0.0f, 1.0f, 0.0f)));
     }
+
+    TEST(MATH_Vector3x8, TestLoadStore)
+    {
+        Vector3 values[8];
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            values[i] = Vector3(float(i), float(i) * 2.0f, float(i) * -3.0f);
+        }
+
+        const Vector3x8 batch = Vector3x8::CreateFromVector3s(values);
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(batch.GetElement(i), values[i]);
+        }
+
+        Vector3 stored[8];
+        batch.StoreToVector3s(stored);
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(stored[i], values[i]);
+        }
+    }
+
+    TEST(MATH_Vector3x8, TestMatchesVector3)
+    {
+        Vector3 values1[8];
+        Vector3 values2[8];
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            values1[i] = Vector3(float(i) + 1.0f, 2.0f - float(i), 0.5f * float(i));
+            values2[i] = Vector3(3.0f, float(i) * float(i), -1.0f - float(i));
+        }
+
+        const Vector3x8 batch1 = Vector3x8::CreateFromVector3s(values1);
+        const Vector3x8 batch2 = Vector3x8::CreateFromVector3s(values2);
+
+        AZ_ALIGN(float dots[8], 32);
+        Simd::Vec8::StoreAligned(dots, batch1.Dot(batch2));
+        const Vector3x8 cross = batch1.Cross(batch2);
+        const Vector3x8 normalized = batch1.GetNormalized();
+        const Vector3x8 sum = batch1 + batch2 * 2.0f;
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            EXPECT_NEAR(dots[i], values1[i].Dot(values2[i]), 0.001f);
+            EXPECT_TRUE(cross.GetElement(i).IsClose(values1[i].Cross(values2[i])));
+            EXPECT_TRUE(normalized.GetElement(i).IsClose(values1[i].GetNormalized()));
+            EXPECT_TRUE(sum.GetElement(i).IsClose(values1[i] + values2[i] * 2.0f));
+        }
+    }
 }
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+// Allocations are only reported to the sampler when memory profiling is compiled in
+#if !defined(_RELEASE)
+
+namespace UnitTest
+{
+    class AllocationSamplerTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void TearDown() override
+        {
+            AZ::AllocatorManager::Instance().StopAllocationSampling();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::Debug::AllocationSampler& StartSampling(size_t sampleIntervalBytes)
+        {
+            AZ::Debug::AllocationSampler::Descriptor desc;
+            desc.m_sampleIntervalBytes = sampleIntervalBytes;
+            AZ::AllocatorManager::Instance().StartAllocationSampling(desc);
+            return *AZ::AllocatorManager::Instance().GetAllocationSampler();
+        }
+
+        void Sum(AZ::Debug::AllocationSampler& sampler, AZ::Debug::AllocationSampler::Callsite& total)
+        {
+            AZ::Debug::AllocationSampler::CallsiteList callsites;
+            sampler.GetCallsites(callsites);
+            for (const AZ::Debug::AllocationSampler::Callsite& callsite : callsites)
+            {
+                total.m_numSamples += callsite.m_numSamples;
+                total.m_numLiveSamples += callsite.m_numLiveSamples;
+                total.m_allocatedCount += callsite.m_allocatedCount;
+                total.m_allocatedBytes += callsite.m_allocatedBytes;
+                total.m_inUseCount += callsite.m_inUseCount;
+                total.m_inUseBytes += callsite.m_inUseBytes;
+            }
+        }
+    };
+
+    TEST_F(AllocationSamplerTest, SampleEveryByte_AllAllocationsAreTracked)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationSampler& sampler = StartSampling(1);
+
+        const size_t numAllocations = 16;
+        void* allocations[numAllocations];
+        for (void*& allocation : allocations)
+        {
+            allocation = allocator.Allocate(1024, 16);
+        }
+
+        AZ::Debug::AllocationSampler::Callsite total;
+        Sum(sampler, total);
+        EXPECT_EQ(numAllocations, total.m_numSamples);
+        EXPECT_EQ(numAllocations, total.m_numLiveSamples);
+        EXPECT_EQ(numAllocations, total.m_inUseCount);
+        EXPECT_EQ(numAllocations * 1024, total.m_inUseBytes);
+        EXPECT_EQ(numAllocations, sampler.GetNumLiveSamples());
+
+        for (void* allocation : allocations)
+        {
+            allocator.DeAllocate(allocation, 1024, 16);
+        }
+
+        total = AZ::Debug::AllocationSampler::Callsite();
+        Sum(sampler, total);
+        EXPECT_EQ(numAllocations, total.m_numSamples);
+        EXPECT_EQ(0, total.m_numLiveSamples);
+        EXPECT_EQ(0, total.m_inUseBytes);
+        EXPECT_EQ(numAllocations * 1024, total.m_allocatedBytes);
+        EXPECT_EQ(0, sampler.GetNumLiveSamples());
+    }
+
+    TEST_F(AllocationSamplerTest, SameCallsite_SamplesAreAggregated)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationSampler& sampler = StartSampling(1);
+
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+        allocations.reserve(32);
+        for (size_t i = 0; i < 32; ++i)
+        {
+            allocations.push_back(allocator.Allocate(64, 8));
+        }
+        AZ::AllocatorManager::Instance().StopAllocationSampling();
+        for (void* allocation : allocations)
+        {
+            allocator.DeAllocate(allocation, 64, 8);
+        }
+
+        AZ::Debug::AllocationSampler::CallsiteList callsites;
+        sampler.GetCallsites(callsites);
+        ASSERT_EQ(1, callsites.size());
+        EXPECT_EQ(32, callsites[0].m_numSamples);
+        EXPECT_LT(0, callsites[0].m_numFrames);
+        EXPECT_STREQ("SystemAllocator", callsites[0].m_allocatorName);
+    }
+
+    TEST_F(AllocationSamplerTest, SampledEstimates_AreCloseToRealUsage)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationSampler& sampler = StartSampling(4096);
+
+        const size_t numAllocations = 100000;
+        const size_t allocationSize = 64;
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations(numAllocations);
+        for (void*& allocation : allocations)
+        {
+            allocation = allocator.Allocate(allocationSize, 8);
+        }
+        // free every other allocation
+        for (size_t i = 0; i < numAllocations; i += 2)
+        {
+            allocator.DeAllocate(allocations[i], allocationSize, 8);
+        }
+
+        AZ::Debug::AllocationSampler::Callsite total;
+        Sum(sampler, total);
+        const double allocatedBytes = static_cast<double>(numAllocations * allocationSize);
+        EXPECT_GT(total.m_numSamples, 0);
+        EXPECT_LT(total.m_numSamples, numAllocations / 10);
+        EXPECT_NEAR(allocatedBytes, static_cast<double>(total.m_allocatedBytes), allocatedBytes * 0.1);
+        EXPECT_NEAR(allocatedBytes * 0.5, static_cast<double>(total.m_inUseBytes), allocatedBytes * 0.1);
+
+        for (size_t i = 1; i < numAllocations; i += 2)
+        {
+            allocator.DeAllocate(allocations[i], allocationSize, 8);
+        }
+        EXPECT_EQ(0, sampler.GetNumLiveSamples());
+    }
+
+    TEST_F(AllocationSamplerTest, StopSampling_NewAllocationsAreIgnored)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationSampler& sampler = StartSampling(1);
+        void* sampled = allocator.Allocate(128, 8);
+        AZ::AllocatorManager::Instance().StopAllocationSampling();
+        EXPECT_FALSE(sampler.IsActive());
+
+        void* notSampled = allocator.Allocate(128, 8);
+        EXPECT_EQ(1, sampler.GetNumLiveSamples());
+        allocator.DeAllocate(notSampled, 128, 8);
+        allocator.DeAllocate(sampled, 128, 8);
+
+        // the profile is kept after stopping
+        AZ::Debug::AllocationSampler::Callsite total;
+        Sum(sampler, total);
+        EXPECT_EQ(1, total.m_numSamples);
+    }
+
+    TEST_F(AllocationSamplerTest, Export_WritesPprofAndHeaptrackProfiles)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationSampler& sampler = StartSampling(1);
+        void* first = allocator.Allocate(256, 8);
+        void* second = allocator.Allocate(512, 8);
+        allocator.DeAllocate(first, 256, 8);
+        AZ::AllocatorManager::Instance().StopAllocationSampling();
+
+        AZStd::vector<char> pprof;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> pprofStream(&pprof);
+        EXPECT_TRUE(sampler.ExportPprof(pprofStream, false));
+        ASSERT_FALSE(pprof.empty());
+        // the profile starts with the first sample_type message (field 1, length delimited)
+        EXPECT_EQ(0x0a, pprof[0]);
+
+        AZStd::string heaptrack;
+        AZ::IO::ByteContainerStream<AZStd::string> heaptrackStream(&heaptrack);
+        EXPECT_TRUE(sampler.ExportHeaptrack(heaptrackStream, false));
+        EXPECT_TRUE(heaptrack.starts_with("v 10200 2\n"));
+        EXPECT_NE(AZStd::string::npos, heaptrack.find("\nt "));
+        EXPECT_NE(AZStd::string::npos, heaptrack.find("\na 200 ")); // 0x200 bytes, the second allocation
+        EXPECT_NE(AZStd::string::npos, heaptrack.find("\n+ "));
+        EXPECT_NE(AZStd::string::npos, heaptrack.find("\n- "));
+
+        allocator.DeAllocate(second, 512, 8);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class AllocationSamplerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            if (state.range(0) > 0)
+            {
+                AZ::Debug::AllocationSampler::Descriptor desc;
+                desc.m_sampleIntervalBytes = static_cast<size_t>(state.range(0));
+                AZ::AllocatorManager::Instance().StartAllocationSampling(desc);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::AllocatorManager::Instance().StopAllocationSampling();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    static const size_t s_sampledAllocationCount = 1024;
+
+    // SystemAllocator allocations with sampling disabled (0) and with the default and a shorter sample interval
+    BENCHMARK_DEFINE_F(AllocationSamplerBenchmarkFixture, SystemAllocator_AllocateDeAllocate)(benchmark::State& state)
+    {
+        auto& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZStd::vector<void*> allocations(s_sampledAllocationCount);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < s_sampledAllocationCount; ++i)
+            {
+                allocations[i] = allocator.Allocate(16 + (i & 255), 16);
+            }
+            for (size_t i = 0; i < s_sampledAllocationCount; ++i)
+            {
+                allocator.DeAllocate(allocations[i], 16 + (i & 255), 16);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * s_sampledAllocationCount);
+    }
+    BENCHMARK_REGISTER_F(AllocationSamplerBenchmarkFixture, SystemAllocator_AllocateDeAllocate)->Arg(0)->Arg(512 * 1024)->Arg(64 * 1024);
+}
+#endif // HAVE_BENCHMARK
+
+#endif // !_RELEASE
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        static const size_t BlockSize = 4 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_blockSize = BlockSize;
+            desc.m_poisonMemory = true;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        AZ::FrameArenaAllocator& GetAllocator()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignment)
+    {
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            GetAllocator().Allocate(1, 1);
+            void* address = GetAllocator().Allocate(24, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(address) & (alignment - 1));
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ReleasesAndReusesMemory)
+    {
+        void* first = GetAllocator().Allocate(64, 16);
+        ASSERT_NE(nullptr, first);
+        EXPECT_NE(nullptr, GetAllocator().Allocate(64, 16));
+        EXPECT_LE(128, GetAllocator().NumAllocatedBytes());
+        const size_t capacity = GetAllocator().Capacity();
+
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(0, GetAllocator().NumAllocatedBytes());
+
+        // the arena starts from its first block again, without growing
+        EXPECT_EQ(first, GetAllocator().Allocate(64, 16));
+        EXPECT_EQ(capacity, GetAllocator().Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_PoisonsReleasedMemory)
+    {
+        unsigned char* data = reinterpret_cast<unsigned char*>(GetAllocator().Allocate(32, 16));
+        ASSERT_NE(nullptr, data);
+        memset(data, 0x11, 32);
+
+        GetAllocator().ResetFrame();
+        for (size_t i = 0; i < 32; ++i)
+        {
+            EXPECT_EQ(AZ::FrameArenaSchema::PoisonPattern, data[i]);
+        }
+        EXPECT_EQ(data, GetAllocator().Allocate(1, 1));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ResetsArenasOfIdleThreads)
+    {
+        unsigned char* data = nullptr;
+        AZStd::thread thread([this, &data]()
+        {
+            data = reinterpret_cast<unsigned char*>(GetAllocator().Allocate(32, 16));
+            memset(data, 0x11, 32);
+        });
+        thread.join();
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(32, GetAllocator().NumAllocatedBytes());
+
+        // the thread doesn't allocate again, its arena is still released and poisoned
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(0, GetAllocator().NumAllocatedBytes());
+        for (size_t i = 0; i < 32; ++i)
+        {
+            EXPECT_EQ(AZ::FrameArenaSchema::PoisonPattern, data[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_OnlyRollsBackMostRecentAllocation)
+    {
+        void* first = GetAllocator().Allocate(64, 16);
+        void* second = GetAllocator().Allocate(64, 16);
+        const size_t allocatedBytes = GetAllocator().NumAllocatedBytes();
+
+        GetAllocator().DeAllocate(first, 64, 16);
+        EXPECT_EQ(allocatedBytes, GetAllocator().NumAllocatedBytes());
+
+        GetAllocator().DeAllocate(second, 64, 16);
+        EXPECT_EQ(allocatedBytes - 64, GetAllocator().NumAllocatedBytes());
+        EXPECT_EQ(second, GetAllocator().Allocate(64, 16));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Resize_GrowsMostRecentAllocationInPlace)
+    {
+        void* first = GetAllocator().Allocate(64, 16);
+        void* second = GetAllocator().Allocate(64, 16);
+
+        EXPECT_EQ(0, GetAllocator().Resize(first, 128));
+        EXPECT_EQ(256, GetAllocator().Resize(second, 256));
+        EXPECT_EQ(256, GetAllocator().AllocationSize(second));
+        // can't grow past the arena block
+        EXPECT_GT(BlockSize, GetAllocator().Resize(second, BlockSize));
+
+        void* reallocated = GetAllocator().ReAllocate(second, 2 * BlockSize, 16);
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_NE(second, reallocated);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, LargeAllocations_UseDedicatedBlocksReleasedOnReset)
+    {
+        const size_t capacity = GetAllocator().Capacity();
+        void* large = GetAllocator().Allocate(4 * BlockSize, 64);
+        ASSERT_NE(nullptr, large);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(large) & 63);
+        memset(large, 0, 4 * BlockSize);
+        EXPECT_LT(capacity + 4 * BlockSize, GetAllocator().Capacity() + 1);
+
+        GetAllocator().ResetFrame();
+        EXPECT_GE(capacity + BlockSize, GetAllocator().Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, GarbageCollect_TrimsArenaOnNextReset)
+    {
+        for (size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_NE(nullptr, GetAllocator().Allocate(BlockSize / 2, 16));
+        }
+        EXPECT_LE(8 * BlockSize, GetAllocator().Capacity());
+
+        GetAllocator().GarbageCollect();
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(BlockSize, GetAllocator().Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Statistics_ReportPeakFrameUsage)
+    {
+        GetAllocator().Allocate(1000, 1);
+        GetAllocator().ResetFrame();
+        GetAllocator().Allocate(100, 1);
+        EXPECT_EQ(100, GetAllocator().NumAllocatedBytes());
+        EXPECT_EQ(1000, GetAllocator().GetPeakAllocatedBytes());
+        EXPECT_EQ(1000, static_cast<AZ::FrameArenaSchema*>(GetAllocator().GetSchema())->GetLastFrameAllocatedBytes());
+
+        size_t allocatedBytes = 0;
+        size_t capacityBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> stats;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(allocatedBytes, capacityBytes, &stats);
+        auto frameArenaStats = AZStd::find_if(stats.begin(), stats.end(), [](const AZ::AllocatorManager::AllocatorStats& allocatorStats)
+        {
+            return allocatorStats.m_name == "FrameArenaAllocator";
+        });
+        ASSERT_NE(stats.end(), frameArenaStats);
+        EXPECT_EQ(100, frameArenaStats->m_allocatedBytes);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Statistics_ReportPeakThreadUsage)
+    {
+        auto* schema = static_cast<AZ::FrameArenaSchema*>(GetAllocator().GetSchema());
+        GetAllocator().Allocate(300, 1);
+        AZStd::thread thread([this]()
+        {
+            GetAllocator().Allocate(500, 1);
+        });
+        thread.join();
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(800, schema->GetLastFrameAllocatedBytes());
+        EXPECT_EQ(500, schema->GetPeakThreadAllocatedBytes());
+
+        GetAllocator().Allocate(600, 1);
+        GetAllocator().ResetFrame();
+        EXPECT_EQ(800, GetAllocator().GetPeakAllocatedBytes());
+        EXPECT_EQ(600, schema->GetPeakThreadAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Multithreaded_ThreadsUseSeparateArenas)
+    {
+        const size_t numThreads = 4;
+        const size_t numAllocations = 1000;
+        AZStd::thread threads[numThreads];
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([this, threadIndex]()
+            {
+                for (size_t frame = 0; frame < 2; ++frame)
+                {
+                    AZStd::vector<unsigned char*> allocations;
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        unsigned char* data = reinterpret_cast<unsigned char*>(GetAllocator().Allocate(16, 16));
+                        memset(data, static_cast<int>(threadIndex), 16);
+                        allocations.push_back(data);
+                    }
+                    for (unsigned char* data : allocations)
+                    {
+                        EXPECT_EQ(threadIndex, data[0]);
+                        EXPECT_EQ(threadIndex, data[15]);
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(numThreads * 2 * numAllocations * 16, GetAllocator().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_VectorGrowsInArena)
+    {
+        AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(i);
+        }
+        for (int i = 0; i < 10000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+        EXPECT_LE(10000 * sizeof(int), GetAllocator().NumAllocatedBytes());
+        // no need to free the vector memory, it's released with the frame
+        GetAllocator().ResetFrame();
+        values.leak_and_reset();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameArenaAllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    static const size_t s_frameAllocationCount = 1024;
+
+    // A frame worth of short lived scratch allocations, from the frame arenas
+    BENCHMARK_F(FrameArenaAllocatorBenchmarkFixture, FrameArena_ScratchAllocations)(benchmark::State& state)
+    {
+        auto& allocator = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < s_frameAllocationCount; ++i)
+            {
+                benchmark::DoNotOptimize(allocator.Allocate(16 + (i & 255), 16));
+            }
+            allocator.ResetFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * s_frameAllocationCount);
+    }
+
+    // The same allocations from the SystemAllocator, freed at the end of the frame
+    BENCHMARK_F(FrameArenaAllocatorBenchmarkFixture, SystemAllocator_ScratchAllocations)(benchmark::State& state)
+    {
+        auto& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZStd::vector<void*> allocations(s_frameAllocationCount);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < s_frameAllocationCount; ++i)
+            {
+                allocations[i] = allocator.Allocate(16 + (i & 255), 16);
+            }
+            for (size_t i = 0; i < s_frameAllocationCount; ++i)
+            {
+                allocator.DeAllocate(allocations[i], 16 + (i & 255), 16);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * s_frameAllocationCount);
+    }
+}
+#endif // HAVE_BENCHMARK
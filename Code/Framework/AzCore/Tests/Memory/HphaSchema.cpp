@@ -8,6 +8,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -110,6 +111,102 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_threadCacheByteSize = 64 * s_kiloByte;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTest, FreedBlocksAreReused)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        void* first = allocator.Allocate(32, 0);
+        ASSERT_NE(nullptr, first);
+        allocator.DeAllocate(first, 32);
+        void* second = allocator.Allocate(32, 0);
+        EXPECT_EQ(first, second);
+        allocator.DeAllocate(second, 32);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, CachedBlocksAreNotCountedAsAllocated)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBefore = allocator.NumAllocatedBytes();
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            allocations.push_back(allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0));
+            EXPECT_NE(nullptr, allocations.back());
+        }
+        EXPECT_LT(allocatedBefore, allocator.NumAllocatedBytes());
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+        }
+        EXPECT_EQ(allocatedBefore, allocator.NumAllocatedBytes());
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocatedBefore, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, MultithreadedAllocateAndFree_BlocksAreNotShared)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+
+        // blocks are allocated on one thread and freed on another, so they move between the thread caches
+        static const size_t numThreads = 8;
+        static const size_t numAllocationsPerThread = 2000;
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations(numThreads * numAllocationsPerThread, nullptr);
+        AZStd::thread threads[numThreads];
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&allocator, &allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocationsPerThread; ++i)
+                {
+                    const size_t size = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    void* ptr = allocator.Allocate(size, 0);
+                    EXPECT_NE(nullptr, ptr);
+                    memset(ptr, static_cast<int>(threadIndex), size);
+                    allocations[threadIndex * numAllocationsPerThread + i] = ptr;
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&allocator, &allocations, threadIndex]()
+            {
+                const size_t ownerIndex = (threadIndex + 1) % numThreads;
+                for (size_t i = 0; i < numAllocationsPerThread; ++i)
+                {
+                    const size_t size = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    unsigned char* ptr = reinterpret_cast<unsigned char*>(allocations[ownerIndex * numAllocationsPerThread + i]);
+                    EXPECT_EQ(static_cast<unsigned char>(ownerIndex), ptr[size - 1]);
+                    allocator.DeAllocate(ptr, size);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
 }
 
 
@@ -177,6 +274,53 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Multithreaded allocations of small blocks, with and without the HPHA thread caches (first argument). Every
+    // thread allocates and frees batches of blocks, so without the caches all threads contend on the bucket locks.
+    class HphaSchemaMultithreadedBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                HphaSchema_TestAllocator::Descriptor desc;
+                desc.m_threadCacheByteSize = state.range(0) ? 64 * s_kiloByte : 0;
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            }
+        }
+    };
+
+    BENCHMARK_DEFINE_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocationsAndFrees)(benchmark::State& state)
+    {
+        static const size_t batchSize = 64;
+        void* allocations[batchSize];
+        while (state.KeepRunning())
+        {
+            auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            }
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * batchSize);
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocationsAndFrees)
+        ->ArgName("ThreadCache")->Arg(0)->Arg(1)
+        ->ThreadRange(1, 16)
+        ->UseRealTime();
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/PoolSchema.h>
+#include <AzCore/Memory/ReservedAddressSpaceSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class ReservedAddressSpaceSchemaTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::ReservedAddressSpaceSchema::Descriptor desc;
+            desc.m_reservedBytes = 64 * 1024 * 1024;
+            desc.m_hugePages = AZ::ReservedAddressSpaceSchema::HugePages::None;
+            desc.m_fallbackAllocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            m_schema = azcreate(AZ::ReservedAddressSpaceSchema, (desc));
+            if (!m_schema->IsReserved())
+            {
+                GTEST_SKIP() << "Reserving address space is not supported on this platform";
+            }
+            m_pageSize = AZ::Platform::GetVirtualMemoryPageSize();
+        }
+
+        void TearDown() override
+        {
+            if (m_schema)
+            {
+                azdestroy(m_schema);
+                m_schema = nullptr;
+            }
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZ::ReservedAddressSpaceSchema* m_schema = nullptr;
+        size_t m_pageSize = 0;
+    };
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_PageSizedAllocations_AreInRangeAndPageAligned)
+    {
+        void* first = m_schema->Allocate(m_pageSize, m_pageSize);
+        void* second = m_schema->Allocate(3 * m_pageSize, m_pageSize);
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_TRUE(m_schema->IsInRange(first));
+        EXPECT_TRUE(m_schema->IsInRange(second));
+        EXPECT_EQ(0, reinterpret_cast<size_t>(first) % m_pageSize);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) % m_pageSize);
+        EXPECT_EQ(m_pageSize, m_schema->AllocationSize(first));
+        EXPECT_EQ(3 * m_pageSize, m_schema->AllocationSize(second));
+        EXPECT_EQ(4 * m_pageSize, m_schema->NumAllocatedBytes());
+        EXPECT_GE(m_schema->GetCommittedBytes(), m_schema->GetCommitGranularity());
+
+        // the memory is usable
+        memset(second, 0xcd, 3 * m_pageSize);
+
+        m_schema->DeAllocate(first);
+        m_schema->DeAllocate(second);
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, DeAllocate_FreedPages_AreReused)
+    {
+        void* first = m_schema->Allocate(2 * m_pageSize, m_pageSize);
+        void* second = m_schema->Allocate(m_pageSize, m_pageSize);
+        m_schema->DeAllocate(first);
+
+        // the lowest free pages are reused first
+        void* third = m_schema->Allocate(m_pageSize, m_pageSize);
+        void* fourth = m_schema->Allocate(m_pageSize, m_pageSize);
+        EXPECT_EQ(first, third);
+        EXPECT_EQ(static_cast<char*>(first) + m_pageSize, fourth);
+
+        m_schema->DeAllocate(second);
+        m_schema->DeAllocate(third);
+        m_schema->DeAllocate(fourth);
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_LargeAlignment_IsRespected)
+    {
+        void* unaligned = m_schema->Allocate(m_pageSize, m_pageSize);
+        const size_t alignment = 16 * m_pageSize;
+        void* aligned = m_schema->Allocate(m_pageSize, alignment);
+        ASSERT_NE(nullptr, aligned);
+        EXPECT_TRUE(m_schema->IsInRange(aligned));
+        EXPECT_EQ(0, reinterpret_cast<size_t>(aligned) % alignment);
+
+        m_schema->DeAllocate(unaligned);
+        m_schema->DeAllocate(aligned);
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_SmallOrOversizedAllocations_UseTheFallback)
+    {
+        void* small = m_schema->Allocate(64, 16, 0, "small", __FILE__, __LINE__);
+        void* oversized = m_schema->Allocate(128 * 1024 * 1024, 16, 0, "oversized", __FILE__, __LINE__);
+        ASSERT_NE(nullptr, small);
+        ASSERT_NE(nullptr, oversized);
+        EXPECT_FALSE(m_schema->IsInRange(small));
+        EXPECT_FALSE(m_schema->IsInRange(oversized));
+        EXPECT_GE(m_schema->AllocationSize(small), 64);
+        EXPECT_GE(m_schema->AllocationSize(oversized), 128 * 1024 * 1024);
+        EXPECT_EQ(m_schema->AllocationSize(small) + m_schema->AllocationSize(oversized), m_schema->NumAllocatedBytes());
+
+        m_schema->DeAllocate(small, 64, 16);
+        m_schema->DeAllocate(oversized, 128 * 1024 * 1024, 16);
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_FullRange_UsesTheFallback)
+    {
+        AZStd::vector<void*> allocations;
+        const size_t allocationSize = 4 * 1024 * 1024;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            allocations.push_back(m_schema->Allocate(allocationSize, m_pageSize));
+            EXPECT_TRUE(m_schema->IsInRange(allocations.back()));
+        }
+        EXPECT_EQ(64 * 1024 * 1024, m_schema->GetCommittedBytes());
+
+        void* overflow = m_schema->Allocate(allocationSize, m_pageSize);
+        ASSERT_NE(nullptr, overflow);
+        EXPECT_FALSE(m_schema->IsInRange(overflow));
+        m_schema->DeAllocate(overflow, allocationSize, m_pageSize);
+
+        for (void* allocation : allocations)
+        {
+            m_schema->DeAllocate(allocation, allocationSize, m_pageSize);
+        }
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, DeAllocate_FallbackWithoutSize_CountersAreRestored)
+    {
+        AZStd::vector<void*> allocations;
+        const size_t allocationSize = 4 * 1024 * 1024;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            allocations.push_back(m_schema->Allocate(allocationSize, m_pageSize));
+        }
+        const size_t allocatedBytes = m_schema->NumAllocatedBytes();
+        const size_t capacity = m_schema->Capacity();
+
+        void* overflow = m_schema->Allocate(allocationSize, m_pageSize);
+        ASSERT_NE(nullptr, overflow);
+        EXPECT_FALSE(m_schema->IsInRange(overflow));
+        EXPECT_EQ(allocatedBytes + m_schema->AllocationSize(overflow), m_schema->NumAllocatedBytes());
+        EXPECT_EQ(capacity + m_schema->AllocationSize(overflow), m_schema->Capacity());
+
+        // reallocating in the fallback updates the counters with the new size
+        void* reallocated = m_schema->ReAllocate(overflow, 2 * allocationSize, m_pageSize);
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_EQ(allocatedBytes + m_schema->AllocationSize(reallocated), m_schema->NumAllocatedBytes());
+
+        // freeing without a size removes the full allocation from the counters
+        m_schema->DeAllocate(reallocated);
+        EXPECT_EQ(allocatedBytes, m_schema->NumAllocatedBytes());
+        EXPECT_EQ(capacity, m_schema->Capacity());
+
+        for (void* allocation : allocations)
+        {
+            m_schema->DeAllocate(allocation);
+        }
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_OSHeapFallback_TracksAllocationSizes)
+    {
+        AZ::ReservedAddressSpaceSchema::Descriptor desc;
+        desc.m_reservedBytes = 16 * 1024 * 1024;
+        desc.m_hugePages = AZ::ReservedAddressSpaceSchema::HugePages::None;
+        AZ::ReservedAddressSpaceSchema* schema = azcreate(AZ::ReservedAddressSpaceSchema, (desc));
+
+        char* small = static_cast<char*>(schema->Allocate(64, 64));
+        ASSERT_NE(nullptr, small);
+        EXPECT_FALSE(schema->IsInRange(small));
+        EXPECT_EQ(0, reinterpret_cast<size_t>(small) % 64);
+        EXPECT_EQ(64, schema->AllocationSize(small));
+        EXPECT_EQ(64, schema->NumAllocatedBytes());
+
+        small[0] = 42;
+        char* reallocated = static_cast<char*>(schema->ReAllocate(small, 128, 16));
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_EQ(42, reallocated[0]);
+        EXPECT_EQ(128, schema->AllocationSize(reallocated));
+        EXPECT_EQ(128, schema->NumAllocatedBytes());
+
+        schema->DeAllocate(reallocated);
+        EXPECT_EQ(0, schema->NumAllocatedBytes());
+        azdestroy(schema);
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Resize_FreeFollowingPages_GrowsAndShrinksInPlace)
+    {
+        char* allocation = static_cast<char*>(m_schema->Allocate(2 * m_pageSize, m_pageSize));
+        EXPECT_EQ(4 * m_pageSize, m_schema->Resize(allocation, 4 * m_pageSize));
+        EXPECT_EQ(4 * m_pageSize, m_schema->AllocationSize(allocation));
+        memset(allocation, 0xcd, 4 * m_pageSize);
+
+        EXPECT_EQ(m_pageSize, m_schema->Resize(allocation, m_pageSize));
+        EXPECT_EQ(m_pageSize, m_schema->NumAllocatedBytes());
+
+        // the next allocation blocks growing
+        void* blocker = m_schema->Allocate(m_pageSize, m_pageSize);
+        EXPECT_EQ(allocation + m_pageSize, blocker);
+        EXPECT_EQ(m_pageSize, m_schema->Resize(allocation, 2 * m_pageSize));
+
+        // ReAllocate moves the allocation and keeps the content
+        allocation[0] = 42;
+        char* reallocated = static_cast<char*>(m_schema->ReAllocate(allocation, 2 * m_pageSize, m_pageSize));
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_NE(allocation, reallocated);
+        EXPECT_EQ(42, reallocated[0]);
+
+        m_schema->DeAllocate(reallocated);
+        m_schema->DeAllocate(blocker);
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, GarbageCollect_FreeChunks_ReadBackAsZero)
+    {
+        const size_t granularity = m_schema->GetCommitGranularity();
+        char* allocation = static_cast<char*>(m_schema->Allocate(granularity, m_pageSize));
+        memset(allocation, 0xcd, granularity);
+        m_schema->DeAllocate(allocation);
+        m_schema->GarbageCollect();
+
+        // decommitted memory stays accessible and is faulted back in zeroed
+        char* reused = static_cast<char*>(m_schema->Allocate(granularity, m_pageSize));
+        EXPECT_EQ(allocation, reused);
+        EXPECT_EQ(0, reused[0]);
+        EXPECT_EQ(0, reused[granularity - 1]);
+        m_schema->DeAllocate(reused);
+    }
+
+    TEST_F(ReservedAddressSpaceSchemaTest, Allocate_MultipleThreads_AllocationsDontOverlap)
+    {
+        const size_t numThreads = 4;
+        const size_t numAllocations = 256;
+        AZStd::vector<void*> allocations[numThreads];
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, &allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocations; ++i)
+                {
+                    void* allocation = m_schema->Allocate(m_pageSize * (1 + (i & 3)), m_pageSize);
+                    memset(allocation, static_cast<int>(threadIndex), m_pageSize);
+                    allocations[threadIndex].push_back(allocation);
+                    if (i & 1)
+                    {
+                        m_schema->DeAllocate(allocations[threadIndex][i / 2]);
+                        allocations[threadIndex][i / 2] = nullptr;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (void* allocation : allocations[threadIndex])
+            {
+                if (allocation)
+                {
+                    EXPECT_EQ(static_cast<char>(threadIndex), *static_cast<char*>(allocation));
+                    m_schema->DeAllocate(allocation);
+                }
+            }
+        }
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Pool heavy workload: small nodes linked in a random order, as in a scene graph or a node based container.
+    // Pool pages from the system allocator are spread over the heap (between the other allocations), pool pages from
+    // a reserved range are contiguous and can be backed by huge pages, so walking the nodes needs fewer TLB entries.
+    // TLB misses can't be counted from here, run with `perf stat -e dTLB-load-misses` to see them, the pointer chase
+    // throughput reflects them.
+    class ReservedAddressSpaceBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        struct Node
+        {
+            Node* m_next;
+            AZ::u64 m_payload[7];
+        };
+
+        static const size_t s_numNodes = 256 * 1024; // 16MB of nodes
+        static const size_t s_noiseAllocationSize = 4 * 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            // -1 uses the system allocator for the pool pages, otherwise the huge pages mode of the reserved range
+            AZ::PoolSchema::Descriptor poolDesc;
+            if (state.range(0) >= 0)
+            {
+                AZ::ReservedAddressSpaceSchema::Descriptor desc;
+                desc.m_reservedBytes = 256 * 1024 * 1024;
+                desc.m_hugePages = static_cast<AZ::ReservedAddressSpaceSchema::HugePages>(state.range(0));
+                desc.m_fallbackAllocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+                m_pageAllocator = azcreate(AZ::ReservedAddressSpaceSchema, (desc));
+                poolDesc.m_pageAllocator = m_pageAllocator;
+            }
+            m_pool = azcreate(AZ::PoolSchema, ());
+            m_pool->Create(poolDesc);
+
+            // interleave the nodes with other allocations, as a real application would
+            AZ::IAllocatorAllocate& systemAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            m_nodes.reserve(s_numNodes);
+            for (size_t i = 0; i < s_numNodes; ++i)
+            {
+                m_nodes.push_back(static_cast<Node*>(m_pool->Allocate(sizeof(Node), alignof(Node), 0, nullptr, nullptr, 0, 0)));
+                if ((i & 63) == 0)
+                {
+                    m_noise.push_back(systemAllocator.Allocate(s_noiseAllocationSize, 16));
+                }
+            }
+
+            // link the nodes in a random order
+            AZStd::vector<Node*> order = m_nodes;
+            AZ::u64 seed = 0x2545F4914F6CDD1Dull;
+            for (size_t i = order.size() - 1; i > 0; --i)
+            {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                AZStd::swap(order[i], order[seed % (i + 1)]);
+            }
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                order[i]->m_next = order[(i + 1) % order.size()];
+                order[i]->m_payload[0] = i;
+            }
+            m_head = order[0];
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            for (Node* node : m_nodes)
+            {
+                m_pool->DeAllocate(node, sizeof(Node), alignof(Node));
+            }
+            AZ::IAllocatorAllocate& systemAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            for (void* noise : m_noise)
+            {
+                systemAllocator.DeAllocate(noise, s_noiseAllocationSize, 16);
+            }
+            m_nodes = {};
+            m_noise = {};
+
+            m_pool->Destroy();
+            azdestroy(m_pool);
+            if (m_pageAllocator)
+            {
+                azdestroy(m_pageAllocator);
+            }
+            m_pool = nullptr;
+            m_pageAllocator = nullptr;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZ::ReservedAddressSpaceSchema* m_pageAllocator = nullptr;
+        AZ::PoolSchema* m_pool = nullptr;
+        AZStd::vector<Node*> m_nodes;
+        AZStd::vector<void*> m_noise;
+        Node* m_head = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(ReservedAddressSpaceBenchmarkFixture, PoolSchema_PointerChase)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::u64 sum = 0;
+            Node* node = m_head;
+            for (size_t i = 0; i < s_numNodes; ++i)
+            {
+                sum += node->m_payload[0];
+                node = node->m_next;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * s_numNodes);
+    }
+    BENCHMARK_REGISTER_F(ReservedAddressSpaceBenchmarkFixture, PoolSchema_PointerChase)
+        ->Arg(-1) // system allocator pages
+        ->Arg(static_cast<int64_t>(AZ::ReservedAddressSpaceSchema::HugePages::None))
+        ->Arg(static_cast<int64_t>(AZ::ReservedAddressSpaceSchema::HugePages::Transparent))
+        ->Arg(static_cast<int64_t>(AZ::ReservedAddressSpaceSchema::HugePages::Explicit));
+}
+#endif // HAVE_BENCHMARK
@@ -47,14 +47,19 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
-        
-        static size_t GetEntryCount()
+
+        static bool ContainsName(AZStd::string_view name)
         {
-            return GetDictionary().size();
+            bool found = false;
+            AZ::NameDictionary::Instance().VisitEntries([&found, name](AZ::Internal::NameData* nameData)
+            {
+                found |= nameData->GetName() == name;
+            });
+            return found;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -269,11 +274,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -496,6 +497,99 @@ namespace UnitTest
         AZ::NameDictionary::Create();
     }
 
+    TEST_F(NameTest, NameLiteral_ResolvesToDictionaryName)
+    {
+        const AZ::Name& literalName = AZ_NAME_LITERAL("literal");
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        EXPECT_EQ(literalName.GetStringView(), "literal");
+        EXPECT_EQ(literalName, AZ::Name("literal"));
+        EXPECT_EQ(literalName.GetHash(), NameDictionaryTester::CalcDirectHashValue("literal"));
+
+        // Every evaluation of the same literal returns the same Name
+        for (int i = 0; i < 2; ++i)
+        {
+            const AZ::Name& loopName = AZ_NAME_LITERAL("loop literal");
+            EXPECT_EQ(loopName, AZ::Name("loop literal"));
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+    }
+
+    TEST_F(NameTest, NameLiteral_MatchesResolvedCollision)
+    {
+        // Literals go through the same collision resolution as names made from strings
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+
+        // These two strings have the same 32-bit hash
+        constexpr AZStd::string_view firstText = "literal374991";
+        constexpr AZStd::string_view secondText = "literal902880";
+        ASSERT_EQ(NameDictionaryTester::CalcDirectHashValue(firstText), NameDictionaryTester::CalcDirectHashValue(secondText));
+
+        AZ::Name first{firstText};
+        AZ::Name second{secondText};
+        ASSERT_NE(first.GetHash(), second.GetHash());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+
+        // The literal with the colliding string finds the entry that was moved to the next hash
+        static const AZ::NameLiteral secondLiteral{ "literal902880" };
+        EXPECT_EQ(secondLiteral.GetName(), second);
+        EXPECT_EQ(secondLiteral.GetName().GetHash(), second.GetHash());
+        EXPECT_EQ(secondLiteral.GetStringView(), secondText);
+
+        static const AZ::NameLiteral firstLiteral{ "literal374991" };
+        EXPECT_EQ(firstLiteral.GetName(), first);
+        EXPECT_EQ(firstLiteral.GetName().GetHash(), first.GetHash());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+    }
+
+    TEST_F(NameTest, NameLiteral_ReleasedWithDictionary)
+    {
+        static const AZ::NameLiteral literal{ "released literal" };
+        EXPECT_EQ(literal.GetName().GetStringView(), "released literal");
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        // The dictionary drops the literal's reference instead of reporting it as leaked
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        // And the literal resolves again against the new dictionary
+        EXPECT_EQ(literal.GetName(), AZ::Name("released literal"));
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, ConcurrencyDataTest_LookupWhileReleasing)
+    {
+        // Lock free lookups race with other threads removing and re-adding the same names
+        constexpr int ThreadCount = 4;
+        constexpr int Iterations = 2000;
+        const AZStd::string names[] = { "alpha", "beta", "gamma", "delta" };
+        AZ::Name persistent{ "persistent" };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&names, &persistent, threadIndex]()
+            {
+                for (int i = 0; i < Iterations; ++i)
+                {
+                    const AZStd::string& nameString = names[(i + threadIndex) % AZ_ARRAY_SIZE(names)];
+                    AZ::Name name{ nameString };
+                    EXPECT_EQ(name.GetStringView(), nameString);
+                    AZ::Name found = AZ::NameDictionary::Instance().FindName(name.GetHash());
+                    EXPECT_EQ(found, name);
+                    EXPECT_EQ(AZ::Name("persistent"), persistent);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
     TEST_F(NameTest, NullTerminatedTest)
     {
         const char* buffer = "There is a name in here";
@@ -832,3 +926,137 @@ namespace UnitTest
     }
 }
 
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Creates the dictionary once for all the threads of a benchmark, with NameCount names already in it
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        static constexpr size_t NameCount = 4096;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+
+                s_names = new AZStd::vector<AZ::Name>();
+                s_strings = new AZStd::vector<AZStd::string>();
+                s_names->reserve(NameCount);
+                s_strings->reserve(NameCount);
+                for (size_t i = 0; i < NameCount; ++i)
+                {
+                    s_strings->push_back(AZStd::string::format("BenchmarkName_%zu", i));
+                    s_names->emplace_back(s_strings->back());
+                }
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                delete s_names;
+                delete s_strings;
+                s_names = nullptr;
+                s_strings = nullptr;
+
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+        static inline AZStd::vector<AZ::Name>* s_names = nullptr;
+        static inline AZStd::vector<AZStd::string>* s_strings = nullptr;
+    };
+
+    // Makes Names from strings already in the dictionary, e.g. components looking up the same parameter names every frame
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingName)(benchmark::State& state)
+    {
+        size_t index = static_cast<size_t>(state.thread_index) * 997;
+        for (auto _ : state)
+        {
+            AZ::Name name((*s_strings)[index++ % NameCount]);
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingName)->ThreadRange(1, 16)->UseRealTime();
+
+    // Looks up names by hash, like names received over the network
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_FindName)(benchmark::State& state)
+    {
+        size_t index = static_cast<size_t>(state.thread_index) * 997;
+        for (auto _ : state)
+        {
+            AZ::Name name = AZ::NameDictionary::Instance().FindName((*s_names)[index++ % NameCount].GetHash());
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_FindName)->ThreadRange(1, 16)->UseRealTime();
+
+    // Every thread creates and releases its own names, adding and removing dictionary entries
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeNewName)(benchmark::State& state)
+    {
+        constexpr size_t BatchSize = 64;
+        AZStd::vector<AZStd::string> strings;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            strings.push_back(AZStd::string::format("BenchmarkThread%d_%zu", state.thread_index, i));
+        }
+
+        AZStd::vector<AZ::Name> names(BatchSize);
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < BatchSize; ++i)
+            {
+                names[i] = AZ::Name(strings[i]);
+            }
+            for (AZ::Name& name : names)
+            {
+                name = AZ::Name();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeNewName)->ThreadRange(1, 16)->UseRealTime();
+
+    // Constant name built from a string literal on every use
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameFromLiteralString)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::Name name("BenchmarkName_42");
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameFromLiteralString)->ThreadRange(1, 16)->UseRealTime();
+
+    // The same constant name through AZ_NAME_LITERAL, hashed at compile time and resolved once
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameLiteral)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::Name name = AZ_NAME_LITERAL("BenchmarkName_42");
+            benchmark::DoNotOptimize(name);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameLiteral)->ThreadRange(1, 16)->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
@@ -8151,5 +8151,287 @@ namespace UnitTest
         m_serializeContext->Class<TestClassWithEnumFieldThatSpecializesTypeInfo>();
         m_serializeContext->DisableRemoveReflection();
     }
+
+    struct ClassPlanTestElement
+    {
+        AZ_TYPE_INFO(ClassPlanTestElement, "{5C3B6C1E-0A0B-4F8E-9C46-7B8B2E1A7D10}");
+        AZ_CLASS_ALLOCATOR(ClassPlanTestElement, AZ::SystemAllocator, 0);
+
+        int m_id = 0;
+        float m_weight = 0.0f;
+    };
+
+    struct ClassPlanTestClass
+    {
+        AZ_TYPE_INFO(ClassPlanTestClass, "{0E6B7C59-3B8D-4D43-8D0C-3C1A4F2E9B61}");
+        AZ_CLASS_ALLOCATOR(ClassPlanTestClass, AZ::SystemAllocator, 0);
+
+        static void Reflect(SerializeContext& context)
+        {
+            context.Class<ClassPlanTestElement>()
+                ->Field("Id", &ClassPlanTestElement::m_id)
+                ->Field("Weight", &ClassPlanTestElement::m_weight)
+                ;
+
+            context.Class<ClassPlanTestClass>()
+                ->Field("Name", &ClassPlanTestClass::m_name)
+                ->Field("Position", &ClassPlanTestClass::m_position)
+                ->Field("Enabled", &ClassPlanTestClass::m_enabled)
+                ->Field("Element", &ClassPlanTestClass::m_element)
+                ->Field("Elements", &ClassPlanTestClass::m_elements)
+                ;
+        }
+
+        static void Unreflect(SerializeContext& context)
+        {
+            context.EnableRemoveReflection();
+            Reflect(context);
+            context.DisableRemoveReflection();
+        }
+
+        AZStd::string m_name;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        bool m_enabled = false;
+        ClassPlanTestElement m_element;
+        AZStd::vector<ClassPlanTestElement> m_elements;
+    };
+
+    struct ClassPlanTestUnrelatedClass
+    {
+        AZ_TYPE_INFO(ClassPlanTestUnrelatedClass, "{9A1D8E0B-6C4F-4B7A-A2E3-51F0C7D8B264}");
+        int m_value = 0;
+    };
+
+    class ClassPlanSerialization
+        : public Serialization
+    {
+    public:
+        void SetUp() override
+        {
+            Serialization::SetUp();
+            ClassPlanTestClass::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            ClassPlanTestClass::Unreflect(*m_serializeContext);
+            Serialization::TearDown();
+        }
+
+        void ReflectUnrelatedClass(bool remove)
+        {
+            if (remove)
+            {
+                m_serializeContext->EnableRemoveReflection();
+            }
+            m_serializeContext->Class<ClassPlanTestUnrelatedClass>()
+                ->Field("Value", &ClassPlanTestUnrelatedClass::m_value);
+            m_serializeContext->DisableRemoveReflection();
+        }
+
+        ClassPlanTestClass CreateTestObject() const
+        {
+            ClassPlanTestClass object;
+            object.m_name = "ClassPlan";
+            object.m_position = AZ::Vector3(1.0f, 2.0f, 3.0f);
+            object.m_enabled = true;
+            object.m_element.m_id = 7;
+            object.m_element.m_weight = 0.5f;
+            for (int i = 0; i < 3; ++i)
+            {
+                ClassPlanTestElement& element = object.m_elements.emplace_back();
+                element.m_id = i;
+                element.m_weight = static_cast<float>(i) * 0.25f;
+            }
+            return object;
+        }
+
+        void CheckRoundTrip(DataStream::StreamType streamType)
+        {
+            const ClassPlanTestClass source = CreateTestObject();
+
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            ASSERT_TRUE(AZ::Utils::SaveObjectToStream(stream, streamType, &source, m_serializeContext.get()));
+
+            stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+            ClassPlanTestClass loaded;
+            ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+
+            EXPECT_EQ(source.m_name, loaded.m_name);
+            EXPECT_EQ(source.m_position, loaded.m_position);
+            EXPECT_EQ(source.m_enabled, loaded.m_enabled);
+            EXPECT_EQ(source.m_element.m_id, loaded.m_element.m_id);
+            EXPECT_EQ(source.m_element.m_weight, loaded.m_element.m_weight);
+            ASSERT_EQ(source.m_elements.size(), loaded.m_elements.size());
+            for (size_t i = 0; i < source.m_elements.size(); ++i)
+            {
+                EXPECT_EQ(source.m_elements[i].m_id, loaded.m_elements[i].m_id);
+                EXPECT_EQ(source.m_elements[i].m_weight, loaded.m_elements[i].m_weight);
+            }
+        }
+    };
+
+    TEST_F(ClassPlanSerialization, GetClassPlan_ClassWithElements_ResolvesElementClassData)
+    {
+        const SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ClassPlanTestClass>());
+        ASSERT_NE(nullptr, classData);
+
+        const SerializeContext::ClassPlan* plan = m_serializeContext->GetClassPlan(classData);
+        ASSERT_NE(nullptr, plan);
+        EXPECT_EQ(plan, m_serializeContext->GetClassPlan(classData));
+        ASSERT_EQ(classData->m_elements.size(), plan->m_elements.size());
+
+        for (size_t i = 0; i < classData->m_elements.size(); ++i)
+        {
+            const SerializeContext::ClassElement& classElement = classData->m_elements[i];
+            const SerializeContext::ClassPlan::ElementPlan& elementPlan = plan->m_elements[i];
+            EXPECT_EQ(&classElement, elementPlan.m_classElement);
+            EXPECT_EQ(&elementPlan, plan->FindElement(classElement.m_nameCrc));
+
+            const SerializeContext::ClassData* expectedClassData = classElement.m_genericClassInfo
+                ? classElement.m_genericClassInfo->GetClassData()
+                : m_serializeContext->FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+            ASSERT_NE(nullptr, expectedClassData);
+            EXPECT_EQ(expectedClassData, elementPlan.m_classData);
+            EXPECT_EQ(expectedClassData->m_typeId, elementPlan.m_streamTypeId);
+        }
+
+        EXPECT_EQ(nullptr, plan->FindElement(AZ_CRC_CE("NotAnElement")));
+    }
+
+    TEST_F(ClassPlanSerialization, GetClassPlan_ContainerOrClassWithSerializer_ReturnsNull)
+    {
+        const SerializeContext::ClassData* vectorClassData = m_serializeContext->FindClassData(azrtti_typeid<AZStd::vector<ClassPlanTestElement>>());
+        ASSERT_NE(nullptr, vectorClassData);
+        EXPECT_EQ(nullptr, m_serializeContext->GetClassPlan(vectorClassData));
+
+        const SerializeContext::ClassData* floatClassData = m_serializeContext->FindClassData(azrtti_typeid<float>());
+        ASSERT_NE(nullptr, floatClassData);
+        EXPECT_EQ(nullptr, m_serializeContext->GetClassPlan(floatClassData));
+
+        EXPECT_EQ(nullptr, m_serializeContext->GetClassPlan(nullptr));
+    }
+
+    TEST_F(ClassPlanSerialization, GetClassPlan_ReflectionChanged_RecompilesPlan)
+    {
+        const SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ClassPlanTestClass>());
+        ASSERT_NE(nullptr, classData);
+        const SerializeContext::ClassPlan* plan = m_serializeContext->GetClassPlan(classData);
+        ASSERT_NE(nullptr, plan);
+
+        ReflectUnrelatedClass(false);
+        classData = m_serializeContext->FindClassData(azrtti_typeid<ClassPlanTestClass>());
+        ASSERT_NE(nullptr, classData);
+        const SerializeContext::ClassPlan* recompiledPlan = m_serializeContext->GetClassPlan(classData);
+        ASSERT_NE(nullptr, recompiledPlan);
+        EXPECT_NE(plan->m_generation, recompiledPlan->m_generation);
+        EXPECT_EQ(classData->m_elements.size(), recompiledPlan->m_elements.size());
+
+        ReflectUnrelatedClass(true);
+    }
+
+    TEST_F(ClassPlanSerialization, GetClassPlan_RepeatedReflectionChanges_ReplacedPlansAreFreed)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            const SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ClassPlanTestClass>());
+            ASSERT_NE(nullptr, classData);
+            ASSERT_NE(nullptr, m_serializeContext->GetClassPlan(classData));
+
+            // Recompiling retires the previous plan, which is freed on the next reflection change
+            ReflectUnrelatedClass(i % 2 != 0);
+            EXPECT_EQ(0, m_serializeContext->GetNumRetiredClassPlans());
+            ASSERT_NE(nullptr, m_serializeContext->GetClassPlan(classData));
+            EXPECT_EQ(1, m_serializeContext->GetNumRetiredClassPlans());
+        }
+        ReflectUnrelatedClass(true);
+        EXPECT_EQ(0, m_serializeContext->GetNumRetiredClassPlans());
+    }
+
+    TEST_F(ClassPlanSerialization, ObjectStream_BinaryRoundTrip_LoadsAllElements)
+    {
+        CheckRoundTrip(DataStream::ST_BINARY);
+    }
+
+    TEST_F(ClassPlanSerialization, ObjectStream_XmlRoundTrip_LoadsAllElements)
+    {
+        CheckRoundTrip(DataStream::ST_XML);
+    }
+
+    TEST_F(ClassPlanSerialization, ObjectStream_ReflectionChangedBetweenLoads_LoadsAllElements)
+    {
+        CheckRoundTrip(DataStream::ST_BINARY);
+        ReflectUnrelatedClass(false);
+        CheckRoundTrip(DataStream::ST_BINARY);
+        ReflectUnrelatedClass(true);
+        CheckRoundTrip(DataStream::ST_BINARY);
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SerializationLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            UnitTest::ClassPlanTestClass::Reflect(*m_serializeContext);
+
+            AZStd::vector<UnitTest::ClassPlanTestClass> objects(static_cast<size_t>(state.range(0)));
+            for (size_t i = 0; i < objects.size(); ++i)
+            {
+                objects[i].m_name = AZStd::string::format("Object%zu", i);
+                objects[i].m_position = AZ::Vector3(static_cast<float>(i));
+                objects[i].m_element.m_id = static_cast<int>(i);
+                objects[i].m_elements.resize(4);
+            }
+
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &objects, m_serializeContext.get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_buffer = {};
+            UnitTest::ClassPlanTestClass::Unreflect(*m_serializeContext);
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(SerializationLoadBenchmarkFixture, LoadBinaryObjectStream)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::IO::MemoryStream stream(m_buffer.data(), m_buffer.size());
+            AZStd::vector<UnitTest::ClassPlanTestClass> objects;
+            AZ::Utils::LoadObjectFromStreamInPlace(stream, objects, m_serializeContext.get());
+            benchmark::DoNotOptimize(objects.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * m_buffer.size());
+    }
+    BENCHMARK_REGISTER_F(SerializationLoadBenchmarkFixture, LoadBinaryObjectStream)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializationLoadBenchmarkFixture, CloneObject)(benchmark::State& state)
+    {
+        AZStd::vector<UnitTest::ClassPlanTestClass> source;
+        AZ::IO::MemoryStream stream(m_buffer.data(), m_buffer.size());
+        AZ::Utils::LoadObjectFromStreamInPlace(stream, source, m_serializeContext.get());
+        for (auto _ : state)
+        {
+            AZStd::vector<UnitTest::ClassPlanTestClass> objects;
+            m_serializeContext->CloneObjectInplace(objects, &source);
+            benchmark::DoNotOptimize(objects.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(SerializationLoadBenchmarkFixture, CloneObject)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+}
+#endif
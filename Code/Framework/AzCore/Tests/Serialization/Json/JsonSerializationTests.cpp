@@ -7,7 +7,10 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -38,6 +41,21 @@ namespace JsonSerializationTests
 
     TYPED_TEST_CASE(TypedJsonSerializationTests, JsonSerializationTestCases);
 
+    template<typename T>
+    AZ::JsonSerializationResult::ResultCode LoadFromJsonString(T& object, AZStd::string_view json, AZ::JsonDeserializerSettings& settings)
+    {
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        return AZ::JsonSerialization::LoadFromStream(object, stream, settings);
+    }
+
+    AZStd::string WriteToJsonString(const rapidjson::Value& value)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        value.Accept(writer);
+        return AZStd::string(buffer.GetString(), buffer.GetSize());
+    }
+
     TYPED_TEST(TypedJsonSerializationTests, Store_SerializedDefaultInstance_EmptyJsonReturned)
     {
         using namespace AZ::JsonSerializationResult;
@@ -204,6 +222,70 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_EmptyJson_SucceedsAndObjectMatchesDefaults)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = LoadFromJsonString(loadInstance, "{}", *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        TypeParam expectedInstance;
+        EXPECT_TRUE(loadInstance.Equals(expectedInstance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = LoadFromJsonString(loadInstance, description.m_json, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithSomeDefaults_ResultMatchesLoadFromDocument)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = LoadFromJsonString(loadInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonAdditionalFields_ResultMatchesLoadFromDocument)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_json);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = LoadFromJsonString(loadInstance, WriteToJsonString(*this->m_jsonDocument), *this->m_deserializationSettings);
+        ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_EQ(documentResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -333,6 +415,95 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    // LoadFromStream
+
+    TEST_F(JsonSerializationTests, LoadFromStream_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        bool loadValue = false;
+        ResultCode loadResult = LoadFromJsonString(loadValue, "true", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadValue);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = LoadFromJsonString(loadValues, "[13,42,88]", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_CommentsAndExplicitDefaults_ResultMatchesLoadFromDocument)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        const char* json = R"({
+                // Comments and trailing commas are accepted the same way as when parsing a document.
+                "pointer":
+                {
+                    "$type": "BaseClass",
+                    "base_var": 8.0,
+                },
+                "unknown": { "nested": [ 1, 2, { "deeper": true } ] },
+            })";
+        m_jsonDocument->Parse<rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag>(json);
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+
+        ComplexNullInheritedPointer documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *m_jsonDocument, *m_deserializationSettings);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = LoadFromJsonString(instance, json, *m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), loadResult.GetProcessing());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        EXPECT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<BaseClass>());
+        EXPECT_FLOAT_EQ(8.0f, instance.m_pointer->m_baseVar);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidPointerName_FailsToConvert)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = LoadFromJsonString(instance, R"({ "pointer": { "$type": "Invalid" } })", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Unknown, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass instance;
+        ResultCode loadResult = LoadFromJsonString(instance, R"({ "var1": 88, "var2": })", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_LoadToNullPtr_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        AZ::IO::MemoryStream stream("42", 2);
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(nullptr, azrtti_typeid<int>(), stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
@@ -566,3 +737,198 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
     }
 } // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    struct JsonLoadBenchmarkComponent
+    {
+        AZ_TYPE_INFO(JsonLoadBenchmarkComponent, "{7F0B6E8C-2D4A-4E71-9C3B-5A1F8D6E2B47}");
+
+        AZStd::string m_name;
+        AZ::u64 m_id{ 0 };
+        bool m_enabled{ true };
+        AZStd::vector<float> m_values;
+    };
+
+    struct JsonLoadBenchmarkEntity
+    {
+        AZ_TYPE_INFO(JsonLoadBenchmarkEntity, "{3C9D2A71-8E5B-4F06-B1D7-6E2C4A9F8013}");
+
+        AZStd::string m_name;
+        AZ::u64 m_id{ 0 };
+        JsonLoadBenchmarkComponent m_transform;
+        AZStd::vector<JsonLoadBenchmarkComponent> m_components;
+    };
+
+    struct JsonLoadBenchmarkPrefab
+    {
+        AZ_TYPE_INFO(JsonLoadBenchmarkPrefab, "{A4E81F53-6B2C-4D97-8F0A-1D5C7B3E9264}");
+
+        AZStd::string m_source;
+        JsonLoadBenchmarkEntity m_containerEntity;
+        AZStd::vector<JsonLoadBenchmarkEntity> m_entities;
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<JsonLoadBenchmarkComponent>()
+                ->Field("Name", &JsonLoadBenchmarkComponent::m_name)
+                ->Field("Id", &JsonLoadBenchmarkComponent::m_id)
+                ->Field("Enabled", &JsonLoadBenchmarkComponent::m_enabled)
+                ->Field("Values", &JsonLoadBenchmarkComponent::m_values);
+            context.Class<JsonLoadBenchmarkEntity>()
+                ->Field("Name", &JsonLoadBenchmarkEntity::m_name)
+                ->Field("Id", &JsonLoadBenchmarkEntity::m_id)
+                ->Field("Transform", &JsonLoadBenchmarkEntity::m_transform)
+                ->Field("Components", &JsonLoadBenchmarkEntity::m_components);
+            context.Class<JsonLoadBenchmarkPrefab>()
+                ->Field("Source", &JsonLoadBenchmarkPrefab::m_source)
+                ->Field("ContainerEntity", &JsonLoadBenchmarkPrefab::m_containerEntity)
+                ->Field("Entities", &JsonLoadBenchmarkPrefab::m_entities);
+        }
+    };
+
+    //! Loads prefab-like documents of several megabytes with and without building the json document first. Besides the
+    //! time, the peak number of bytes in use by the system allocator during a load is reported as "PeakBytes".
+    class JsonLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZ::JsonSystemComponent::CreateDescriptor();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_registrationContext.get());
+            JsonLoadBenchmarkPrefab::Reflect(*m_serializeContext);
+
+            JsonLoadBenchmarkPrefab prefab;
+            prefab.m_source = "Levels/Benchmark/Benchmark.prefab";
+            prefab.m_containerEntity.m_name = "ContainerEntity";
+            prefab.m_entities.resize(static_cast<size_t>(state.range(0)));
+            for (size_t i = 0; i < prefab.m_entities.size(); ++i)
+            {
+                JsonLoadBenchmarkEntity& entity = prefab.m_entities[i];
+                entity.m_name = AZStd::string::format("Entity_%zu", i);
+                entity.m_id = 0x1000'0000'0000 + i;
+                entity.m_transform.m_name = "TransformComponent";
+                entity.m_transform.m_values = { 1.0f, 2.0f, 3.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+                entity.m_components.resize(4);
+                for (size_t c = 0; c < entity.m_components.size(); ++c)
+                {
+                    JsonLoadBenchmarkComponent& component = entity.m_components[c];
+                    component.m_name = AZStd::string::format("Component_%zu", c);
+                    component.m_id = (i << 8) + c;
+                    component.m_values.resize(8, static_cast<float>(c) * 0.5f);
+                }
+            }
+
+            AZ::JsonSerializerSettings storeSettings;
+            storeSettings.m_serializeContext = m_serializeContext.get();
+            storeSettings.m_registrationContext = m_registrationContext.get();
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), prefab, storeSettings);
+
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            document.Accept(writer);
+            m_json.assign(buffer.GetString(), buffer.GetSize());
+
+            m_loadSettings.m_serializeContext = m_serializeContext.get();
+            m_loadSettings.m_registrationContext = m_registrationContext.get();
+            m_loadSettings.m_reporting = [this](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result, AZStd::string_view)
+            {
+                SamplePeakBytes();
+                return result;
+            };
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_loadSettings = {};
+            m_json = {};
+
+            m_serializeContext->EnableRemoveReflection();
+            m_registrationContext->EnableRemoveReflection();
+            JsonLoadBenchmarkPrefab::Reflect(*m_serializeContext);
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_registrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_registrationContext->DisableRemoveReflection();
+            delete m_jsonSystemComponent;
+            m_jsonSystemComponent = nullptr;
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SamplePeakBytes()
+        {
+            m_peakBytes = AZStd::max(m_peakBytes, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes() - m_baselineBytes);
+        }
+
+        void BeginLoad()
+        {
+            m_baselineBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+            m_peakBytes = 0;
+        }
+
+        void ReportResults(::benchmark::State& state)
+        {
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * m_json.size());
+            state.counters["JsonBytes"] = static_cast<double>(m_json.size());
+            state.counters["PeakBytes"] = static_cast<double>(m_peakBytes);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZ::ComponentDescriptor* m_jsonSystemComponent{ nullptr };
+        AZ::JsonDeserializerSettings m_loadSettings;
+        AZStd::string m_json;
+        size_t m_baselineBytes{ 0 };
+        size_t m_peakBytes{ 0 };
+    };
+
+    BENCHMARK_DEFINE_F(JsonLoadBenchmarkFixture, LoadFromDocument)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            BeginLoad();
+            {
+                // The file data is also held in memory in this case, as the document is parsed from it.
+                AZStd::string fileData(m_json);
+                rapidjson::Document document;
+                document.Parse<rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag>(fileData.c_str(), fileData.size());
+                SamplePeakBytes();
+
+                JsonLoadBenchmarkPrefab prefab;
+                AZ::JsonSerialization::Load(prefab, document, m_loadSettings);
+                benchmark::DoNotOptimize(prefab.m_entities.data());
+            }
+        }
+        ReportResults(state);
+    }
+    BENCHMARK_REGISTER_F(JsonLoadBenchmarkFixture, LoadFromDocument)->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonLoadBenchmarkFixture, LoadFromStream)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            BeginLoad();
+            {
+                AZ::IO::MemoryStream stream(m_json.data(), m_json.size());
+                JsonLoadBenchmarkPrefab prefab;
+                AZ::JsonSerialization::LoadFromStream(prefab, stream, m_loadSettings);
+                benchmark::DoNotOptimize(prefab.m_entities.data());
+            }
+        }
+        ReportResults(state);
+    }
+    BENCHMARK_REGISTER_F(JsonLoadBenchmarkFixture, LoadFromStream)->RangeMultiplier(4)->Range(1024, 16384)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif
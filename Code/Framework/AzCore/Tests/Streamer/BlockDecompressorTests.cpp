@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class BlockDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<BlockDecompressor>
+    {
+    public:
+        static constexpr u32 m_arbitrarilyLargeAlignment = 4096;
+
+        BlockDecompressor CreateInstance() override
+        {
+            return BlockDecompressor(2, 2, 256 * 1024, m_arbitrarilyLargeAlignment);
+        }
+
+        void SetUp() override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_BlockDecompressorConformityTests, StreamStackEntryConformityTests, BlockDecompressorTestDescription);
+
+    class Streamer_BlockDecompressorTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        enum class ReadResult
+        {
+            Success,
+            Failed,
+            Canceled
+        };
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+
+            delete[] m_buffer;
+            m_buffer = nullptr;
+
+            delete m_context;
+            m_context = nullptr;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, size_t readBufferSize)
+        {
+            m_buffer = new u32[m_fakeFileLength >> 2];
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_decompressor = AZStd::make_shared<BlockDecompressor>(maxNumReads, maxNumJobs, readBufferSize,
+                BlockDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+
+            m_context = new StreamerContext();
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+        }
+
+        void SetupEnvironment()
+        {
+            SetupEnvironment(1, 4, m_fakeFileLength);
+        }
+
+        void MockReadCalls(ReadResult mockResult)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::AtLeast;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AtLeast(1));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+            switch (mockResult)
+            {
+            case ReadResult::Success:
+                ON_CALL(*m_mock, QueueRequest(_))
+                    .WillByDefault(Invoke(this, &Streamer_BlockDecompressorTest::PrepareReadRequest));
+                break;
+            case ReadResult::Failed:
+                ON_CALL(*m_mock, QueueRequest(_))
+                    .WillByDefault(Invoke(this, &Streamer_BlockDecompressorTest::PrepareFailedReadRequest));
+                break;
+            case ReadResult::Canceled:
+                ON_CALL(*m_mock, QueueRequest(_))
+                    .WillByDefault(Invoke(this, &Streamer_BlockDecompressorTest::PrepareCanceledReadRequest));
+                break;
+            default:
+                AZ_Assert(false, "Unexpected mock result type.");
+            }
+        }
+
+        void PrepareReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            u64 size = data->m_size >> 2;
+            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+            for (u64 i = 0; i < size; ++i)
+            {
+                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+            }
+            m_numReads++;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void PrepareFailedReadRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void PrepareCanceledReadRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        static bool Decompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            AZ_Assert(compressedSize == uncompressedBufferSize, "Fake decompression algorithm only supports copying data.");
+            memcpy(uncompressed, compressed, compressedSize);
+            return true;
+        }
+
+        static bool CorruptedDecompressor(const CompressionInfo&, const void*, size_t, void*, size_t)
+        {
+            return false;
+        }
+
+        //! Creates compression information for a file that's "compressed" by storing every block as is.
+        CompressionInfo CreateCompressionInfo(bool corrupted = false)
+        {
+            auto blockTable = AZStd::make_shared<CompressedBlockTable>();
+            blockTable->m_blockSize = m_blockSize;
+            for (u64 offset = 0; offset < m_fakeFileLength; offset += m_blockSize)
+            {
+                blockTable->m_blockOffsets.push_back(offset);
+            }
+            blockTable->m_blockOffsets.push_back(m_fakeFileLength);
+
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_blockTable = AZStd::move(blockTable);
+            if (corrupted)
+            {
+                compressionInfo.m_decompressor = &Streamer_BlockDecompressorTest::CorruptedDecompressor;
+            }
+            else
+            {
+                compressionInfo.m_decompressor = &Streamer_BlockDecompressorTest::Decompressor;
+            }
+            return compressionInfo;
+        }
+
+        void ProcessRequests()
+        {
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+        void ProcessCompressedRead(CompressionInfo compressionInfo, u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
+            bool result = false;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            ProcessRequests();
+
+            EXPECT_TRUE(result);
+        }
+
+        void ProcessMultipleCompressedReads()
+        {
+            static const constexpr size_t count = 16;
+
+            MockReadCalls(ReadResult::Success);
+            CompressionInfo compressionInfo = CreateCompressionInfo();
+
+            bool allCompleted = true;
+            size_t numCompleted = 0;
+            auto completed = [&allCompleted, &numCompleted](const FileRequest& request)
+            {
+                allCompleted = allCompleted && request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+                numCompleted++;
+            };
+
+            AZStd::unique_ptr<u32[]> buffers[count];
+            for (size_t i = 0; i < count; ++i)
+            {
+                // Read overlapping sections that start and end in the middle of blocks.
+                u64 offset = (i * m_blockSize) / 3;
+                buffers[i] = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+                FileRequest* request = m_context->GetNewInternalRequest();
+                request->CreateCompressedRead(nullptr, compressionInfo, buffers[i].get(), offset, m_fakeFileLength - offset);
+                request->SetCompletionCallback(completed);
+                m_decompressor->QueueRequest(request);
+            }
+
+            ProcessRequests();
+
+            EXPECT_TRUE(allCompleted);
+            EXPECT_EQ(count, numCompleted);
+            for (size_t i = 0; i < count; ++i)
+            {
+                u64 offset = (i * m_blockSize) / 3;
+                VerifyReadBuffer(buffers[i].get(), offset, m_fakeFileLength - offset);
+            }
+        }
+
+        void VerifyReadBuffer(u32* buffer, u64 offset, u64 size)
+        {
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(buffer[i], offset + (i << 2));
+            }
+        }
+
+        void VerifyReadBuffer(u64 offset, u64 size)
+        {
+            VerifyReadBuffer(m_buffer, offset, size);
+        }
+
+        u32* m_buffer{ nullptr };
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<BlockDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u32 m_blockSize{ 64 * 1024 };
+        size_t m_numReads{ 0 };
+    };
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FullRead_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(CreateCompressionInfo(), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_PartialReadAcrossBlocks_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(CreateCompressionInfo(), 256, m_fakeFileLength - 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_PartialReadInsideSingleBlock_OnlySingleBlockIsRead)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        u64 offset = m_blockSize * 3 + 1024;
+        ProcessCompressedRead(CreateCompressionInfo(), offset, 2048, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, 2048);
+        EXPECT_EQ(1, m_numReads);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_BlocksDontFitInReadBuffer_ReadIsSplitOverMultipleReads)
+    {
+        SetupEnvironment(2, 2, m_blockSize * 2);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(CreateCompressionInfo(), 256, m_fakeFileLength - 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+        EXPECT_LT(1, m_numReads);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_BlockLargerThanReadBuffer_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, m_blockSize / 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(CreateCompressionInfo(), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FailedRead_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Failed);
+        ProcessCompressedRead(CreateCompressionInfo(), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FailedReadWithMultipleReads_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment(1, 1, m_blockSize);
+        MockReadCalls(ReadResult::Failed);
+        ProcessCompressedRead(CreateCompressionInfo(), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CanceledRead_CancelIsDetectedAndReported)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Canceled);
+        ProcessCompressedRead(CreateCompressionInfo(), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Canceled);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CorruptedBlock_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(CreateCompressionInfo(true), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_BlockTableDoesNotMatchFile_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment();
+        CompressionInfo compressionInfo = CreateCompressionInfo();
+        auto blockTable = AZStd::make_shared<CompressedBlockTable>(*compressionInfo.m_blockTable);
+        blockTable->m_blockOffsets.pop_back();
+        compressionInfo.m_blockTable = AZStd::move(blockTable);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        ProcessCompressedRead(AZStd::move(compressionInfo), 0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, QueueRequest_CompressedReadWithoutBlockTable_RequestIsForwarded)
+    {
+        using ::testing::_;
+
+        SetupEnvironment();
+        CompressionInfo compressionInfo = CreateCompressionInfo();
+        compressionInfo.m_blockTable.reset();
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, 0, m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(request));
+        m_decompressor->QueueRequest(request);
+
+        m_context->RecycleRequest(request);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
+    {
+        SetupEnvironment(4, 1, m_blockSize * 4);
+        ProcessMultipleCompressedReads();
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithSingleRead_AllRequestsComplete)
+    {
+        SetupEnvironment(1, 4, m_blockSize * 4);
+        ProcessMultipleCompressedReads();
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithMultipleReadsAndJobs_AllRequestsComplete)
+    {
+        SetupEnvironment(4, 4, m_blockSize * 4);
+        ProcessMultipleCompressedReads();
+    }
+} // namespace AZ::IO
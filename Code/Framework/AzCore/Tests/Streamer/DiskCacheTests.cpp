@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/DiskCache.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class DiskCacheTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<DiskCache>
+    {
+    public:
+        DiskCache CreateInstance() override
+        {
+            return DiskCache(m_tempDirectory.GetDirectory(), 1 * 1024 * 1024, 64 * 1024);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+
+    private:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_DiskCacheConformityTests, StreamStackEntryConformityTests, DiskCacheTestDescription);
+
+    class Streamer_DiskCacheTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            m_cachePath = m_tempDirectory.Resolve("Cache");
+            m_path.InitFromAbsolutePath(m_tempDirectory.Resolve("Source.bin"));
+            CreateSourceFile(m_fakeFileLength);
+
+            m_context = new StreamerContext();
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_buffer = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_mock.reset();
+            m_buffer.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void CreateSourceFile(u64 size)
+        {
+            // Only the size and modification time of the file are checked by the cache. The data is provided by the mock.
+            AZStd::vector<u8> data(size, 0);
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_path.GetAbsolutePath(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(data.data(), data.size());
+            file.Close();
+        }
+
+        void CreateCache(u64 cacheSize)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            m_cache = AZStd::make_shared<DiskCache>(m_cachePath, cacheSize, m_blockSize);
+            m_cache->SetContext(*m_context);
+            m_cache->SetNext(m_mock);
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_)).WillByDefault(Invoke(this, &Streamer_DiskCacheTest::CompleteReadRequest));
+        }
+
+        void CompleteReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            u64 size = data->m_size >> 2;
+            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+            for (u64 i = 0; i < size; ++i)
+            {
+                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+            }
+            m_numReads++;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void ProcessRequests()
+        {
+            bool hasCompleted = false;
+            while (m_cache->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_cache->UpdateStatus(status);
+                hasCompleted = status.m_isIdle;
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+        void ProcessRead(u64 offset, u64 size)
+        {
+            memset(m_buffer.get(), 0, m_fakeFileLength);
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, m_buffer.get(), m_fakeFileLength, m_path, offset, size);
+            bool result = false;
+            request->SetCompletionCallback([&result](const FileRequest& request)
+                {
+                    result = request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+                });
+
+            m_cache->QueueRequest(request);
+            ProcessRequests();
+
+            EXPECT_TRUE(result);
+            VerifyReadBuffer(offset, size);
+        }
+
+        void VerifyReadBuffer(u64 offset, u64 size)
+        {
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(m_buffer[i], offset + (i << 2));
+            }
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::string m_cachePath;
+        RequestPath m_path;
+        AZStd::unique_ptr<u32[]> m_buffer;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<DiskCache> m_cache;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u32 m_blockSize{ 64 * 1024 };
+        size_t m_numReads{ 0 };
+    };
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_FirstRead_DataIsReadFromNextAndCached)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+
+        ProcessRead(0, m_fakeFileLength);
+
+        EXPECT_EQ(1, m_numReads);
+        EXPECT_EQ(m_fakeFileLength / m_blockSize, m_cache->GetNumCachedBlocks());
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_SecondRead_DataIsServedFromCache)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+
+        ProcessRead(0, m_fakeFileLength);
+        ProcessRead(0, m_fakeFileLength);
+
+        EXPECT_EQ(1, m_numReads);
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_PartialBlocks_FullBlocksAreReadAndRequestedSectionIsCopied)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(3);
+
+        // Start and end in the middle of a block, so the prolog and epilog blocks are read separately from the main section.
+        u64 offset = m_blockSize + 1024;
+        u64 size = m_blockSize * 3;
+        ProcessRead(offset, size);
+        EXPECT_EQ(4, m_cache->GetNumCachedBlocks());
+
+        // A read that falls entirely inside the cached blocks doesn't need to read from the original file.
+        ProcessRead(m_blockSize * 2 + 512, m_blockSize);
+        EXPECT_EQ(3, m_numReads);
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_NewInstanceOfCache_CachedDataIsRestoredFromDisk)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+        ProcessRead(0, m_fakeFileLength);
+        m_cache.reset();
+
+        CreateCache(m_fakeFileLength);
+        ProcessRead(0, m_fakeFileLength);
+
+        EXPECT_EQ(1, m_numReads);
+        EXPECT_EQ(m_fakeFileLength / m_blockSize, m_cache->GetNumCachedBlocks());
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_OriginalFileChanged_CachedDataIsDiscarded)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(2);
+        ProcessRead(0, m_blockSize);
+        m_cache.reset();
+
+        CreateSourceFile(m_fakeFileLength - m_blockSize);
+        CreateCache(m_fakeFileLength);
+        ProcessRead(0, m_blockSize);
+
+        EXPECT_EQ(2, m_numReads);
+        EXPECT_EQ(1, m_cache->GetNumCachedBlocks());
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_CorruptedIndex_CacheStartsEmpty)
+    {
+        using ::testing::_;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(2);
+        ProcessRead(0, m_blockSize);
+        m_cache.reset();
+
+        AZStd::string indexPath = m_cachePath + "/StreamerCache.index";
+        u64 indexSize = SystemFile::Length(indexPath.c_str());
+        SystemFile indexFile;
+        ASSERT_TRUE(indexFile.Open(indexPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+        AZStd::vector<u8> garbage(indexSize / 2, 0xa5);
+        indexFile.Write(garbage.data(), garbage.size());
+        indexFile.Close();
+
+        CreateCache(m_fakeFileLength);
+        ProcessRead(0, m_blockSize);
+
+        EXPECT_EQ(2, m_numReads);
+    }
+
+    TEST_F(Streamer_DiskCacheTest, ReadFile_CacheIsFull_LeastRecentlyUsedBlocksAreEvicted)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        // Room for 4 blocks.
+        CreateCache(m_blockSize * 4);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+
+        ProcessRead(0, m_blockSize);
+        for (u64 i = 1; i < 8; ++i)
+        {
+            // Keep the first block in use so it stays in the cache.
+            ProcessRead(0, m_blockSize);
+            ProcessRead(i * m_blockSize, m_blockSize);
+        }
+        EXPECT_GE(4, m_cache->GetNumCachedBlocks());
+
+        size_t numReads = m_numReads;
+        ProcessRead(0, m_blockSize);
+        EXPECT_EQ(numReads, m_numReads);
+    }
+
+    TEST_F(Streamer_DiskCacheTest, FlushAll_CachedBlocksAreRemoved)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+        using ::testing::Return;
+
+        CreateCache(m_fakeFileLength);
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+        ProcessRead(0, m_fakeFileLength);
+        EXPECT_EQ(m_fakeFileLength / m_blockSize, m_cache->GetNumCachedBlocks());
+
+        FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        EXPECT_CALL(*m_mock, QueueRequest(flushRequest)).WillOnce(Return());
+        m_cache->QueueRequest(flushRequest);
+        m_context->RecycleRequest(flushRequest);
+
+        EXPECT_EQ(0, m_cache->GetNumCachedBlocks());
+    }
+} // namespace AZ::IO
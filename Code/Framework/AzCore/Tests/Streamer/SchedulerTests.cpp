@@ -6,6 +6,7 @@
  */
 
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/std/parallel/atomic.h>
@@ -13,6 +14,7 @@
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
 #include <Tests/Streamer/IStreamerTypesMock.h>
 #include <Tests/Streamer/StreamStackEntryMock.h>
 
@@ -32,6 +34,10 @@ namespace AZ::IO
             
             UnitTest::AllocatorsFixture::SetUp();
 
+            // File paths are resolved through the FileIOBase when reads are compared for merging.
+            m_prevFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(&m_fileIO);
+
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             ON_CALL(*m_mock, PrepareRequest(_)).WillByDefault([this](FileRequest* request) { m_mock->ForwardPrepareRequest(request); });
             ON_CALL(*m_mock, QueueRequest(_)).WillByDefault([this](FileRequest* request)   { m_mock->ForwardQueueRequest(request); });
@@ -70,10 +76,12 @@ namespace AZ::IO
             }
             m_mock.reset();
 
+            FileIOBase::SetInstance(m_prevFileIO);
+
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void MockForRead()
+        void MockForRead(int numPreparedReads = 1)
         {
             using ::testing::_;
             using ::testing::AtLeast;
@@ -81,8 +89,8 @@ namespace AZ::IO
             EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
             EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
             EXPECT_CALL(*m_mock, PrepareRequest(_))
-                .Times(1)
-                .WillOnce([this](FileRequest* request)
+                .Times(numPreparedReads)
+                .WillRepeatedly([this](FileRequest* request)
                     {
                         AZ_Assert(m_streamerContext, "AZ::IO::Streamer is not ready to process requests.");
                         auto readData = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand());
@@ -111,6 +119,86 @@ namespace AZ::IO
                     });
         }
 
+        //! Sets up the mock to combine reads, but holds on to the combined read instead of completing it. The held read is
+        //! canceled by a cancel request that targets it, or completed with data when m_completeHeldReadOnCancel is set and
+        //! a cancel for another request arrives. Completion estimates are set on the held read when it's scheduled.
+        void MockForHeldMergedRead(int numPreparedReads)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::AtLeast;
+
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+            EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _))
+                .Times(AtLeast(1))
+                .WillRepeatedly([this](AZStd::chrono::system_clock::time_point, AZStd::vector<FileRequest*>&,
+                    StreamerContext::PreparedQueue::iterator, StreamerContext::PreparedQueue::iterator)
+                    {
+                        if (m_heldRead)
+                        {
+                            m_heldRead->SetEstimatedCompletion(m_heldReadEstimate);
+                        }
+                    });
+            EXPECT_CALL(*m_mock, PrepareRequest(_))
+                .Times(AtLeast(numPreparedReads))
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        AZ_Assert(m_streamerContext, "AZ::IO::Streamer is not ready to process requests.");
+                        auto readData = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand());
+                        if (!readData)
+                        {
+                            m_mock->ForwardPrepareRequest(request);
+                            return;
+                        }
+                        FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                        read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                            readData->m_offset, readData->m_size);
+                        m_streamerContext->PushPreparedRequest(read);
+                    });
+            EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, QueueRequest(_))
+                .Times(AtLeast(1))
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        AZ_Assert(m_streamerContext, "AZ::IO::Streamer is not ready to process requests.");
+                        if (AZStd::holds_alternative<FileRequest::ReadData>(request->GetCommand()))
+                        {
+                            AZ_Assert(m_heldRead == nullptr, "Test expected all reads to be combined into a single read.");
+                            auto readRequest = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+                            AZ_Assert(readRequest, "Combined read isn't linked to a read request.");
+                            m_heldReadDeadline = readRequest->m_deadline;
+                            m_heldReadPriority = readRequest->m_priority;
+                            m_heldRead = request;
+                            m_heldReadSync.release();
+                            return;
+                        }
+
+                        auto cancelData = AZStd::get_if<FileRequest::CancelData>(&request->GetCommand());
+                        if (cancelData && m_heldRead)
+                        {
+                            if (m_heldRead->WorksOn(cancelData->m_target))
+                            {
+                                m_heldRead->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                                m_streamerContext->MarkRequestAsCompleted(m_heldRead);
+                                m_heldRead = nullptr;
+                            }
+                            else if (m_completeHeldReadOnCancel)
+                            {
+                                auto& readData = AZStd::get<FileRequest::ReadData>(m_heldRead->GetCommand());
+                                auto output = reinterpret_cast<uint8_t*>(readData.m_output);
+                                for (size_t i = 0; i < readData.m_size; ++i)
+                                {
+                                    output[i] = azlossy_cast<uint8_t>(readData.m_offset + i);
+                                }
+                                m_heldRead->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                                m_streamerContext->MarkRequestAsCompleted(m_heldRead);
+                                m_heldRead = nullptr;
+                            }
+                        }
+                        m_mock->ForwardQueueRequest(request);
+                    });
+        }
+
         void MockAllocatorForUnclaimedMemory(IStreamerTypes::RequestMemoryAllocatorMock& mock, AZStd::binary_semaphore& sync)
         {
             using ::testing::_;
@@ -157,7 +245,17 @@ namespace AZ::IO
         // the Scheduler, this is fine.
         Streamer* m_streamer{ nullptr };
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{ nullptr };
         AZStd::atomic_bool m_isStackIdle = false;
+
+        // Only accessed on the scheduler thread until m_heldReadSync is released.
+        FileRequest* m_heldRead{ nullptr };
+        AZStd::binary_semaphore m_heldReadSync;
+        AZStd::chrono::system_clock::time_point m_heldReadDeadline;
+        AZStd::chrono::system_clock::time_point m_heldReadEstimate;
+        IStreamerTypes::Priority m_heldReadPriority{ IStreamerTypes::s_priorityLowest };
+        AZStd::atomic_bool m_completeHeldReadOnCancel = false;
     };
 
     TEST_F(Streamer_SchedulerTest, QueueNextRequest_QueueUnclaimedFireAndForgetReadWithAllocator_AllocatorCalledAndMemoryFreedAgain)
@@ -250,6 +348,215 @@ namespace AZ::IO
         allocatorMock.ForwardRelease(buffer);
     }
 
+    TEST_F(Streamer_SchedulerTest, QueueNextRequest_OverlappingAdjacentAndDuplicateReads_ReadsAreMergedIntoOneRead)
+    {
+        constexpr size_t NumReads = 4;
+        constexpr size_t ReadSize = 64;
+        // Two adjacent reads, one that overlaps with both and a duplicate of the first.
+        const size_t offsets[NumReads] = { 0, ReadSize, ReadSize / 2, 0 };
+
+        MockForRead(NumReads);
+
+        AZStd::atomic<size_t> numCompleted{ 0 };
+        AZStd::binary_semaphore sync;
+        auto wait = [&numCompleted, &sync](FileRequestHandle)
+        {
+            if (++numCompleted == NumReads)
+            {
+                sync.release();
+            }
+        };
+
+        u8 buffers[NumReads][ReadSize];
+        FileRequestPtr reads[NumReads];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            reads[i] = m_streamer->Read("TestPath", buffers[i], ReadSize, ReadSize, IStreamerTypes::s_noDeadline,
+                IStreamerTypes::s_priorityMedium, offsets[i]);
+            m_streamer->SetRequestCompleteCallback(reads[i], wait);
+            m_streamer->QueueRequest(reads[i]);
+        }
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(reads[i]));
+            for (size_t j = 0; j < ReadSize; ++j)
+            {
+                ASSERT_EQ(azlossy_cast<u8>(offsets[i] + j), buffers[i][j]);
+            }
+        }
+
+        AZStd::vector<Statistic> statistics;
+        m_streamer->CollectStatistics(statistics);
+        auto findStatistic = [&statistics](AZStd::string_view name) -> s64
+        {
+            for (const Statistic& statistic : statistics)
+            {
+                if (statistic.GetOwner() == "Scheduler" && statistic.GetName() == name)
+                {
+                    return statistic.GetIntegerValue();
+                }
+            }
+            return -1;
+        };
+        EXPECT_EQ(aznumeric_cast<s64>(NumReads), findStatistic("Reads before merging"));
+        EXPECT_EQ(1, findStatistic("Reads after merging"));
+        EXPECT_EQ(1, findStatistic("Duplicate reads"));
+    }
+
+    TEST_F(Streamer_SchedulerTest, QueueNextRequest_MergedReadsWithDeadlines_MergedReadUsesEarliestDeadlineAndEstimateIsShared)
+    {
+        constexpr size_t NumReads = 2;
+        constexpr size_t ReadSize = 64;
+        const auto now = AZStd::chrono::system_clock::now();
+        const AZStd::chrono::microseconds deadlines[NumReads] = { AZStd::chrono::seconds(20), AZStd::chrono::seconds(10) };
+        const IStreamerTypes::Priority priorities[NumReads] = { IStreamerTypes::s_priorityHigh, IStreamerTypes::s_priorityLow };
+
+        m_heldReadEstimate = now + AZStd::chrono::seconds(30);
+        MockForHeldMergedRead(NumReads);
+
+        AZStd::atomic<size_t> numCompleted{ 0 };
+        AZStd::binary_semaphore sync;
+        auto wait = [&numCompleted, &sync](FileRequestHandle)
+        {
+            if (++numCompleted == NumReads + 1)
+            {
+                sync.release();
+            }
+        };
+
+        u8 buffers[NumReads][ReadSize];
+        FileRequestPtr reads[NumReads];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            reads[i] = m_streamer->Read("TestPath", buffers[i], ReadSize, ReadSize, deadlines[i], priorities[i], i * ReadSize);
+            m_streamer->SetRequestCompleteCallback(reads[i], wait);
+            m_streamer->QueueRequest(reads[i]);
+        }
+        m_streamer->ResumeProcessing();
+        ASSERT_TRUE(m_heldReadSync.try_acquire_for(AZStd::chrono::seconds(5)));
+
+        // The combined read needs to be done by the time the most urgent read needs its data.
+        EXPECT_GE(m_heldReadDeadline, now + deadlines[1]);
+        EXPECT_LT(m_heldReadDeadline, now + deadlines[0]);
+        EXPECT_EQ(IStreamerTypes::s_priorityHigh, m_heldReadPriority);
+
+        // Queue another request to have the scheduler update the estimates, then complete the combined read.
+        m_completeHeldReadOnCancel = true;
+        FileRequestPtr cancel = m_streamer->Cancel(m_streamer->CreateRequest());
+        m_streamer->SetRequestCompleteCallback(cancel, wait);
+        m_streamer->QueueRequest(cancel);
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(reads[i]));
+            EXPECT_EQ(m_heldReadEstimate, m_streamer->GetEstimatedRequestCompletionTime(reads[i]));
+        }
+    }
+
+    TEST_F(Streamer_SchedulerTest, ProcessCancelRequest_CancelMergedRead_OtherMergedReadStillCompletes)
+    {
+        constexpr size_t NumReads = 2;
+        constexpr size_t ReadSize = 64;
+        constexpr u8 UntouchedValue = 0xcd;
+
+        MockForHeldMergedRead(NumReads);
+
+        AZStd::atomic<size_t> numCompleted{ 0 };
+        AZStd::binary_semaphore sync;
+        auto wait = [&numCompleted, &sync](FileRequestHandle)
+        {
+            if (++numCompleted == NumReads + 1)
+            {
+                sync.release();
+            }
+        };
+
+        u8 buffers[NumReads][ReadSize];
+        memset(buffers, UntouchedValue, sizeof(buffers));
+        FileRequestPtr reads[NumReads];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            reads[i] = m_streamer->Read("TestPath", buffers[i], ReadSize, ReadSize, IStreamerTypes::s_noDeadline,
+                IStreamerTypes::s_priorityMedium, i * ReadSize);
+            m_streamer->SetRequestCompleteCallback(reads[i], wait);
+            m_streamer->QueueRequest(reads[i]);
+        }
+        m_streamer->ResumeProcessing();
+        ASSERT_TRUE(m_heldReadSync.try_acquire_for(AZStd::chrono::seconds(5)));
+
+        // The cancel reaches the mock after the scheduler has processed it, at which point the mock finishes the combined read.
+        m_completeHeldReadOnCancel = true;
+        FileRequestPtr cancel = m_streamer->Cancel(reads[0]);
+        m_streamer->SetRequestCompleteCallback(cancel, wait);
+        m_streamer->QueueRequest(cancel);
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(cancel));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Canceled, m_streamer->GetRequestStatus(reads[0]));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(reads[1]));
+        for (size_t j = 0; j < ReadSize; ++j)
+        {
+            ASSERT_EQ(UntouchedValue, buffers[0][j]);
+            ASSERT_EQ(azlossy_cast<u8>(ReadSize + j), buffers[1][j]);
+        }
+    }
+
+    TEST_F(Streamer_SchedulerTest, ProcessCancelRequest_CancelAllMergedReads_MergedReadIsCanceled)
+    {
+        constexpr size_t NumReads = 2;
+        constexpr size_t ReadSize = 64;
+
+        MockForHeldMergedRead(NumReads);
+
+        AZStd::atomic<size_t> numCompleted{ 0 };
+        AZStd::binary_semaphore sync;
+        auto wait = [&numCompleted, &sync](FileRequestHandle)
+        {
+            if (++numCompleted == NumReads * 2)
+            {
+                sync.release();
+            }
+        };
+
+        u8 buffers[NumReads][ReadSize];
+        FileRequestPtr reads[NumReads];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            reads[i] = m_streamer->Read("TestPath", buffers[i], ReadSize, ReadSize, IStreamerTypes::s_noDeadline,
+                IStreamerTypes::s_priorityMedium, i * ReadSize);
+            m_streamer->SetRequestCompleteCallback(reads[i], wait);
+            m_streamer->QueueRequest(reads[i]);
+        }
+        m_streamer->ResumeProcessing();
+        ASSERT_TRUE(m_heldReadSync.try_acquire_for(AZStd::chrono::seconds(5)));
+
+        // The combined read is only canceled in the mock once the last of its reads has been canceled.
+        FileRequestPtr cancels[NumReads];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            cancels[i] = m_streamer->Cancel(reads[i]);
+            m_streamer->SetRequestCompleteCallback(cancels[i], wait);
+            m_streamer->QueueRequest(cancels[i]);
+        }
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        for (size_t i = 0; i < NumReads; ++i)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(cancels[i]));
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Canceled, m_streamer->GetRequestStatus(reads[i]));
+        }
+    }
+
     TEST_F(Streamer_SchedulerTest, ProcessCancelRequest_CancelReadRequest_MockDoesNotReceiveReadRequest)
     {
         using ::testing::_;
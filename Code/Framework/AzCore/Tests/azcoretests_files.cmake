@@ -16,6 +16,7 @@ set(FILES
     Asset/MockLoadAssetCatalogAndHandler.h
     Asset/TestAssetTypes.h
     AssetJsonSerializerTests.cpp
+    EBus/ScheduledEventBenchmarks.cpp
     EBus/ScheduledEventTests.cpp
     AssetManager.cpp
     TestCatalog.h
@@ -80,7 +81,9 @@ set(FILES
     Settings/SettingsRegistryConsoleUtilsTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/BlockDecompressorTests.cpp
     Streamer/DedicatedCacheTests.cpp
+    Streamer/DiskCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
@@ -164,11 +167,14 @@ set(FILES
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
     Memory/MallocSchema.cpp
+    Memory/ReservedAddressSpaceSchema.cpp
     AZStd/Algorithms.cpp
     AZStd/Allocators.cpp
     AZStd/Atomics.cpp
@@ -19,6 +19,16 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
             -msse4.1
     )
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
+
+    # Opt in to the AVX2 and FMA math backend, the resulting binaries require a Haswell or newer CPU
+    set(LY_SIMD_AVX2 FALSE CACHE BOOL "Compile for AVX2 and FMA, enabling the eight wide SIMD math backend in AzCore")
+    if(LY_SIMD_AVX2)
+        ly_append_configurations_options(
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
 else()
 
     message(FATAL_ERROR "Compiler ${CMAKE_CXX_COMPILER_ID} not supported in ${PAL_PLATFORM_NAME}")